@@ -309,6 +309,44 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive up to @p max messages at once.
+ *
+ * Drains the message queue of the calling thread and the messages of threads
+ * waiting to send to it in one critical section.  If no message is available,
+ * the calling thread blocks until one arrives.  The messages are stored in
+ * @p out in the order they would be returned by subsequent calls to
+ * @ref msg_receive().
+ *
+ * @param[out] out  Pointer to preallocated array of ``msg_t`` structures with
+ *                  at least @p max entries, must not be NULL.
+ * @param[in] max   Maximum number of messages to receive, must be > 0.
+ *
+ * @return  Number of messages received (>= 1).
+ */
+int msg_receive_batch(msg_t *out, unsigned max);
+
+/**
+ * @brief Send several messages at once (non-blocking).
+ *
+ * All messages are delivered to @p target_pid in one critical section and
+ * with at most one context switch.  If the target is waiting for a message,
+ * the first one is delivered directly, the others are put into the target's
+ * message queue until it is full.  The call never blocks, messages that do
+ * not fit are not delivered.
+ *
+ * Can be called from interrupt context.
+ *
+ * @param[in] m             Pointer to array of @p num preallocated ``msg_t``
+ *                          structures, must not be NULL.
+ * @param[in] num           Number of messages in @p m.
+ * @param[in] target_pid    PID of target thread
+ *
+ * @return Number of messages delivered, starting with `m[0]`
+ * @return -1, on error (invalid PID)
+ */
+int msg_send_batch(msg_t *m, unsigned num, kernel_pid_t target_pid);
+
 /**
  * @brief Send a message, block until reply received.
  *
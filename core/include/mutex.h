@@ -11,6 +11,27 @@
  * @defgroup    core_sync_mutex Mutex
  * @ingroup     core_sync
  * @brief       Mutex for thread synchronization
+ *
+ * With the module `core_mutex_priority_inheritance` a thread blocking on a
+ * mutex lends its priority to the mutex' owner, if the owner has a lower
+ * priority. The owner falls back to the priority it had when it locked the
+ * mutex once it unlocks it. This bounds the time a high priority thread waits
+ * for a mutex held by a low priority thread to the time the latter holds the
+ * mutex, no matter how many threads with a priority in between are ready.
+ *
+ * @note    The original priority is tracked per mutex, so a thread holding
+ *          several mutexes at once should unlock them in reverse order of
+ *          locking.
+ *
+ * @warning The priority is only passed on one level deep: if the owner is
+ *          itself blocked on another mutex, the owner of that mutex is not
+ *          boosted. Neither is the position of a boosted owner in the wait
+ *          queue of such a mutex updated. A high priority thread can hence
+ *          still wait for threads of medium priority when mutexes are nested
+ *          across threads (A waits for B, which waits for C). Avoid locking
+ *          a mutex while holding another one that a higher priority thread
+ *          may lock.
+ *
  * @{
  *
  * @file
@@ -23,7 +44,9 @@
 #define MUTEX_H
 
 #include <stddef.h>
+#include <stdint.h>
 
+#include "kernel_types.h"
 #include "list.h"
 
 #ifdef __cplusplus
@@ -40,18 +63,40 @@ typedef struct {
      * @internal
      */
     list_node_t queue;
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || DOXYGEN
+    /**
+     * @brief   The current owner of the mutex or @ref KERNEL_PID_UNDEF
+     * @note    Only available with module `core_mutex_priority_inheritance`
+     * @internal
+     */
+    kernel_pid_t owner;
+    /**
+     * @brief   Priority of the owner before a waiter boosted it
+     * @note    Only available with module `core_mutex_priority_inheritance`
+     * @internal
+     */
+    uint8_t owner_original_priority;
+#endif
 } mutex_t;
 
 /**
  * @brief Static initializer for mutex_t.
  * @details This initializer is preferable to mutex_init().
  */
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+#define MUTEX_INIT { { NULL }, KERNEL_PID_UNDEF, 0 }
+#else
 #define MUTEX_INIT { { NULL } }
+#endif
 
 /**
  * @brief Static initializer for mutex_t with a locked mutex
  */
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+#define MUTEX_INIT_LOCKED { { MUTEX_LOCKED }, KERNEL_PID_UNDEF, 0 }
+#else
 #define MUTEX_INIT_LOCKED { { MUTEX_LOCKED } }
+#endif
 
 /**
  * @cond INTERNAL
@@ -72,6 +117,9 @@ typedef struct {
 static inline void mutex_init(mutex_t *mutex)
 {
     mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    mutex->owner = KERNEL_PID_UNDEF;
+#endif
 }
 
 /**
@@ -162,6 +162,23 @@ void sched_set_status(thread_t *process, thread_status_t status);
  */
 void sched_switch(uint16_t other_prio);
 
+/**
+ * @brief   Change the priority of a thread
+ *
+ * @details Moves @p thread to the runqueue of its new priority if it is on a
+ *          runqueue. A thread blocked on a mutex or a message keeps its
+ *          position in the respective waiting queue.
+ *
+ *          Like sched_set_status() this does not yield, the caller has to
+ *          call sched_switch() or thread_yield_higher() if appropriate.
+ *
+ * @pre     `(thread != NULL) && (priority < SCHED_PRIO_LEVELS)`
+ *
+ * @param[in,out]   thread      The thread to change the priority of
+ * @param[in]       priority    The new priority of @p thread
+ */
+void sched_change_priority(thread_t *thread, uint8_t priority);
+
 /**
  * @brief   Call context switching at thread exit
  */
@@ -373,6 +373,129 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+int msg_receive_batch(msg_t *out, unsigned max)
+{
+    assert(max > 0);
+
+    unsigned state = irq_disable();
+    thread_t *me = (thread_t*) sched_threads[sched_active_pid];
+    uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+    unsigned n = 0;
+    int queue_index;
+
+    DEBUG("msg_receive_batch: %" PRIkernel_pid ": max=%u\n",
+          sched_active_thread->pid, max);
+
+    if (thread_has_msg_queue(me)) {
+        while ((n < max) && ((queue_index = cib_get(&(me->msg_queue))) >= 0)) {
+            out[n++] = me->msg_array[queue_index];
+        }
+    }
+
+    /* Take messages of waiting senders: directly, if the queue was drained
+     * completely, otherwise into the just freed queue space to keep the
+     * order. */
+    while (me->msg_waiters.next) {
+        msg_t *dest;
+
+        if ((n < max) && (!thread_has_msg_queue(me) ||
+                          (cib_avail(&(me->msg_queue)) == 0))) {
+            dest = &out[n++];
+        }
+        else if (thread_has_msg_queue(me) &&
+                 ((queue_index = cib_put(&(me->msg_queue))) >= 0)) {
+            dest = &me->msg_array[queue_index];
+        }
+        else {
+            break;
+        }
+
+        list_node_t *next = list_remove_head(&me->msg_waiters);
+        thread_t *sender = container_of((clist_node_t*)next, thread_t, rq_entry);
+
+        *dest = *((msg_t*) sender->wait_data);
+        if (sender->status != STATUS_REPLY_BLOCKED) {
+            sender->wait_data = NULL;
+            sched_set_status(sender, STATUS_PENDING);
+            if (sender->priority < sender_prio) {
+                sender_prio = sender->priority;
+            }
+        }
+    }
+
+    if (n == 0) {
+        DEBUG("msg_receive_batch: %" PRIkernel_pid ": No msg. Going blocked.\n",
+              sched_active_thread->pid);
+        me->wait_data = (void *) out;
+        sched_set_status(me, STATUS_RECEIVE_BLOCKED);
+
+        irq_restore(state);
+        thread_yield_higher();
+
+        /* sender copied message */
+        assert(sched_active_thread->status != STATUS_RECEIVE_BLOCKED);
+        return 1;
+    }
+
+    irq_restore(state);
+    if (sender_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(sender_prio);
+    }
+    return n;
+}
+
+int msg_send_batch(msg_t *m, unsigned num, kernel_pid_t target_pid)
+{
+#ifdef DEVELHELP
+    if (!pid_is_valid(target_pid)) {
+        DEBUG("msg_send_batch(): target_pid is invalid, continuing anyways\n");
+    }
+#endif /* DEVELHELP */
+
+    unsigned state = irq_disable();
+    thread_t *target = (thread_t *) sched_threads[target_pid];
+    kernel_pid_t sender_pid = (irq_is_in()) ? KERNEL_PID_ISR : sched_active_pid;
+    bool woken = false;
+    unsigned n = 0;
+
+    if (target == NULL) {
+        DEBUG("msg_send_batch(): target thread does not exist\n");
+        irq_restore(state);
+        return -1;
+    }
+
+    if ((num > 0) && (target->status == STATUS_RECEIVE_BLOCKED)) {
+        DEBUG("msg_send_batch: Direct msg copy to %" PRIkernel_pid ".\n",
+              target_pid);
+        m[0].sender_pid = sender_pid;
+        *((msg_t*) target->wait_data) = m[0];
+        sched_set_status(target, STATUS_PENDING);
+        woken = true;
+        n++;
+    }
+    for (; n < num; n++) {
+        m[n].sender_pid = sender_pid;
+        if (!queue_msg(target, &m[n])) {
+            break;
+        }
+    }
+    DEBUG("msg_send_batch: %u of %u messages delivered to %" PRIkernel_pid
+          ".\n", n, num, target_pid);
+
+    uint16_t target_prio = target->priority;
+    irq_restore(state);
+    if (woken) {
+        if (irq_is_in()) {
+            sched_context_switch_request = 1;
+        }
+        else {
+            sched_switch(target_prio);
+        }
+    }
+
+    return n;
+}
+
 int msg_avail(void)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
@@ -32,6 +32,71 @@
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+static inline void _set_owner(mutex_t *mutex, thread_t *owner)
+{
+    /* there is no owner when locked before the scheduler started */
+    mutex->owner = (owner) ? owner->pid : KERNEL_PID_UNDEF;
+    mutex->owner_original_priority = (owner) ? owner->priority : 0;
+}
+
+static inline void _inherit_priority(mutex_t *mutex, thread_t *me)
+{
+    thread_t *owner = (thread_t *)thread_get(mutex->owner);
+
+    if ((owner != NULL) && (owner->priority > me->priority)) {
+        DEBUG("PID[%" PRIkernel_pid "]: boosting owner %" PRIkernel_pid
+              " to prio %u\n", me->pid, owner->pid, (unsigned)me->priority);
+        sched_change_priority(owner, me->priority);
+    }
+}
+
+/* returns 1 if the owner's priority was lowered again */
+static inline int _restore_priority(mutex_t *mutex)
+{
+    thread_t *owner = (thread_t *)thread_get(mutex->owner);
+    int res = 0;
+
+    if ((owner != NULL) &&
+        (owner->priority != mutex->owner_original_priority)) {
+        DEBUG("PID[%" PRIkernel_pid "]: restoring prio %u\n", owner->pid,
+              (unsigned)mutex->owner_original_priority);
+        sched_change_priority(owner, mutex->owner_original_priority);
+        res = 1;
+    }
+    mutex->owner = KERNEL_PID_UNDEF;
+    return res;
+}
+#else
+static inline void _set_owner(mutex_t *mutex, thread_t *owner)
+{
+    (void)mutex;
+    (void)owner;
+}
+
+static inline void _inherit_priority(mutex_t *mutex, thread_t *me)
+{
+    (void)mutex;
+    (void)me;
+}
+
+static inline int _restore_priority(mutex_t *mutex)
+{
+    (void)mutex;
+    return 0;
+}
+#endif
+
+static inline void _yield(void)
+{
+    if (irq_is_in()) {
+        sched_context_switch_request = 1;
+    }
+    else {
+        thread_yield_higher();
+    }
+}
+
 int _mutex_lock(mutex_t *mutex, int blocking)
 {
     unsigned irqstate = irq_disable();
@@ -41,6 +106,7 @@ int _mutex_lock(mutex_t *mutex, int blocking)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
+        _set_owner(mutex, (thread_t *)sched_active_thread);
         DEBUG("PID[%" PRIkernel_pid "]: mutex_wait early out.\n",
               sched_active_pid);
         irq_restore(irqstate);
@@ -58,6 +124,7 @@ int _mutex_lock(mutex_t *mutex, int blocking)
         else {
             thread_add_to_list(&mutex->queue, me);
         }
+        _inherit_priority(mutex, me);
         irq_restore(irqstate);
         thread_yield_higher();
         /* We were woken up by scheduler. Waker removed us from queue.
@@ -86,7 +153,12 @@ void mutex_unlock(mutex_t *mutex)
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
         /* the mutex was locked and no thread was waiting for it */
+        int lowered = _restore_priority(mutex);
         irq_restore(irqstate);
+        if (lowered) {
+            /* a waiter gave up (e.g. timed out) and left the boost behind */
+            _yield();
+        }
         return;
     }
 
@@ -102,9 +174,18 @@ void mutex_unlock(mutex_t *mutex)
         mutex->queue.next = MUTEX_LOCKED;
     }
 
+    int lowered = _restore_priority(mutex);
+    _set_owner(mutex, process);
+
     uint16_t process_priority = process->priority;
     irq_restore(irqstate);
-    sched_switch(process_priority);
+    if (lowered) {
+        /* not only the woken up thread might take precedence now */
+        _yield();
+    }
+    else {
+        sched_switch(process_priority);
+    }
 }
 
 void mutex_unlock_and_sleep(mutex_t *mutex)
@@ -114,6 +195,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     unsigned irqstate = irq_disable();
 
     if (mutex->queue.next) {
+        _restore_priority(mutex);
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
         }
@@ -126,6 +208,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
             }
+            _set_owner(mutex, process);
         }
     }
 
@@ -19,6 +19,7 @@
  * @}
  */
 
+#include <assert.h>
 #include <stdint.h>
 
 #include "sched.h"
@@ -37,6 +38,10 @@
 #include "xtimer.h"
 #endif
 
+#ifdef MODULE_SCHEDPROF
+#include "schedprof.h"
+#endif
+
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
@@ -123,6 +128,10 @@ int __attribute__((used)) sched_run(void)
 #endif
     }
 
+#ifdef MODULE_SCHEDPROF
+    schedprof_switch(active_thread, next_thread);
+#endif
+
 #ifdef MODULE_SCHEDSTATISTICS
     schedstat_t *next_stat = &sched_pidlist[next_thread->pid];
     next_stat->laststart = now;
@@ -166,6 +175,9 @@ void sched_set_status(thread_t *process, thread_status_t status)
                   process->pid, process->priority);
             clist_rpush(&sched_runqueues[process->priority], &(process->rq_entry));
             runqueue_bitcache |= 1 << process->priority;
+#ifdef MODULE_SCHEDPROF
+            schedprof_ready(process);
+#endif
         }
     }
     else {
@@ -183,6 +195,28 @@ void sched_set_status(thread_t *process, thread_status_t status)
     process->status = status;
 }
 
+void sched_change_priority(thread_t *thread, uint8_t priority)
+{
+    assert((thread != NULL) && (priority < SCHED_PRIO_LEVELS));
+
+    if (thread->priority == priority) {
+        return;
+    }
+
+    unsigned irqstate = irq_disable();
+
+    if (thread->status >= STATUS_ON_RUNQUEUE) {
+        clist_remove(&sched_runqueues[thread->priority], &thread->rq_entry);
+        if (!sched_runqueues[thread->priority].next) {
+            runqueue_bitcache &= ~(1 << thread->priority);
+        }
+        clist_rpush(&sched_runqueues[priority], &thread->rq_entry);
+        runqueue_bitcache |= 1 << priority;
+    }
+    thread->priority = priority;
+    irq_restore(irqstate);
+}
+
 void sched_switch(uint16_t other_prio)
 {
     thread_t *active_thread = (thread_t *) sched_active_thread;
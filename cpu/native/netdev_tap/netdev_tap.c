@@ -68,6 +68,7 @@
 static int _init(netdev_t *netdev);
 static int _send(netdev_t *netdev, const iolist_t *iolist);
 static int _recv(netdev_t *netdev, void *buf, size_t n, void *info);
+static int _recv_iol(netdev_t *netdev, const iolist_t *iolist, void *info);
 
 static inline void _get_mac_addr(netdev_t *netdev, uint8_t *dst)
 {
@@ -162,6 +163,7 @@ static const netdev_driver_t netdev_driver_tap = {
     .isr = _isr,
     .get = _get,
     .set = _set,
+    .recv_iol = _recv_iol,
 };
 
 /* driver implementation */
@@ -204,37 +206,9 @@ static void _continue_reading(netdev_tap_t *dev)
     _native_in_syscall--;
 }
 
-static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
+static int _rx_done(netdev_tap_t *dev, void *buf, ssize_t res)
 {
-    netdev_tap_t *dev = (netdev_tap_t*)netdev;
-    (void)info;
-
-    if (!buf) {
-        if (len > 0) {
-            /* no memory available in pktbuf, discarding the frame */
-            DEBUG("netdev_tap: discarding the frame\n");
-
-            /* repeating `real_read` for small size on tap device results in
-             * freeze for some reason. Using a large buffer for now. */
-            /*
-            uint8_t buf[4];
-            while (real_read(dev->tap_fd, buf, sizeof(buf)) > 0) {
-            }
-            */
-
-            static uint8_t nullbuf[ETHERNET_FRAME_LEN];
-
-            real_read(dev->tap_fd, nullbuf, sizeof(nullbuf));
-
-            _continue_reading(dev);
-        }
-
-        /* no way of figuring out packet size without racey buffering,
-         * so we return the maximum possible size */
-        return ETHERNET_FRAME_LEN;
-    }
-
-    int nread = real_read(dev->tap_fd, buf, len);
+    int nread = (int)res;
     DEBUG("netdev_tap: read %d bytes\n", nread);
 
     if (nread > 0) {
@@ -273,6 +247,52 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     return -1;
 }
 
+static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
+{
+    netdev_tap_t *dev = (netdev_tap_t*)netdev;
+    (void)info;
+
+    if (!buf) {
+        if (len > 0) {
+            /* no memory available in pktbuf, discarding the frame */
+            DEBUG("netdev_tap: discarding the frame\n");
+
+            /* repeating `real_read` for small size on tap device results in
+             * freeze for some reason. Using a large buffer for now. */
+            /*
+            uint8_t buf[4];
+            while (real_read(dev->tap_fd, buf, sizeof(buf)) > 0) {
+            }
+            */
+
+            static uint8_t nullbuf[ETHERNET_FRAME_LEN];
+
+            real_read(dev->tap_fd, nullbuf, sizeof(nullbuf));
+
+            _continue_reading(dev);
+        }
+
+        /* no way of figuring out packet size without racey buffering,
+         * so we return the maximum possible size */
+        return ETHERNET_FRAME_LEN;
+    }
+
+    return _rx_done(dev, buf, real_read(dev->tap_fd, buf, len));
+}
+
+static int _recv_iol(netdev_t *netdev, const iolist_t *iolist, void *info)
+{
+    netdev_tap_t *dev = (netdev_tap_t*)netdev;
+    struct iovec iov[iolist_count(iolist)];
+    unsigned n;
+    (void)info;
+
+    /* the destination address is checked in the first element */
+    assert(iolist->iol_len >= ETHERNET_ADDR_LEN);
+    iolist_to_iovec(iolist, iov, &n);
+    return _rx_done(dev, iolist->iol_base, real_readv(dev->tap_fd, iov, n));
+}
+
 static int _send(netdev_t *netdev, const iolist_t *iolist)
 {
     netdev_tap_t *dev = (netdev_tap_t*)netdev;
@@ -280,7 +300,12 @@ static int _send(netdev_t *netdev, const iolist_t *iolist)
     struct iovec iov[iolist_count(iolist)];
 
     unsigned n;
-    iolist_to_iovec(iolist, iov, &n);
+    size_t bytes = iolist_to_iovec(iolist, iov, &n);
+
+    if (bytes > ETHERNET_FRAME_LEN) {
+        DEBUG("netdev_tap: frame of %u bytes too large\n", (unsigned)bytes);
+        return -ENOBUFS;
+    }
 
     int res = _native_writev(dev->tap_fd, iov, n);
 
@@ -85,7 +85,8 @@ static int gnrc_nrfmin_send(gnrc_netif_t *dev, gnrc_pktsnip_t *pkt)
 
     if (pkt->type != GNRC_NETTYPE_NETIF) {
         DEBUG("[nrfmin_gnrc] send: first header is not generic netif header\n");
-        return -EBADMSG;
+        res = -EBADMSG;
+        goto out;
     }
 
     /* build the nrfmin header from the generic netif header */
@@ -98,6 +98,12 @@
  * This receive sequence can of course be simplified by skipping steps 2 and 3
  * when using fixed sized pre-allocated buffers or similar means. *
  *
+ * Drivers that can read a frame in pieces may additionally provide
+ * @ref netdev_driver_t::recv_iol "recv_iol()" for step 4. It scatters the
+ * frame over an @ref iolist_t, so a network stack can e.g. read the link layer
+ * header into a local variable and the payload directly into its packet
+ * buffer without copying the payload a second time.
+ *
  * @note    The @ref netdev_driver_t::send "send()" and
  *          @ref netdev_driver_t::recv "recv()" functions **must** never be
  *          called from interrupt context.
@@ -427,6 +433,29 @@ typedef struct netdev_driver {
      */
     int (*set)(netdev_t *dev, netopt_t opt,
                const void *value, size_t value_len);
+
+    /**
+     * @brief   Get a received frame, scattered over an IO vector list
+     *
+     * @pre `(dev != NULL) && (iolist != NULL)`
+     *
+     * Optional, may be NULL. Behaves like @ref netdev_driver_t::recv "recv()"
+     * with `buf != NULL`, but fills the elements of @p iolist in order
+     * instead of one contiguous buffer. The size of the frame must be
+     * obtained with @ref netdev_driver_t::recv "recv()" beforehand.
+     *
+     * @param[in]   dev     network device descriptor. Must not be NULL.
+     * @param[out]  iolist  IO vector list to write the frame into. The
+     *                      summed up iolist_t::iol_len is the maximum number
+     *                      of bytes to read.
+     * @param[out] info     status information for the received packet. Might
+     *                      be of different type for different netdev devices.
+     *                      May be NULL if not needed or applicable.
+     *
+     * @return `-ENOBUFS` if @p iolist is too small
+     * @return number of bytes read
+     */
+    int (*recv_iol)(netdev_t *dev, const iolist_t *iolist, void *info);
 } netdev_driver_t;
 
 /**
@@ -130,6 +130,7 @@ static int xbee_adpt_send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
             else if (res == -ENOMSG) {
                 DEBUG("[xbee-gnrc] send: invalid destination l2 address\n");
             }
+            gnrc_pktbuf_release(pkt);
             return res;
         }
         if (hdr->dst_l2addr_len == IEEE802154_SHORT_ADDRESS_LEN) {
@@ -11,6 +11,30 @@
  * @ingroup     net
  * @brief       FIB implementation
  *
+ * By default, every lookup scans all entries of a table and removes entries
+ * whose lifetime expired on the way. With the module `fib_trie`, single hop
+ * tables can keep a longest-prefix-match index (see @ref fib_trie_t) that is
+ * updated on every change of an entry, so lookups no longer depend on the
+ * number of entries. Expired entries are then removed by a sweep over the
+ * table that is triggered by a timer set to the earliest lifetime instead.
+ * To use the index, provide a node pool of
+ * @ref FIB_TRIE_NODES_NUMOF "FIB_TRIE_NODES_NUMOF(size)" nodes in
+ * fib_table_t::trie before calling fib_init().
+ *
+ * Both search modes return an entry that equals the destination if there is
+ * one. Otherwise they differ in which prefix entry they choose:
+ * - The linear search takes the entry for which universal_address_compare()
+ *   reports the most matching bits, if that count is at least the prefix
+ *   length from the entry's @ref FIB_FLAG_NET_PREFIX_MASK flags. That count
+ *   is exact up to the first differing byte only.
+ * - The trie takes the entry with the longest prefix length from its flags,
+ *   all of whose prefix bits match the destination.
+ *
+ * So for prefix lengths that are not a multiple of 8, the linear search may
+ * accept a prefix that does not match in its last bits or prefer a shorter
+ * prefix. For byte aligned prefix lengths and prefix entries without bits set
+ * beyond their prefix length, both return the same entry.
+ *
  * @{
  *
  * @file
@@ -24,6 +24,9 @@
 #include "kernel_types.h"
 #include "universal_address.h"
 #include "mutex.h"
+#ifdef MODULE_FIB_TRIE
+#include "xtimer.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -92,6 +95,55 @@ typedef struct {
     size_t entry_pool_size;
 } fib_sr_meta_t;
 
+#if defined(MODULE_FIB_TRIE) || defined(DOXYGEN)
+/**
+ * @brief Node of the longest-prefix-match trie over the single hop entries
+ *
+ * @note  Only available with module `fib_trie`.
+ */
+typedef struct fib_trie_node {
+    /** the subtrees for a `0` and a `1` at bit fib_trie_node_t::prefix_len */
+    struct fib_trie_node *child[2];
+    /** another node holding an entry with the same prefix */
+    struct fib_trie_node *dup;
+    /** the entry for this prefix, NULL for a pure branching node */
+    fib_entry_t *entry;
+    /** length of the prefix in bits */
+    uint8_t prefix_len;
+    /** the prefix, bits beyond fib_trie_node_t::prefix_len are 0 */
+    uint8_t key[UNIVERSAL_ADDRESS_SIZE];
+} fib_trie_node_t;
+
+/**
+ * @brief Number of trie nodes required for a table of @p entries entries
+ *
+ * Every entry requires at most one node for itself and one branching node.
+ */
+#define FIB_TRIE_NODES_NUMOF(entries)   (2 * (entries))
+
+/**
+ * @brief Longest-prefix-match index and expiry state of a FIB table
+ *
+ * @note  Only available with module `fib_trie`.
+ */
+typedef struct {
+    /** pointer to node pool array, NULL to search the table linearly */
+    fib_trie_node_t *nodes;
+    /** number of nodes in fib_trie_t::nodes */
+    size_t nodes_numof;
+    /** root of the trie */
+    fib_trie_node_t *root;
+    /** list of unused nodes */
+    fib_trie_node_t *free;
+    /** timer firing when the earliest lifetime of an entry expires */
+    xtimer_t expiry_timer;
+    /** absolute time the expiry timer is set to */
+    uint64_t next_expiry;
+    /** set by the expiry timer, entries are swept on the next access */
+    volatile uint8_t sweep_due;
+} fib_trie_t;
+#endif
+
 /**
 * @brief FIB table type for single hop entries
 */
@@ -133,6 +185,13 @@ typedef struct {
     *   e.g. when the unreachable destination is covered by the prefix
     */
     universal_address_container_t* prefix_rp[FIB_MAX_REGISTERED_RP];
+#if defined(MODULE_FIB_TRIE) || defined(DOXYGEN)
+    /** longest-prefix-match index for single hop tables.
+    *   fib_trie_t::nodes and fib_trie_t::nodes_numof must be set before
+    *   calling fib_init(), the rest is initialized by the FIB
+    */
+    fib_trie_t trie;
+#endif
 } fib_table_t;
 
 #ifdef __cplusplus
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_event_loop Single-thread stack mode
+ * @ingroup     net_gnrc
+ * @brief       Runs the GNRC layers in one shared thread
+ *
+ * To activate, use `USEMODULE += gnrc_event_loop` in your application's
+ * Makefile.
+ *
+ * By default, 6LoWPAN, IPv6 and UDP each run in their own thread with their
+ * own stack and message queue, so a packet passes several context switches on
+ * its way between a network interface and an application. With this module
+ * these layers do not start a thread of their own. Instead they register as a
+ * @ref gnrc_event_loop_layer_t with a single thread that runs an
+ * @ref sys_event "event queue" (@ref gnrc_event_loop_queue).
+ *
+ * Layers are registered with @ref net_gnrc_netreg using
+ * @ref net_gnrc_netapi_callbacks "callbacks". A packet dispatched to a layer
+ * is put into a packet queue of the shared thread and handed to the layer by
+ * a direct function call, without copying a message or switching context
+ * between layers. Since packets are still handled one after another in the
+ * order they were dispatched, the semantics of @ref net_gnrc_netapi stay the
+ * same: a layer never handles a packet while it is in the middle of handling
+ * another one.
+ *
+ * Messages sent to the PID of the thread (e.g. timer messages of the NIB or
+ * @ref GNRC_NETAPI_MSG_TYPE_GET / @ref GNRC_NETAPI_MSG_TYPE_SET) are offered to
+ * the registered layers in order of their registration, so
+ * @ref gnrc_ipv6_pid and the PID of 6LoWPAN and UDP all refer to the same
+ * thread.
+ *
+ * @note    Packets must reach the layers via @ref net_gnrc_netreg (e.g.
+ *          gnrc_netapi_dispatch_send()). Packets sent to the shared PID
+ *          directly with gnrc_netapi_send() can not be attributed to a layer
+ *          and are dropped.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Single-thread stack mode definitions
+ */
+#ifndef NET_GNRC_EVENT_LOOP_H
+#define NET_GNRC_EVENT_LOOP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "kernel_types.h"
+#include "msg.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/nettype.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    net_gnrc_event_loop_conf GNRC single-thread stack compile
+ *                                       configurations
+ * @ingroup     net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Default stack size to use for the shared thread
+ *
+ * @note    Layers are called one after another from the thread's main loop,
+ *          so the stack needs to fit the deepest single layer, not the sum
+ *          of them.
+ */
+#ifndef GNRC_EVENT_LOOP_STACK_SIZE
+#define GNRC_EVENT_LOOP_STACK_SIZE      (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Default priority for the shared thread
+ */
+#ifndef GNRC_EVENT_LOOP_PRIO
+#define GNRC_EVENT_LOOP_PRIO            (THREAD_PRIORITY_MAIN - 3)
+#endif
+
+/**
+ * @brief   Default message queue size for the shared thread
+ */
+#ifndef GNRC_EVENT_LOOP_MSG_QUEUE_SIZE
+#define GNRC_EVENT_LOOP_MSG_QUEUE_SIZE  (16U)
+#endif
+
+/**
+ * @brief   Number of packets that can be pending for the layers of the
+ *          shared thread
+ *
+ * @pre     Must be a power of two.
+ */
+#ifndef GNRC_EVENT_LOOP_PKTQ_SIZE
+#define GNRC_EVENT_LOOP_PKTQ_SIZE       (16U)
+#endif
+/** @} */
+
+/**
+ * @brief   A layer running in the shared thread
+ */
+typedef struct gnrc_event_loop_layer {
+    struct gnrc_event_loop_layer *next; /**< next registered layer */
+    /**
+     * @brief   Handles a message for the layer
+     *
+     * Packets dispatched to the layer are handed in as a message of type
+     * @ref GNRC_NETAPI_MSG_TYPE_RCV or @ref GNRC_NETAPI_MSG_TYPE_SND with the
+     * packet in msg_t::content::ptr. Other messages are those sent to the
+     * shared thread.
+     *
+     * @param[in] msg   The message
+     *
+     * @return  true, if the message was handled by the layer
+     * @return  false, if the message should be offered to the next layer
+     */
+    bool (*handle)(msg_t *msg);
+    gnrc_netreg_entry_cbd_t cbd;        /**< netreg callback of the layer */
+    gnrc_netreg_entry_t entry;          /**< netreg entry of the layer */
+} gnrc_event_loop_layer_t;
+
+/**
+ * @brief   Static initializer for @ref gnrc_event_loop_layer_t
+ *
+ * @param[in] _handle   The handler of the layer
+ */
+#define GNRC_EVENT_LOOP_LAYER_INIT(_handle) { .handle = _handle }
+
+/**
+ * @brief   The event queue of the shared thread
+ *
+ * Other modules of the network stack may post their own events to it, to have
+ * them handled in the context of the shared thread.
+ */
+extern event_queue_t gnrc_event_loop_queue;
+
+/**
+ * @brief   Starts the shared thread, if not already running
+ *
+ * @return  The PID of the shared thread
+ */
+kernel_pid_t gnrc_event_loop_init(void);
+
+/**
+ * @brief   Registers a layer with the shared thread
+ *
+ * The layer is registered with @ref net_gnrc_netreg under @p type and
+ * @p demux_ctx.
+ *
+ * @pre     gnrc_event_loop_init() was called
+ *
+ * @param[in] layer     The layer. gnrc_event_loop_layer_t::handle must be set.
+ * @param[in] type      Type of packets the layer handles
+ * @param[in] demux_ctx Demultiplexing context for @p type
+ */
+void gnrc_event_loop_register(gnrc_event_loop_layer_t *layer,
+                              gnrc_nettype_t type, uint32_t demux_ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_EVENT_LOOP_H */
+/** @} */
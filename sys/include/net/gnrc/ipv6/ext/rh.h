@@ -21,6 +21,8 @@
 #define NET_GNRC_IPV6_EXT_RH_H
 
 #include "net/gnrc/pkt.h"
+#include "net/ipv6/ext/rh.h"
+#include "net/ipv6/hdr.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -63,6 +65,30 @@ enum {
  */
 int gnrc_ipv6_ext_rh_process(gnrc_pktsnip_t *pkt);
 
+/**
+ * @brief   Updates the upper-layer checksum of an outgoing packet with a
+ *          routing header to the final destination of the route
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc8200#section-8.1">
+ *          RFC 8200, section 8.1
+ *      </a>
+ *
+ * The pseudo-header of the upper-layer checksum contains the final
+ * destination of a packet, not ipv6_hdr_t::dst. Since only the destination
+ * address differs, the checksum calculated with ipv6_hdr_t::dst is updated
+ * incrementally instead of being recalculated over the whole payload.
+ *
+ * @param[in,out] payload   The upper-layer header with a checksum calculated
+ *                          with @p ipv6 as pseudo-header. Only
+ *                          @ref GNRC_NETTYPE_ICMPV6, @ref GNRC_NETTYPE_TCP
+ *                          and @ref GNRC_NETTYPE_UDP are changed.
+ * @param[in] ipv6          The IPv6 header of the packet.
+ * @param[in] rh            The routing header of the packet.
+ */
+void gnrc_ipv6_ext_rh_update_csum(gnrc_pktsnip_t *payload,
+                                  const ipv6_hdr_t *ipv6,
+                                  const ipv6_ext_rh_t *rh);
+
 #ifdef __cplusplus
 }
 #endif
@@ -76,6 +76,10 @@ extern "C" {
 #define GNRC_IPV6_NIB_CONF_DNS          (1)
 #endif
 
+#ifdef MODULE_GNRC_IPV6_NIB_INDEX
+#define GNRC_IPV6_NIB_CONF_INDEX        (1)
+#endif
+
 /**
  * @name    Compile flags
  * @brief   Compile flags to (de-)activate certain features for NIB
@@ -209,6 +213,18 @@ extern "C" {
 #ifndef GNRC_IPV6_NIB_CONF_MULTIHOP_DAD
 #define GNRC_IPV6_NIB_CONF_MULTIHOP_DAD (0)
 #endif
+
+/**
+ * @brief   Index on-link entries in a hash table and off-link entries in a
+ *          prefix trie
+ *
+ * Without the index, looking up a neighbor or a route scans all entries of
+ * the NIB. Enable this on routers with a large @ref GNRC_IPV6_NIB_NUMOF or
+ * @ref GNRC_IPV6_NIB_OFFL_NUMOF.
+ */
+#ifndef GNRC_IPV6_NIB_CONF_INDEX
+#define GNRC_IPV6_NIB_CONF_INDEX        (0)
+#endif
 /** @} */
 
 /**
@@ -266,6 +282,18 @@ extern "C" {
 #define GNRC_IPV6_NIB_OFFL_NUMOF            (8)
 #endif
 
+#if GNRC_IPV6_NIB_CONF_INDEX || defined(DOXYGEN)
+/**
+ * @brief   Number of slots in the hash index of the on-link entries
+ *
+ * @attention   Must be larger than @ref GNRC_IPV6_NIB_NUMOF. The more slots
+ *              are free, the faster neighbors are found.
+ */
+#ifndef GNRC_IPV6_NIB_INDEX_SIZE
+#define GNRC_IPV6_NIB_INDEX_SIZE            (2 * GNRC_IPV6_NIB_NUMOF)
+#endif
+#endif
+
 #if GNRC_IPV6_NIB_CONF_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
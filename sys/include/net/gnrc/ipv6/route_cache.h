@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_ipv6_route_cache IPv6 route cache
+ * @ingroup     net_gnrc_ipv6
+ * @brief       Memoizes the next hop resolution of unicast destinations
+ *
+ * To activate, use `USEMODULE += gnrc_ipv6_route_cache` in your
+ * application's Makefile.
+ *
+ * For every unicast packet it sends, @ref net_gnrc_ipv6 resolves the
+ * interface and link-layer address of the next hop with the
+ * @ref net_gnrc_ipv6_nib and selects a source address on that interface. With
+ * this module, the results for a destination are kept in a small
+ * direct-mapped cache, so subsequent packets to the same destination skip
+ * that resolution.
+ *
+ * Entries are tagged with the generation counter
+ * @ref gnrc_ipv6_route_cache_gen. Whenever the NIB or the IPv6 addresses of
+ * an interface change in a way that could change a resolution, the counter
+ * is incremented with gnrc_ipv6_route_cache_invalidate(), which invalidates
+ * all entries at once. Only neighbors that are known to be reachable (or are
+ * not subject to neighbor unreachability detection) are cached, so neighbor
+ * unreachability detection still sees all traffic that it needs.
+ *
+ * @note    This is not the destination cache of the NIB
+ *          (@ref GNRC_IPV6_NIB_CONF_DC), which stores redirects.
+ * @note    @ref GNRC_IPV6_NIB_ROUTE_INFO_TYPE_RN route notifications are only
+ *          given when a destination is resolved, not for cache hits.
+ *
+ * @{
+ *
+ * @file
+ * @brief   IPv6 route cache definitions
+ */
+#ifndef NET_GNRC_IPV6_ROUTE_CACHE_H
+#define NET_GNRC_IPV6_ROUTE_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    net_gnrc_ipv6_route_cache_conf GNRC IPv6 route cache compile
+ *                                             configurations
+ * @ingroup     net_gnrc_ipv6_route_cache
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Number of entries in the route cache
+ */
+#ifndef GNRC_IPV6_ROUTE_CACHE_SIZE
+#define GNRC_IPV6_ROUTE_CACHE_SIZE  (8U)
+#endif
+/** @} */
+
+/**
+ * @brief   Generation counter of the route cache
+ *
+ * Entries of the cache are only valid as long as the counter has the value
+ * it had when they were resolved.
+ */
+extern unsigned gnrc_ipv6_route_cache_gen;
+
+/**
+ * @brief   Invalidates all entries of the route cache
+ *
+ * Must be called whenever neighbors, routes, prefixes or default routers in
+ * the NIB or IPv6 addresses of interfaces change. Without module
+ * `gnrc_ipv6_route_cache` this does nothing.
+ */
+static inline void gnrc_ipv6_route_cache_invalidate(void)
+{
+#ifdef MODULE_GNRC_IPV6_ROUTE_CACHE
+    gnrc_ipv6_route_cache_gen++;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_IPV6_ROUTE_CACHE_H */
+/** @} */
@@ -47,6 +47,9 @@
 #ifdef MODULE_GNRC_MAC
 #include "net/gnrc/netif/mac.h"
 #endif
+#ifdef MODULE_GNRC_NETIF_PKTQ
+#include "net/gnrc/netif/pktq/type.h"
+#endif
 #include "net/ndp.h"
 #include "net/netdev.h"
 #include "net/netopt.h"
@@ -80,6 +83,9 @@ typedef struct {
 #if defined(MODULE_GNRC_MAC) || DOXYGEN
     gnrc_netif_mac_t mac;                  /**< @ref net_gnrc_mac component */
 #endif  /* MODULE_GNRC_MAC */
+#if defined(MODULE_GNRC_NETIF_PKTQ) || DOXYGEN
+    gnrc_netif_pktq_t send_queue;           /**< @ref net_gnrc_netif_pktq */
+#endif
     /**
      * @brief   Flags for the interface
      *
@@ -158,6 +164,30 @@ struct gnrc_netif_ops {
      */
     int (*send)(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
 
+    /**
+     * @brief   Send several @ref net_gnrc_pkt "packets" over the network
+     *          interface at once
+     *
+     * @pre `netif != NULL && pkts != NULL && num > 0`
+     *
+     * Only used by @ref net_gnrc_netif_pktq to send a burst of its queue to a
+     * device that can take several frames at once. Leave NULL otherwise,
+     * gnrc_netif_ops_t::send() is then called for each packet.
+     *
+     * @note The function releases every packet it takes from @p pkts, whether
+     *       sending it succeeded or not. Packets it did not take must be
+     *       left untouched.
+     *
+     * @param[in] netif The network interface.
+     * @param[in] pkts  Packets to send, oldest first.
+     * @param[in] num   Number of packets in @p pkts.
+     *
+     * @return  Number of packets taken from the start of @p pkts. Less than
+     *          @p num, if the device was busy.
+     */
+    unsigned (*send_batch)(gnrc_netif_t *netif, gnrc_pktsnip_t **pkts,
+                           unsigned num);
+
     /**
      * @brief   Receives a @ref net_gnrc_pkt "packet" from the network interface
      *
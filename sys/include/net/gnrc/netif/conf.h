@@ -57,6 +57,20 @@ extern "C" {
 #define GNRC_NETIF_MSG_QUEUE_SIZE  (16U)
 #endif
 
+/**
+ * @brief       Maximum number of messages a network interface thread takes
+ *              from its queue per wakeup
+ *
+ * @attention   This has influence on the used stack memory of the thread, so
+ *              the thread's stack size might need to be adapted if this is
+ *              changed.
+ *
+ * @see         msg_receive_batch()
+ */
+#ifndef GNRC_NETIF_MSG_BATCH_SIZE
+#define GNRC_NETIF_MSG_BATCH_SIZE  (4U)
+#endif
+
 /**
  * @brief   Number of multicast addresses needed for @ref net_gnrc_rpl "RPL".
  *
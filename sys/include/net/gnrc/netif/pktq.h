@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_netif_pktq Send queue for @ref net_gnrc_netif
+ * @ingroup     net_gnrc_netif
+ * @brief       Queues outgoing packets of a network interface
+ *
+ * To activate, use `USEMODULE += gnrc_netif_pktq` in your application's
+ * Makefile.
+ *
+ * With this module a network interface does not hand a packet to its device
+ * right when it receives it via @ref GNRC_NETAPI_MSG_TYPE_SND, but puts it
+ * into a first-in-first-out queue first. The queue is flushed after each
+ * batch of messages the interface's thread handled (see
+ * @ref GNRC_NETIF_MSG_BATCH_SIZE), at most @ref GNRC_NETIF_PKTQ_BURST packets
+ * at a time.
+ *
+ * A packet only leaves the queue when gnrc_netif_ops_t::send() did not
+ * report the device to be busy (`-EBUSY`). Otherwise, it stays at the head of
+ * the queue and sending is retried on the next wakeup of the thread, at the
+ * latest after @ref GNRC_NETIF_PKTQ_RETRY_US.
+ *
+ * If the interface implements gnrc_netif_ops_t::send_batch(), a whole burst
+ * is handed to it at once instead.
+ *
+ * @note    To allow for this, the packet is held once more while
+ *          gnrc_netif_ops_t::send() is called. The send function of a network
+ *          interface used with this module must hence not change the packet's
+ *          list of snips (e.g. with gnrc_pktbuf_remove_snip()).
+ *
+ * @{
+ *
+ * @file
+ * @brief   Send queue definitions
+ */
+#ifndef NET_GNRC_NETIF_PKTQ_H
+#define NET_GNRC_NETIF_PKTQ_H
+
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/pktq/type.h"
+#include "net/gnrc/pkt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of packets sent per wakeup of the interface's
+ *          thread
+ */
+#ifndef GNRC_NETIF_PKTQ_BURST
+#define GNRC_NETIF_PKTQ_BURST       (4U)
+#endif
+
+/**
+ * @brief   Drop the oldest packet of a full queue instead of the new one
+ *
+ * Set to 1 to prefer fresh packets over old ones, e.g. for periodic sensor
+ * data.
+ */
+#ifndef GNRC_NETIF_PKTQ_DROP_HEAD
+#define GNRC_NETIF_PKTQ_DROP_HEAD   (0)
+#endif
+
+/**
+ * @brief   Time in microseconds after which sending is retried when the
+ *          device was busy or the thread's message queue was full
+ */
+#ifndef GNRC_NETIF_PKTQ_RETRY_US
+#define GNRC_NETIF_PKTQ_RETRY_US    (5000U)
+#endif
+
+/**
+ * @brief   Message type to make the interface's thread flush its send queue
+ */
+#define GNRC_NETIF_PKTQ_DEQUEUE_MSG (0x0230)
+
+/**
+ * @brief   Initializes a send queue
+ *
+ * @param[out] q    A send queue.
+ */
+void gnrc_netif_pktq_init(gnrc_netif_pktq_t *q);
+
+/**
+ * @brief   Puts a packet at the end of a send queue
+ *
+ * If the queue is full, either @p pkt or the queue's head (see
+ * @ref GNRC_NETIF_PKTQ_DROP_HEAD) is released.
+ *
+ * @param[in] q         A send queue.
+ * @param[in] pkt       A packet.
+ *
+ * @return  0, on success.
+ * @return  -ENOBUFS, if a packet had to be dropped.
+ */
+int gnrc_netif_pktq_put(gnrc_netif_pktq_t *q, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Gets the oldest packet of a send queue without removing it
+ *
+ * @param[in] q     A send queue.
+ *
+ * @return  The packet, NULL if @p q is empty.
+ */
+static inline gnrc_pktsnip_t *gnrc_netif_pktq_peek(const gnrc_netif_pktq_t *q)
+{
+    return (q->fill > 0) ? q->pkts[q->head] : NULL;
+}
+
+/**
+ * @brief   Takes the oldest packet from a send queue
+ *
+ * @param[in] q     A send queue.
+ *
+ * @return  The packet, NULL if @p q is empty.
+ */
+gnrc_pktsnip_t *gnrc_netif_pktq_get(gnrc_netif_pktq_t *q);
+
+/**
+ * @brief   Gets the number of packets in a send queue
+ *
+ * @param[in] q     A send queue.
+ *
+ * @return  Number of packets in @p q.
+ */
+static inline unsigned gnrc_netif_pktq_usage(const gnrc_netif_pktq_t *q)
+{
+    return q->fill;
+}
+
+/**
+ * @brief   Gets the statistics of a send queue
+ *
+ * @param[in] q     A send queue.
+ *
+ * @return  The statistics of @p q.
+ */
+static inline const gnrc_netif_pktq_stats_t *gnrc_netif_pktq_stats(
+                                                const gnrc_netif_pktq_t *q)
+{
+    return &q->stats;
+}
+
+/**
+ * @brief   Sends up to @ref GNRC_NETIF_PKTQ_BURST packets from the head of a
+ *          network interface's send queue
+ *
+ * @pre `netif != NULL`
+ *
+ * Must be called from the thread of @p netif. If packets remain in the queue,
+ * a @ref GNRC_NETIF_PKTQ_DEQUEUE_MSG is sent to the thread, or, if the device
+ * was busy or the thread's message queue is full, scheduled to arrive after
+ * @ref GNRC_NETIF_PKTQ_RETRY_US.
+ *
+ * @param[in] netif A network interface.
+ *
+ * @return  Number of packets that left the queue.
+ */
+unsigned gnrc_netif_pktq_send(gnrc_netif_t *netif);
+
+/**
+ * @brief   Releases all packets in a send queue
+ *
+ * Also stops a pending retry.
+ *
+ * @param[in] q     A send queue.
+ */
+void gnrc_netif_pktq_flush(gnrc_netif_pktq_t *q);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_NETIF_PKTQ_H */
+/** @} */
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  net_gnrc_netif_pktq
+ * @{
+ *
+ * @file
+ * @brief   Send queue type definitions
+ *
+ * Separate from @ref net/gnrc/netif/pktq.h, so @ref net/gnrc/netif.h can
+ * include it.
+ */
+#ifndef NET_GNRC_NETIF_PKTQ_TYPE_H
+#define NET_GNRC_NETIF_PKTQ_TYPE_H
+
+#include <stdint.h>
+
+#include "msg.h"
+#include "net/gnrc/pkt.h"
+#include "xtimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of packets in the send queue of an interface
+ *
+ * @note    Must not exceed 255.
+ */
+#ifndef GNRC_NETIF_PKTQ_SIZE
+#define GNRC_NETIF_PKTQ_SIZE        (8U)
+#endif
+
+/**
+ * @brief   Statistics of a send queue
+ */
+typedef struct {
+    uint32_t queued;            /**< packets put into the queue */
+    uint32_t dropped;           /**< packets dropped because the queue was full */
+    uint32_t busy;              /**< send attempts the device rejected as busy */
+    uint16_t max_fill;          /**< maximum number of packets in the queue */
+} gnrc_netif_pktq_stats_t;
+
+/**
+ * @brief   A send queue
+ */
+typedef struct {
+    gnrc_pktsnip_t *pkts[GNRC_NETIF_PKTQ_SIZE]; /**< ring buffer of packets */
+    gnrc_netif_pktq_stats_t stats;      /**< statistics */
+    xtimer_t retry_timer;               /**< timer to retry a busy device */
+    msg_t retry_msg;                    /**< message of gnrc_netif_pktq_t::retry_timer */
+    uint8_t head;                       /**< index of the oldest packet */
+    uint8_t fill;                       /**< number of queued packets */
+} gnrc_netif_pktq_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_NETIF_PKTQ_TYPE_H */
+/** @} */
@@ -58,6 +58,44 @@ extern "C" {
 #define GNRC_PKTBUF_SIZE    (6144)
 #endif  /* GNRC_PKTBUF_SIZE */
 
+/**
+ * @name    Slab packet buffer configuration
+ *
+ * The `gnrc_pktbuf_slab` implementation allocates packet snips and packet
+ * data from fixed-size pools. Data is put into the smallest of four size
+ * classes it fits in, larger classes are used once a class is exhausted.
+ * The largest class bounds the size of a single packet snip.
+ * @{
+ */
+#ifndef GNRC_PKTBUF_SLAB_SNIP_NUMOF
+#define GNRC_PKTBUF_SLAB_SNIP_NUMOF     (32U)   /**< number of packet snips */
+#endif
+#ifndef GNRC_PKTBUF_SLAB_SIZE_1
+#define GNRC_PKTBUF_SLAB_SIZE_1         (32U)   /**< block size of class 1 */
+#endif
+#ifndef GNRC_PKTBUF_SLAB_NUMOF_1
+#define GNRC_PKTBUF_SLAB_NUMOF_1        (16U)   /**< blocks in class 1 */
+#endif
+#ifndef GNRC_PKTBUF_SLAB_SIZE_2
+#define GNRC_PKTBUF_SLAB_SIZE_2         (64U)   /**< block size of class 2 */
+#endif
+#ifndef GNRC_PKTBUF_SLAB_NUMOF_2
+#define GNRC_PKTBUF_SLAB_NUMOF_2        (16U)   /**< blocks in class 2 */
+#endif
+#ifndef GNRC_PKTBUF_SLAB_SIZE_3
+#define GNRC_PKTBUF_SLAB_SIZE_3         (256U)  /**< block size of class 3 */
+#endif
+#ifndef GNRC_PKTBUF_SLAB_NUMOF_3
+#define GNRC_PKTBUF_SLAB_NUMOF_3        (8U)    /**< blocks in class 3 */
+#endif
+#ifndef GNRC_PKTBUF_SLAB_SIZE_4
+#define GNRC_PKTBUF_SLAB_SIZE_4         (1536U) /**< block size of class 4 */
+#endif
+#ifndef GNRC_PKTBUF_SLAB_NUMOF_4
+#define GNRC_PKTBUF_SLAB_NUMOF_4        (2U)    /**< blocks in class 4 */
+#endif
+/** @} */
+
 /**
  * @brief   Initializes packet buffer module.
  */
@@ -347,6 +385,23 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt);
  * @details Statistics include maximum number of reserved bytes.
  */
 void gnrc_pktbuf_stats(void);
+
+/**
+ * @brief   Returns the high-water mark of the packet buffer
+ *
+ * @note    Only available with DEVELHELP defined.
+ *
+ * For `gnrc_pktbuf_static` this is the position of the last byte of the
+ * packet buffer that was allocated, for `gnrc_pktbuf_slab` the accumulated
+ * size of the maximum number of blocks used per class.
+ * `gnrc_pktbuf_malloc` does not track its usage and always returns 0.
+ *
+ * @param[in] reset Start tracking anew after returning the high-water mark.
+ *
+ * @return  The high-water mark in bytes since initialization or the last
+ *          reset.
+ */
+size_t gnrc_pktbuf_high_water(bool reset);
 #endif
 
 /* for testing */
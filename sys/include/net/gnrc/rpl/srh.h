@@ -69,6 +69,21 @@ typedef struct __attribute__((packed)) {
  */
 int gnrc_rpl_srh_process(ipv6_hdr_t *ipv6, gnrc_rpl_srh_t *rh, void **err_ptr);
 
+/**
+ * @brief   Gets the final destination of the route in a RPL source routing
+ *          header.
+ *
+ * @param[in] ipv6  The IPv6 header of the packet. Its destination provides
+ *                  the prefix elided from the last address in @p rh.
+ * @param[in] rh    A RPL source routing header.
+ * @param[out] dst  The final destination, i.e. the last address in @p rh.
+ *
+ * @return  0, on success
+ * @return  -EINVAL, if @p rh does not contain an address
+ */
+int gnrc_rpl_srh_final_dst(const ipv6_hdr_t *ipv6, const gnrc_rpl_srh_t *rh,
+                           ipv6_addr_t *dst);
+
 #ifdef __cplusplus
 }
 #endif
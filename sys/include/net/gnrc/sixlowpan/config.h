@@ -97,6 +97,81 @@ extern "C" {
 #define GNRC_SIXLOWPAN_FRAG_RBUF_AGGRESSIVE_OVERRIDE    (1)
 #endif
 
+/**
+ * @brief   Size of the virtual reassembly buffer
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) module
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_VRB_SIZE
+#define GNRC_SIXLOWPAN_FRAG_VRB_SIZE        (2 * GNRC_SIXLOWPAN_FRAG_RBUF_SIZE)
+#endif
+
+/**
+ * @brief   Timeout for virtual reassembly buffer entries in microseconds
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) module
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US
+#define GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US  (GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)
+#endif
+
+/**
+ * @brief   Number of fragments that are sent before an acknowledgment is
+ *          requested
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_sfr](@ref net_gnrc_sixlowpan_frag_sfr) module
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_SFR_WIN_SIZE
+#define GNRC_SIXLOWPAN_FRAG_SFR_WIN_SIZE        (8U)
+#endif
+
+/**
+ * @brief   Minimum time in microseconds between two fragments of a window
+ *
+ * 0 sends the next fragment as soon as the previous was handed to the
+ * interface.
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_sfr](@ref net_gnrc_sixlowpan_frag_sfr) module
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_SFR_INTER_FRAME_GAP_US
+#define GNRC_SIXLOWPAN_FRAG_SFR_INTER_FRAME_GAP_US  (0U)
+#endif
+
+/**
+ * @brief   Time in microseconds to wait for an acknowledgment
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_sfr](@ref net_gnrc_sixlowpan_frag_sfr) module
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_US
+#define GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_US  (700U * US_PER_MS)
+#endif
+
+/**
+ * @brief   Number of times a window is retransmitted when no acknowledgment
+ *          arrives, before the datagram is given up
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_sfr](@ref net_gnrc_sixlowpan_frag_sfr) module
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_SFR_FRAG_RETRIES
+#define GNRC_SIXLOWPAN_FRAG_SFR_FRAG_RETRIES    (2U)
+#endif
+
+/**
+ * @brief   Number of datagrams for which the received fragments are tracked
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_sfr](@ref net_gnrc_sixlowpan_frag_sfr) module
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_SFR_RX_SIZE
+#define GNRC_SIXLOWPAN_FRAG_SFR_RX_SIZE         (GNRC_SIXLOWPAN_FRAG_RBUF_SIZE)
+#endif
+
 /**
  * @brief   Registration lifetime in minutes for the address registration option
  *
@@ -28,6 +28,7 @@
 #include <inttypes.h>
 #include <stdbool.h>
 
+#include "bitfield.h"
 #include "byteorder.h"
 #include "msg.h"
 #include "net/gnrc/pkt.h"
@@ -35,6 +36,9 @@
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_HINT
 #include "net/gnrc/sixlowpan/frag/hint.h"
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_HINT */
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+#include "net/gnrc/sixlowpan/frag/sfr_types.h"
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
 #include "net/gnrc/sixlowpan/internal.h"
 #include "net/ieee802154.h"
 #include "net/sixlowpan.h"
@@ -56,10 +60,22 @@ extern "C" {
  * @brief   Message type for triggering garbage collection reassembly buffer
  */
 #define GNRC_SIXLOWPAN_MSG_FRAG_GC_RBUF     (0x0226)
+
+/**
+ * @brief   Message type for a timed out acknowledgment of selective fragment
+ *          recovery
+ */
+#define GNRC_SIXLOWPAN_MSG_FRAG_SFR_ARQ_TIMEOUT (0x0227)
 /** @} */
 
 /**
- * @brief   Fragment intervals to identify limits of fragments and duplicates.
+ * @brief   Number of 8-octet units of the largest datagram that can be
+ *          reassembled
+ */
+#define GNRC_SIXLOWPAN_FRAG_RBUF_UNITS  ((SIXLOWPAN_FRAG_MAX_LEN + 7) / 8)
+
+/**
+ * @brief   Interval of a received fragment.
  *
  * @note    Fragments MUST NOT overlap and overlapping fragments are to be
  *          discarded
@@ -68,11 +84,7 @@ extern "C" {
  *          RFC 4944, section 5.3
  *      </a>
  */
-typedef struct gnrc_sixlowpan_rbuf_int {
-    /**
-     * @brief   next element in fragment interval list
-     */
-    struct gnrc_sixlowpan_rbuf_int *next;
+typedef struct {
     uint16_t start;             /**< start byte of the fragment interval */
     uint16_t end;               /**< end byte of the fragment interval */
 } gnrc_sixlowpan_rbuf_int_t;
@@ -91,7 +103,6 @@ typedef struct gnrc_sixlowpan_rbuf_int {
  * @see https://tools.ietf.org/html/draft-ietf-lwig-6lowpan-virtual-reassembly-01
  */
 typedef struct {
-    gnrc_sixlowpan_rbuf_int_t *ints;            /**< intervals of already received fragments */
     uint8_t src[IEEE802154_LONG_ADDRESS_LEN];   /**< source address */
     uint8_t dst[IEEE802154_LONG_ADDRESS_LEN];   /**< destination address */
     uint8_t src_len;                            /**< length of gnrc_sixlowpan_rbuf_t::src */
@@ -118,6 +129,14 @@ typedef struct {
      * @brief   The reassembled packet in the packet buffer
      */
     gnrc_pktsnip_t *pkt;
+    /**
+     * @brief   8-octet units of the datagram that were already received
+     */
+    BITFIELD(received, GNRC_SIXLOWPAN_FRAG_RBUF_UNITS);
+    /**
+     * @brief   8-octet units of the datagram a received fragment starts at
+     */
+    BITFIELD(starts, GNRC_SIXLOWPAN_FRAG_RBUF_UNITS);
 } gnrc_sixlowpan_rbuf_t;
 
 /**
@@ -136,6 +155,12 @@ typedef struct {
      */
     gnrc_sixlowpan_frag_hint_t hint;
 #endif /* MODULE_GNRC_SIXLOWPAN_FRAG_HINT */
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    /**
+     * @brief   State of selective fragment recovery
+     */
+    gnrc_sixlowpan_frag_sfr_fb_t sfr;
+#endif /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
 } gnrc_sixlowpan_msg_frag_t;
 
 /**
@@ -146,6 +171,19 @@ typedef struct {
  */
 gnrc_sixlowpan_msg_frag_t *gnrc_sixlowpan_msg_frag_get(void);
 
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) || defined(DOXYGEN)
+/**
+ * @brief   Gets the @ref gnrc_sixlowpan_msg_frag_t object of a datagram that
+ *          is sent with selective fragment recovery
+ *
+ * @param[in] tag   Datagram tag of the datagram.
+ *
+ * @return  The @ref gnrc_sixlowpan_msg_frag_t of the datagram.
+ * @return  NULL, if no such datagram is sent.
+ */
+gnrc_sixlowpan_msg_frag_t *gnrc_sixlowpan_msg_frag_get_sfr(uint8_t tag);
+#endif
+
 /**
  * @brief   Sends a packet fragmented
  *
@@ -215,6 +253,52 @@ static inline bool gnrc_sixlowpan_frag_send_msg(gnrc_sixlowpan_msg_frag_t *fragm
 }
 
 #if defined(MODULE_GNRC_SIXLOWPAN_FRAG) || defined(DOXYGEN)
+/**
+ * @brief   Adds a fragment that does not have a RFC 4944 fragment header to
+ *          the reassembly buffer
+ *
+ * If the datagram is complete, it is dispatched with the transmit
+ * information of @p netif_hdr.
+ *
+ * @param[in] netif_hdr     The interface header of the fragment.
+ * @param[in] frag          The fragment. Released in any case.
+ * @param[in] hdr_len       Length of the fragment header at the start of
+ *                          @p frag.
+ * @param[in] offset        The fragment's offset in the uncompressed
+ *                          datagram. Must be a multiple of 8.
+ * @param[in] datagram_size Size of the uncompressed datagram.
+ * @param[in] tag           The datagram's tag.
+ * @param[in] page          Current 6Lo dispatch parsing page.
+ *
+ * @return  0, if the fragment was added or was a duplicate.
+ * @return  -ENOSPC, if there was no space to add the fragment.
+ * @return  -EINVAL, if the datagram was discarded due to the fragment.
+ */
+int gnrc_sixlowpan_frag_rbuf_add(gnrc_netif_hdr_t *netif_hdr,
+                                 gnrc_pktsnip_t *frag, size_t hdr_len,
+                                 size_t offset, size_t datagram_size,
+                                 uint16_t tag, unsigned page);
+
+/**
+ * @brief   Gets the interval of the first received fragment of a reassembly
+ *          buffer entry that starts at or after a given offset
+ *
+ * To iterate over all received fragments, start with @p from 0 and continue
+ * with gnrc_sixlowpan_rbuf_int_t::end + 1 of the last found interval.
+ *
+ * @pre `(rbuf != NULL) && (interval != NULL)`
+ *
+ * @param[in] rbuf      A reassembly buffer entry. Must not be NULL.
+ * @param[in] from      Offset in the datagram to start the search at.
+ * @param[out] interval The interval of the fragment found. Must not be NULL.
+ *
+ * @return  true, if a fragment was found.
+ * @return  false, if there are no more fragments.
+ */
+bool gnrc_sixlowpan_frag_rbuf_int_get(const gnrc_sixlowpan_rbuf_t *rbuf,
+                                      uint16_t from,
+                                      gnrc_sixlowpan_rbuf_int_t *interval);
+
 /**
  * @brief   Removes an entry from the reassembly buffer
  *
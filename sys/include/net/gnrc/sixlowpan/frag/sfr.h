@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_sixlowpan_frag_sfr Selective fragment recovery
+ * @ingroup     net_gnrc_sixlowpan_frag
+ * @brief       Acknowledged 6LoWPAN fragmentation with selective
+ *              retransmission of lost fragments
+ * @see         [RFC 8931](https://tools.ietf.org/html/rfc8931)
+ *
+ * To activate, use `USEMODULE += gnrc_sixlowpan_frag_sfr` in your
+ * application's Makefile. All nodes that exchange fragmented datagrams need
+ * this module.
+ *
+ * Datagrams are sent as recoverable fragments (RFRAG) with a sequence number.
+ * After a window of @ref GNRC_SIXLOWPAN_FRAG_SFR_WIN_SIZE fragments and with
+ * the last fragment of a datagram, the sender requests an acknowledgment. The
+ * receiver answers with a bitmap of all fragments it received so far
+ * (RFRAG-ACK), so only the fragments missing from that bitmap are sent
+ * again. Without an answer within @ref GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_US
+ * all unacknowledged fragments are sent again, at most
+ * @ref GNRC_SIXLOWPAN_FRAG_SFR_FRAG_RETRIES times in a row.
+ *
+ * The received fragments are reassembled in the
+ * [reassembly buffer](@ref net_gnrc_sixlowpan_frag) of RFC 4944 fragments.
+ * Different from RFC 8931, the offset of every fragment but the first refers
+ * to the uncompressed datagram and is a multiple of 8, like the offset of
+ * RFC 4944 fragments. A
+ * fragment that arrives before the first fragment of its datagram is dropped
+ * and recovered later.
+ *
+ * Datagrams that need more than @ref SIXLOWPAN_SFR_ACK_BITMAP_SIZE fragments
+ * are sent with RFC 4944 fragments.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Selective fragment recovery definitions
+ */
+#ifndef NET_GNRC_SIXLOWPAN_FRAG_SFR_H
+#define NET_GNRC_SIXLOWPAN_FRAG_SFR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "net/gnrc/netif.h"
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/gnrc/sixlowpan/frag.h"
+#include "net/gnrc/sixlowpan/frag/sfr_types.h"
+#include "net/sixlowpan/sfr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Sends the next fragment of a datagram with selective fragment
+ *          recovery
+ *
+ * @param[in] netif         The interface to send over.
+ * @param[in] fragment_msg  Fragmentation state of the datagram.
+ * @param[in] payload_len   Length of the (compressed) datagram.
+ *
+ * @return  true, if the datagram is sent with selective fragment recovery.
+ * @return  false, if the datagram is to be sent with RFC 4944 fragments.
+ */
+bool gnrc_sixlowpan_frag_sfr_send(gnrc_netif_t *netif,
+                                  gnrc_sixlowpan_msg_frag_t *fragment_msg,
+                                  size_t payload_len);
+
+/**
+ * @brief   Handles a packet containing a selective fragment recovery header
+ *
+ * @param[in] pkt       The packet to handle
+ * @param[in] ctx       Context for the packet. May be NULL.
+ * @param[in] page      Current 6Lo dispatch parsing page.
+ */
+void gnrc_sixlowpan_frag_sfr_recv(gnrc_pktsnip_t *pkt, void *ctx,
+                                  unsigned page);
+
+/**
+ * @brief   Handles a timed out acknowledgment
+ *
+ * @see GNRC_SIXLOWPAN_MSG_FRAG_SFR_ARQ_TIMEOUT
+ *
+ * @param[in] fragment_msg  Fragmentation state of the datagram.
+ */
+void gnrc_sixlowpan_frag_sfr_arq_timeout(gnrc_sixlowpan_msg_frag_t *fragment_msg);
+
+/**
+ * @brief   Marks a datagram received with selective fragment recovery as
+ *          complete
+ *
+ * Called by the reassembly buffer right before a complete datagram is
+ * dispatched.
+ *
+ * @param[in] base  Identification of the reassembled datagram.
+ */
+void gnrc_sixlowpan_frag_sfr_rbuf_complete(const gnrc_sixlowpan_rbuf_base_t *base);
+
+#if defined(TEST_SUITES) || defined(DOXYGEN)
+/**
+ * @brief   Resets the receiving state of selective fragment recovery
+ *
+ * @note    Only available when @ref TEST_SUITES is defined
+ */
+void gnrc_sixlowpan_frag_sfr_reset(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_SIXLOWPAN_FRAG_SFR_H */
+/** @} */
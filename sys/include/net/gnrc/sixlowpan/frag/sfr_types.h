@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  net_gnrc_sixlowpan_frag_sfr
+ * @{
+ *
+ * @file
+ * @brief   Selective fragment recovery type definitions
+ */
+#ifndef NET_GNRC_SIXLOWPAN_FRAG_SFR_TYPES_H
+#define NET_GNRC_SIXLOWPAN_FRAG_SFR_TYPES_H
+
+#include <stdint.h>
+
+#include "msg.h"
+#include "xtimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Sending state of selective fragment recovery for a datagram
+ *
+ * Bitmaps use the layout of a RFRAG-ACK bitmap, i.e. the most significant
+ * bit represents the fragment with sequence 0.
+ */
+typedef struct {
+    xtimer_t timer;     /**< timer for acknowledgments and the inter-frame
+                         *   gap */
+    msg_t msg;          /**< message for gnrc_sixlowpan_frag_sfr_fb_t::timer */
+    uint32_t sent;      /**< fragments that were sent and not reported
+                         *   missing */
+    uint32_t acked;     /**< fragments that were acknowledged */
+    /**
+     * @brief   Time in microseconds at which the current acknowledgment
+     *          request times out
+     *
+     * Identifies timeout messages of earlier requests that were already
+     * queued when the timer was set again.
+     */
+    uint32_t arq_deadline;
+    uint16_t frag1_size;    /**< size of the payload of the first fragment */
+    uint16_t frag_size;     /**< size of the payload of all other fragments,
+                             *   a multiple of 8 */
+    /**
+     * @brief   Number of fragments of the datagram
+     *
+     * 0 if the datagram is not sent with selective fragment recovery.
+     */
+    uint8_t frags;
+    uint8_t window;     /**< fragments sent since the last acknowledgment
+                         *   request */
+    uint8_t retries;    /**< retransmissions of a window without progress */
+} gnrc_sixlowpan_frag_sfr_fb_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_SIXLOWPAN_FRAG_SFR_TYPES_H */
+/** @} */
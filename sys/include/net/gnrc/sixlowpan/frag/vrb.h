@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_sixlowpan_frag_vrb Virtual reassembly buffer
+ * @ingroup     net_gnrc_sixlowpan_frag
+ * @brief       Forwarding of 6LoWPAN fragments without reassembly
+ * @see [LWIG 6LoWPAN Virtual Reassembly Buffer](https://tools.ietf.org/html/draft-ietf-lwig-6lowpan-virtual-reassembly-01)
+ *
+ * To activate, use `USEMODULE += gnrc_sixlowpan_frag_vrb` in your
+ * application's Makefile.
+ *
+ * Without this module, a router reassembles every fragmented datagram
+ * before it routes it, only to fragment it again for the next hop. With this
+ * module, the route of a datagram is determined from the first fragment. If
+ * the datagram is to be forwarded over a 6LoWPAN interface, the compressed
+ * header of the first fragment is rewritten for the next hop and an entry in
+ * the virtual reassembly buffer (VRB) is created. All subsequent fragments of
+ * the datagram are then forwarded immediately with the datagram tag chosen
+ * for the next hop.
+ *
+ * Datagrams that are addressed to this node, that need processing by the
+ * IPv6 layer (hop-by-hop options, routing headers, an expiring hop limit), or
+ * for which a first fragment can not be generated are still reassembled.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Virtual reassembly buffer definitions
+ */
+#ifndef NET_GNRC_SIXLOWPAN_FRAG_VRB_H
+#define NET_GNRC_SIXLOWPAN_FRAG_VRB_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "net/gnrc/netif.h"
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/gnrc/sixlowpan/frag.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   An entry in the virtual reassembly buffer
+ */
+typedef struct {
+    /**
+     * @brief   Identification of the incoming datagram
+     *
+     * gnrc_sixlowpan_rbuf_base_t::current_size counts the bytes of the
+     * datagram that were forwarded.
+     */
+    gnrc_sixlowpan_rbuf_base_t super;
+    gnrc_netif_t *out_netif;                        /**< outgoing interface */
+    uint8_t out_dst[IEEE802154_LONG_ADDRESS_LEN];   /**< link-layer address of
+                                                     *   the next hop */
+    uint8_t out_dst_len;                            /**< length of
+                                                     *   gnrc_sixlowpan_frag_vrb_t::out_dst */
+    uint16_t out_tag;                               /**< datagram tag towards
+                                                     *   the next hop */
+} gnrc_sixlowpan_frag_vrb_t;
+
+/**
+ * @brief   Adds a new entry to the virtual reassembly buffer
+ *
+ * A new outgoing datagram tag is generated for the entry.
+ *
+ * @param[in] base          Identification of the incoming datagram.
+ * @param[in] out_netif     The interface to forward the datagram over.
+ * @param[in] out_dst       Link-layer address of the next hop.
+ * @param[in] out_dst_len   Length of @p out_dst.
+ *
+ * @return  The new entry.
+ * @return  NULL, if the buffer is full or @p out_dst_len is too long.
+ */
+gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
+        const gnrc_sixlowpan_rbuf_base_t *base, gnrc_netif_t *out_netif,
+        const uint8_t *out_dst, size_t out_dst_len);
+
+/**
+ * @brief   Gets the entry for an incoming datagram
+ *
+ * @param[in] src           Link-layer source address of the fragment.
+ * @param[in] src_len       Length of @p src.
+ * @param[in] dst           Link-layer destination address of the fragment.
+ * @param[in] dst_len       Length of @p dst.
+ * @param[in] datagram_size Datagram size of the fragment.
+ * @param[in] tag           Datagram tag of the fragment.
+ *
+ * @return  The entry for the datagram.
+ * @return  NULL, if the datagram is not in the buffer.
+ */
+gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(
+        const uint8_t *src, size_t src_len, const uint8_t *dst, size_t dst_len,
+        size_t datagram_size, unsigned tag);
+
+/**
+ * @brief   Removes an entry from the virtual reassembly buffer
+ *
+ * @param[in] vrb   An entry of the virtual reassembly buffer.
+ */
+void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrb);
+
+/**
+ * @brief   Removes timed out entries from the virtual reassembly buffer
+ */
+void gnrc_sixlowpan_frag_vrb_gc(void);
+
+/**
+ * @brief   Forwards a fragment to the next hop of a datagram
+ *
+ * Replaces the datagram tag in the fragment header with
+ * gnrc_sixlowpan_frag_vrb_t::out_tag and sends the fragment to
+ * gnrc_sixlowpan_frag_vrb_t::out_dst.
+ * @p vrb is removed, once all bytes of the datagram were forwarded.
+ *
+ * @param[in] vrb   The entry for the datagram of @p frag.
+ * @param[in] frag  A fragment, starting with its (writable) fragment header,
+ *                  without a @ref gnrc_netif_hdr_t. Released in any case.
+ * @param[in] size  Number of bytes of the datagram @p frag covers
+ *                  (uncompressed).
+ *
+ * @return  0 on success.
+ * @return  -ENOMEM, if no @ref gnrc_netif_hdr_t could be allocated.
+ */
+int gnrc_sixlowpan_frag_vrb_send(gnrc_sixlowpan_frag_vrb_t *vrb,
+                                 gnrc_pktsnip_t *frag, size_t size);
+
+#if defined(TEST_SUITES) || defined(DOXYGEN)
+/**
+ * @brief   Resets the virtual reassembly buffer to a clean state
+ *
+ * @note    Only available when @ref TEST_SUITES is defined
+ */
+void gnrc_sixlowpan_frag_vrb_reset(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_SIXLOWPAN_FRAG_VRB_H */
+/** @} */
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_sixlowpan_iphc_cache IPHC compression cache
+ * @ingroup     net_gnrc_sixlowpan_iphc
+ * @brief       Memoizes the compressed headers of repeated flows
+ *
+ * To activate, use `USEMODULE += gnrc_sixlowpan_iphc_cache` in your
+ * application's Makefile.
+ *
+ * Compressing an IPv6 header with @ref net_gnrc_sixlowpan_iphc requires
+ * context lookups for both addresses and the interface identifiers of source
+ * and destination. For a flow, i.e. packets with the same IPv6 header fields
+ * (apart from the payload length), the same UDP ports and the same
+ * link-layer destination on the same interface, the result is always the
+ * same. With this module, the compressed header of a flow is kept in a small
+ * direct-mapped cache, so subsequent packets of that flow only copy it and
+ * patch in the UDP checksum.
+ *
+ * Entries are tagged with the generation counter
+ * @ref gnrc_sixlowpan_iphc_cache_gen. Whenever the context table or the
+ * link-layer address of an interface change, the counter is incremented with
+ * gnrc_sixlowpan_iphc_cache_invalidate(), which invalidates all entries at
+ * once. Additionally, an entry is only used if all contexts it was
+ * compressed with are still valid for compression, so contexts that expire
+ * do not need to invalidate the cache.
+ *
+ * @{
+ *
+ * @file
+ * @brief   IPHC compression cache definitions
+ */
+#ifndef NET_GNRC_SIXLOWPAN_IPHC_CACHE_H
+#define NET_GNRC_SIXLOWPAN_IPHC_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    net_gnrc_sixlowpan_iphc_cache_conf GNRC IPHC compression
+ *                                                 cache compile
+ *                                                 configurations
+ * @ingroup     net_gnrc_sixlowpan_iphc_cache
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Number of entries in the compression cache
+ */
+#ifndef GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+#define GNRC_SIXLOWPAN_IPHC_CACHE_SIZE  (4U)
+#endif
+/** @} */
+
+/**
+ * @brief   Generation counter of the compression cache
+ *
+ * Entries of the cache are only valid as long as the counter has the value
+ * it had when they were compressed.
+ */
+extern unsigned gnrc_sixlowpan_iphc_cache_gen;
+
+/**
+ * @brief   Invalidates all entries of the compression cache
+ *
+ * Must be called whenever the 6LoWPAN context table or the link-layer
+ * address of an interface change. Without module `gnrc_sixlowpan_iphc_cache`
+ * this does nothing.
+ */
+static inline void gnrc_sixlowpan_iphc_cache_invalidate(void)
+{
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+    gnrc_sixlowpan_iphc_cache_gen++;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_SIXLOWPAN_IPHC_CACHE_H */
+/** @} */
@@ -121,7 +121,12 @@ int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, uint8_t address_family,
  * @pre @p tcb must not be NULL.
  * @pre @p data must not be NULL.
  *
- * @note Blocks until up to @p len bytes were transmitted or an error occured.
+ * @note Blocks until up to @p len bytes were handed to the network stack or an error
+ *       occured. The data is not necessarily acknowledged by the peer yet: Up to
+ *       GNRC_TCP_RTX_QUEUE_SIZE - 1 segments are kept in flight and retransmitted
+ *       if necessary. If a segment stays unacknowledged for
+ *       GNRC_TCP_CONNECTION_TIMEOUT_DURATION after its first retransmission, the
+ *       connection is aborted and the next call to gnrc_tcp_send() or gnrc_tcp_recv() returns -ECONNABORTED.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
@@ -189,6 +194,55 @@ void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb);
  */
 void gnrc_tcp_abort(gnrc_tcp_tcb_t *tcb);
 
+#if defined(MODULE_GNRC_TCP_EVENT) || defined(DOXYGEN)
+/**
+ * @name Connection events, passed to @ref gnrc_tcp_event_cb_t
+ *
+ * Events are level triggered: Each callback reports the current state of the
+ * connection, except for GNRC_TCP_EVENT_CONNECTED, which is reported once per
+ * connection.
+ * @{
+ */
+#define GNRC_TCP_EVENT_CONNECTED (0x01) /**< Connection was established */
+#define GNRC_TCP_EVENT_READABLE  (0x02) /**< Received data can be read */
+#define GNRC_TCP_EVENT_WRITABLE  (0x04) /**< Data can be sent */
+#define GNRC_TCP_EVENT_CLOSED    (0x08) /**< Peer closed or connection was terminated */
+/** @} */
+
+/**
+ * @brief Binds a TCB to an event queue and switches it to non-blocking mode.
+ *
+ * Requires module `gnrc_tcp_event`. The callback @p cb is executed by the
+ * thread handling @p queue whenever the connection changes, so a single
+ * thread can serve many connections. In non-blocking mode
+ * - gnrc_tcp_open_active() and gnrc_tcp_open_passive() return -EINPROGRESS
+ *   once the connection attempt was started. GNRC_TCP_EVENT_CONNECTED or
+ *   GNRC_TCP_EVENT_CLOSED follow.
+ * - gnrc_tcp_send() returns -EAGAIN instead of blocking, if the window
+ *   does not allow to send anything. GNRC_TCP_EVENT_WRITABLE follows, once
+ *   data can be sent.
+ * - gnrc_tcp_recv() ignores its timeout and returns -EAGAIN, if there is no
+ *   data. GNRC_TCP_EVENT_READABLE follows, once data was received.
+ * - gnrc_tcp_close() returns after the connection teardown was started.
+ *   GNRC_TCP_EVENT_CLOSED follows.
+ *
+ * Handshakes and unacknowledged data time out after
+ * GNRC_TCP_CONNECTION_TIMEOUT_DURATION, as in blocking mode.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be in use by a connection.
+ * @pre @p tcb must not be NULL.
+ *
+ * @param[in,out] tcb     TCB to bind.
+ * @param[in]     queue   Event queue to execute @p cb in. NULL switches @p tcb
+ *                        back to blocking mode.
+ * @param[in]     cb      Callback for connection events.
+ * @param[in]     arg     Argument for @p cb.
+ */
+void gnrc_tcp_event_init(gnrc_tcp_tcb_t *tcb, event_queue_t *queue, gnrc_tcp_event_cb_t cb,
+                         void *arg);
+#endif
+
 /**
  * @brief Calculate and set checksum in TCP header.
  *
@@ -30,6 +30,9 @@ extern "C" {
 
 /**
  * @brief Timeout duration for user calls. Default is 2 minutes.
+ *
+ * A connection is aborted as well if a segment was not acknowledged for this
+ * long after its first retransmission.
  */
 #ifndef GNRC_TCP_CONNECTION_TIMEOUT_DURATION
 #define GNRC_TCP_CONNECTION_TIMEOUT_DURATION (120U * US_PER_SEC)
@@ -55,6 +58,10 @@ extern "C" {
 
 /**
  * @brief MSS Multiplicator = Number of MSS sized packets stored in receive buffer
+ *
+ * The receive window grows accordingly, so with values greater than one the
+ * peer can have several segments in flight. The resulting window must not
+ * exceed 65535 bytes.
  */
 #ifndef GNRC_TCP_MSS_MULTIPLICATOR
 #define GNRC_TCP_MSS_MULTIPLICATOR (1U)
@@ -81,6 +88,27 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Number of segments a connection keeps for retransmission
+ *
+ * This limits the number of unacknowledged segments in flight. One entry is
+ * reserved for the FIN, so up to GNRC_TCP_RTX_QUEUE_SIZE - 1 data segments
+ * are sent without waiting for an acknowledgement. Must be between 2 and 8.
+ * With fewer than four segments in flight, a fast retransmit is triggered
+ * by one duplicate ACK less than there are segments in flight.
+ */
+#ifndef GNRC_TCP_RTX_QUEUE_SIZE
+#define GNRC_TCP_RTX_QUEUE_SIZE (4U)
+#endif
+
+/**
+ * @brief Number of out-of-order blocks kept in the receive buffer and
+ *        reported with the SACK option (RFC 2018). Must be between 1 and 4.
+ */
+#ifndef GNRC_TCP_SACK_BLOCKS
+#define GNRC_TCP_SACK_BLOCKS (3U)
+#endif
+
 /**
  * @brief Lower bound for RTO = 1 sec (see RFC 6298)
  */
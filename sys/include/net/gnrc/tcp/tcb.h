@@ -36,6 +36,10 @@
 #include "net/gnrc/ipv6.h"
 #endif
 
+#ifdef MODULE_GNRC_TCP_EVENT
+#include "event.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -45,6 +49,20 @@ extern "C" {
  */
 #define GNRC_TCP_TCB_MBOX_SIZE (8U)
 
+#if defined(MODULE_GNRC_TCP_EVENT) || defined(DOXYGEN)
+struct _transmission_control_block;
+
+/**
+ * @brief Callback for connection events, see gnrc_tcp_event_init()
+ *
+ * @param[in] tcb      TCB the events occurred on.
+ * @param[in] events   Bitmap of GNRC_TCP_EVENT_* flags.
+ * @param[in] arg      Argument given to gnrc_tcp_event_init().
+ */
+typedef void (*gnrc_tcp_event_cb_t)(struct _transmission_control_block *tcb, unsigned events,
+                                    void *arg);
+#endif
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -70,19 +88,44 @@ typedef struct _transmission_control_block {
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
     uint32_t rtt_start;    /**< Timer value for rtt estimation */
+    uint32_t rtt_seq;      /**< Sequence number that ends the current rtt measurement */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
     uint8_t retries;       /**< Number of retransmissions */
+    uint32_t rtx_start;    /**< Time of the first retransmission timeout of the oldest segment */
+    uint8_t dup_acks;      /**< Number of consecutive duplicate ACKs */
+    uint32_t cwnd;         /**< Congestion window */
+    uint32_t ssthresh;     /**< Slow start threshold */
+    uint32_t recover;      /**< Value of snd_nxt when fast recovery was entered */
+#ifdef MODULE_GNRC_TCP_CUBIC
+    uint32_t w_max;        /**< CUBIC: Congestion window before the last reduction */
+    uint32_t epoch_start;  /**< CUBIC: Start of the current epoch in milliseconds */
+    uint32_t k;            /**< CUBIC: Time to grow back to w_max in milliseconds */
+#endif
     xtimer_t tim_tout;     /**< Timer struct for timeouts */
     msg_t msg_tout;        /**< Message, sent on timeouts */
-    gnrc_pktsnip_t *pkt_retransmit;   /**< Pointer to packet in "retransmit queue" */
+    gnrc_pktsnip_t *rtx_queue[GNRC_TCP_RTX_QUEUE_SIZE];  /**< Retransmit queue, oldest first */
+    uint8_t rtx_len;       /**< Number of packets in the retransmit queue */
+    uint8_t rtx_sacked;    /**< Bitmap of packets in the retransmit queue SACKed by the peer */
+    uint32_t sack[GNRC_TCP_SACK_BLOCKS][2];  /**< Out-of-order blocks received, most recent first */
+    uint8_t sack_len;      /**< Number of out-of-order blocks received */
     msg_t mbox_raw[GNRC_TCP_TCB_MBOX_SIZE];   /**< Msg queue for mbox */
     mbox_t mbox;             /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
+#if defined(MODULE_GNRC_TCP_EVENT) || defined(DOXYGEN)
+    event_queue_t *evq;      /**< Event queue the callback is executed in, NULL if blocking */
+    event_t event;           /**< Event posted to evq on state changes */
+    gnrc_tcp_event_cb_t event_cb;  /**< Callback for connection events */
+    void *event_arg;         /**< Argument for event_cb */
+    uint8_t event_state;     /**< Internal state of event handling */
+    xtimer_t tim_event;      /**< Timer for connection timeouts and probes */
+    msg_t msg_event;         /**< Message, sent when tim_event expires */
+    uint32_t event_deadline; /**< Time in microseconds at which tim_event expires */
+#endif
     struct _transmission_control_block *next;   /**< Pointer next TCB */
 } gnrc_tcp_tcb_t;
 
@@ -23,6 +23,8 @@
 #include <inttypes.h>
 #include <stddef.h>
 
+#include "iolist.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -49,6 +51,36 @@ extern "C" {
  */
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len);
 
+/**
+ * @brief   Calculates the unnormalized Internet Checksum over the buffers of
+ *          an I/O list in one pass
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc1071">
+ *          RFC 1071
+ *      </a>
+ *
+ * @details The Internet Checksum is not normalized (i. e. its 1's complement
+ *          was not taken of the result) to use it for further calculation.
+ *          Like inet_csum_slice(), this function handles padding an odd number
+ *          of bytes across the full domain, also between the entries of
+ *          @p iolist.
+ *
+ *          Since the first fields of @ref gnrc_pktsnip_t match @ref iolist_t
+ *          a packet snip list can be casted and passed as @p iolist.
+ *
+ * @param[in] sum           An initial value for the checksum.
+ * @param[in] iolist        An I/O list.
+ * @param[in] end           Entry of @p iolist to stop at (exclusive). May be
+ *                          NULL to sum up the whole list.
+ * @param[in,out] accum_len In: accumulated length of checksum domain that has
+ *                          already been checksummed. Out: @p accum_len plus
+ *                          the number of bytes summed up.
+ *
+ * @return  The unnormalized Internet Checksum of the buffers in @p iolist.
+ */
+uint16_t inet_csum_iolist(uint16_t sum, const iolist_t *iolist,
+                          const iolist_t *end, size_t *accum_len);
+
 /**
  * @brief   Calculates the unnormalized Internet Checksum of @p buf, where the
  *          buffer provides a standalone domain for the checksum.
@@ -73,6 +105,57 @@ static inline uint16_t inet_csum(uint16_t sum, const uint8_t *buf, uint16_t len)
     return inet_csum_slice(sum, buf, len, 0);
 }
 
+/**
+ * @brief   Updates a checksum field after a 16-bit word of its domain changed
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc1624#section-3">
+ *          RFC 1624, section 3
+ *      </a>
+ *
+ * @details Computes HC' = ~(~HC + ~m + m'), so the checksum does not need to
+ *          be recalculated over the whole domain.
+ *
+ * @param[in] csum      The checksum field (i.e. the normalized checksum) in
+ *                      host byte order.
+ * @param[in] old_val   The old value of the 16-bit word in host byte order.
+ * @param[in] new_val   The new value of the 16-bit word in host byte order.
+ *
+ * @return  The updated checksum field in host byte order.
+ */
+static inline uint16_t inet_csum_update16(uint16_t csum, uint16_t old_val,
+                                          uint16_t new_val)
+{
+    uint32_t sum = (uint32_t)((uint16_t)~csum) + (uint16_t)~old_val + new_val;
+
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+    return (uint16_t)~sum;
+}
+
+/**
+ * @brief   Updates a checksum field after a part of its domain changed
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc1624#section-3">
+ *          RFC 1624, section 3
+ *      </a>
+ *
+ * @details Same as inet_csum_update16(), but for a buffer of @p len bytes,
+ *          e.g. an address in a pseudo-header. Only the changed bytes are
+ *          summed up.
+ *
+ * @pre The changed part starts at an even offset within the checksum domain.
+ *
+ * @param[in] csum      The checksum field (i.e. the normalized checksum) in
+ *                      host byte order.
+ * @param[in] old_buf   The old content of the changed part.
+ * @param[in] new_buf   The new content of the changed part.
+ * @param[in] len       Length of the changed part in byte.
+ *
+ * @return  The updated checksum field in host byte order.
+ */
+uint16_t inet_csum_update(uint16_t csum, const uint8_t *old_buf,
+                          const uint8_t *new_buf, uint16_t len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,280 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_sixlowpan_sfr   6LoWPAN selective fragment recovery
+ * @ingroup     net_sixlowpan
+ * @brief       Header types and helper functions for 6LoWPAN selective
+ *              fragment recovery
+ * @see         [RFC 8931](https://tools.ietf.org/html/rfc8931)
+ * @{
+ *
+ * @file
+ * @brief   Header type and helper function definitions for 6LoWPAN selective
+ *          fragment recovery
+ */
+#ifndef NET_SIXLOWPAN_SFR_H
+#define NET_SIXLOWPAN_SFR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "byteorder.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name    Dispatch definitions
+ * @see     [RFC 8931, section 5](https://tools.ietf.org/html/rfc8931#section-5)
+ * @{
+ */
+#define SIXLOWPAN_SFR_DISP_MASK         (0xfe)  /**< mask for SFR dispatches */
+#define SIXLOWPAN_SFR_RFRAG_DISP        (0xe8)  /**< dispatch for RFRAG */
+#define SIXLOWPAN_SFR_ACK_DISP          (0xea)  /**< dispatch for RFRAG-ACK */
+#define SIXLOWPAN_SFR_ECN               (0x01)  /**< explicit congestion
+                                                 *   notification flag */
+/** @} */
+
+/**
+ * @name    RFRAG field definitions
+ * @{
+ */
+#define SIXLOWPAN_SFR_ACK_REQ           (0x8000)    /**< acknowledgment request
+                                                     *   flag */
+#define SIXLOWPAN_SFR_SEQ_MASK          (0x7c00)    /**< mask for sequence */
+#define SIXLOWPAN_SFR_SEQ_POS           (10U)       /**< position of sequence */
+#define SIXLOWPAN_SFR_SEQ_MAX           (0x1fU)     /**< maximum sequence */
+#define SIXLOWPAN_SFR_FRAG_SIZE_MASK    (0x03ff)    /**< mask for fragment
+                                                     *   size */
+#define SIXLOWPAN_SFR_FRAG_SIZE_MAX     (0x03ffU)   /**< maximum fragment
+                                                     *   size */
+/** @} */
+
+/**
+ * @brief   Number of fragments a RFRAG-ACK bitmap can acknowledge
+ */
+#define SIXLOWPAN_SFR_ACK_BITMAP_SIZE   (32U)
+
+/**
+ * @brief   Generic type for selective fragment recovery headers
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t disp_ecn;   /**< dispatch and ECN flag */
+    uint8_t tag;        /**< datagram tag */
+} sixlowpan_sfr_t;
+
+/**
+ * @brief   Recoverable fragment header
+ *
+ * @see     [RFC 8931, section 5.1](https://tools.ietf.org/html/rfc8931#section-5.1)
+ *
+ * @extends sixlowpan_sfr_t
+ */
+typedef struct __attribute__((packed)) {
+    sixlowpan_sfr_t base;       /**< generic SFR header */
+    /**
+     * @brief   Acknowledgment request flag, sequence and fragment size
+     *
+     * @details The most significant bit is the acknowledgment request flag,
+     *          the next 5 bits the sequence, the remaining 10 bits the size
+     *          of the fragment's payload.
+     */
+    network_uint16_t ar_seq_fs;
+    /**
+     * @brief   Fragment offset
+     *
+     * @details The (uncompressed) size of the datagram for the first
+     *          fragment (sequence 0), the offset of the fragment's payload in
+     *          the datagram for all others.
+     */
+    network_uint16_t offset;
+} sixlowpan_sfr_rfrag_t;
+
+/**
+ * @brief   Recoverable fragment acknowledgment header
+ *
+ * @see     [RFC 8931, section 5.2](https://tools.ietf.org/html/rfc8931#section-5.2)
+ *
+ * @extends sixlowpan_sfr_t
+ */
+typedef struct __attribute__((packed)) {
+    sixlowpan_sfr_t base;       /**< generic SFR header */
+    /**
+     * @brief   Bitmap of received fragments
+     *
+     * @details The most significant bit represents the fragment with sequence
+     *          0. A bitmap of all zeros aborts the datagram.
+     */
+    network_uint32_t bitmap;
+} sixlowpan_sfr_ack_t;
+
+/**
+ * @brief   Checks if a header is a selective fragment recovery header
+ *
+ * @param[in] hdr   A 6LoWPAN header.
+ *
+ * @return  true, if @p hdr is either a RFRAG or a RFRAG-ACK header.
+ * @return  false, otherwise.
+ */
+static inline bool sixlowpan_sfr_is(const sixlowpan_sfr_t *hdr)
+{
+    return ((hdr->disp_ecn & SIXLOWPAN_SFR_DISP_MASK) ==
+            SIXLOWPAN_SFR_RFRAG_DISP) ||
+           ((hdr->disp_ecn & SIXLOWPAN_SFR_DISP_MASK) ==
+            SIXLOWPAN_SFR_ACK_DISP);
+}
+
+/**
+ * @brief   Checks if a header is a RFRAG header
+ *
+ * @param[in] hdr   A 6LoWPAN header.
+ *
+ * @return  true, if @p hdr is a RFRAG header.
+ * @return  false, otherwise.
+ */
+static inline bool sixlowpan_sfr_rfrag_is(const sixlowpan_sfr_t *hdr)
+{
+    return ((hdr->disp_ecn & SIXLOWPAN_SFR_DISP_MASK) ==
+            SIXLOWPAN_SFR_RFRAG_DISP);
+}
+
+/**
+ * @brief   Checks if a header is a RFRAG-ACK header
+ *
+ * @param[in] hdr   A 6LoWPAN header.
+ *
+ * @return  true, if @p hdr is a RFRAG-ACK header.
+ * @return  false, otherwise.
+ */
+static inline bool sixlowpan_sfr_ack_is(const sixlowpan_sfr_t *hdr)
+{
+    return ((hdr->disp_ecn & SIXLOWPAN_SFR_DISP_MASK) ==
+            SIXLOWPAN_SFR_ACK_DISP);
+}
+
+/**
+ * @brief   Initializes a RFRAG header
+ *
+ * @param[out] hdr      The header to initialize.
+ * @param[in] tag       Datagram tag.
+ * @param[in] seq       Sequence of the fragment. Must be lesser or equal to
+ *                      @ref SIXLOWPAN_SFR_SEQ_MAX.
+ * @param[in] frag_size Size of the fragment's payload. Must be lesser or
+ *                      equal to @ref SIXLOWPAN_SFR_FRAG_SIZE_MAX.
+ * @param[in] offset    Fragment offset (datagram size for @p seq 0).
+ */
+static inline void sixlowpan_sfr_rfrag_init(sixlowpan_sfr_rfrag_t *hdr,
+                                            uint8_t tag, unsigned seq,
+                                            unsigned frag_size,
+                                            uint16_t offset)
+{
+    hdr->base.disp_ecn = SIXLOWPAN_SFR_RFRAG_DISP;
+    hdr->base.tag = tag;
+    hdr->ar_seq_fs = byteorder_htons(
+            ((seq << SIXLOWPAN_SFR_SEQ_POS) & SIXLOWPAN_SFR_SEQ_MASK) |
+            (frag_size & SIXLOWPAN_SFR_FRAG_SIZE_MASK)
+        );
+    hdr->offset = byteorder_htons(offset);
+}
+
+/**
+ * @brief   Sets the acknowledgment request flag of a RFRAG header
+ *
+ * @param[in,out] hdr   A RFRAG header.
+ */
+static inline void sixlowpan_sfr_rfrag_set_ack_req(sixlowpan_sfr_rfrag_t *hdr)
+{
+    hdr->ar_seq_fs.u8[0] |= (SIXLOWPAN_SFR_ACK_REQ >> 8);
+}
+
+/**
+ * @brief   Checks if a RFRAG header requests an acknowledgment
+ *
+ * @param[in] hdr   A RFRAG header.
+ *
+ * @return  true, if the acknowledgment request flag is set.
+ * @return  false, otherwise.
+ */
+static inline bool sixlowpan_sfr_rfrag_ack_req(const sixlowpan_sfr_rfrag_t *hdr)
+{
+    return (hdr->ar_seq_fs.u8[0] & (SIXLOWPAN_SFR_ACK_REQ >> 8));
+}
+
+/**
+ * @brief   Gets the sequence of a RFRAG header
+ *
+ * @param[in] hdr   A RFRAG header.
+ *
+ * @return  The sequence of the fragment.
+ */
+static inline unsigned sixlowpan_sfr_rfrag_get_seq(const sixlowpan_sfr_rfrag_t *hdr)
+{
+    return (byteorder_ntohs(hdr->ar_seq_fs) & SIXLOWPAN_SFR_SEQ_MASK) >>
+           SIXLOWPAN_SFR_SEQ_POS;
+}
+
+/**
+ * @brief   Gets the fragment size of a RFRAG header
+ *
+ * @param[in] hdr   A RFRAG header.
+ *
+ * @return  The size of the fragment's payload.
+ */
+static inline unsigned sixlowpan_sfr_rfrag_get_frag_size(const sixlowpan_sfr_rfrag_t *hdr)
+{
+    return byteorder_ntohs(hdr->ar_seq_fs) & SIXLOWPAN_SFR_FRAG_SIZE_MASK;
+}
+
+/**
+ * @brief   Gets the fragment offset of a RFRAG header
+ *
+ * @param[in] hdr   A RFRAG header.
+ *
+ * @return  The fragment offset (datagram size for sequence 0).
+ */
+static inline uint16_t sixlowpan_sfr_rfrag_get_offset(const sixlowpan_sfr_rfrag_t *hdr)
+{
+    return byteorder_ntohs(hdr->offset);
+}
+
+/**
+ * @brief   Initializes a RFRAG-ACK header
+ *
+ * @param[out] hdr      The header to initialize.
+ * @param[in] tag       Datagram tag.
+ * @param[in] bitmap    Bitmap of received fragments.
+ */
+static inline void sixlowpan_sfr_ack_init(sixlowpan_sfr_ack_t *hdr,
+                                          uint8_t tag, uint32_t bitmap)
+{
+    hdr->base.disp_ecn = SIXLOWPAN_SFR_ACK_DISP;
+    hdr->base.tag = tag;
+    hdr->bitmap = byteorder_htonl(bitmap);
+}
+
+/**
+ * @brief   Gets the bit that represents a fragment in a RFRAG-ACK bitmap
+ *
+ * @param[in] seq   Sequence of the fragment. Must be lesser or equal to
+ *                  @ref SIXLOWPAN_SFR_SEQ_MAX.
+ *
+ * @return  The bit for @p seq in host byte order.
+ */
+static inline uint32_t sixlowpan_sfr_ack_bit(unsigned seq)
+{
+    return 0x80000000UL >> seq;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_SIXLOWPAN_SFR_H */
+/** @} */
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_sock_async  Asynchronous sock
+ * @ingroup     net_sock
+ * @brief       Callback-based notification of sock events
+ *
+ * To activate, use `USEMODULE += sock_async` in your application's Makefile.
+ * The network stack must provide an implementation (currently only
+ * @ref net_gnrc_sock).
+ *
+ * Callbacks are called from the context of the network stack (usually the
+ * thread of the transport layer), so they must not block and should only
+ * notify the application, e.g. by setting a thread flag. The data itself is
+ * still fetched with the usual receive functions, e.g. with a timeout of 0.
+ * To have the callbacks called in a thread of your choice, use
+ * @ref net_sock_async_event.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Asynchronous sock definitions
+ */
+#ifndef NET_SOCK_ASYNC_H
+#define NET_SOCK_ASYNC_H
+
+#include "net/sock/async/types.h"
+
+#if defined(MODULE_SOCK_IP) || defined(DOXYGEN)
+#include "net/sock/ip.h"
+#endif
+#if defined(MODULE_SOCK_UDP) || defined(DOXYGEN)
+#include "net/sock/udp.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(MODULE_SOCK_IP) || defined(DOXYGEN)
+/**
+ * @brief   Sets the event callback for a raw IPv4/IPv6 sock
+ *
+ * @pre `(sock != NULL)`
+ *
+ * @param[in] sock      A raw IPv4/IPv6 sock object.
+ * @param[in] cb        An event callback. May be NULL to unset the callback.
+ * @param[in] cb_arg    Argument handed to @p cb.
+ */
+void sock_ip_set_cb(sock_ip_t *sock, sock_ip_cb_t cb, void *cb_arg);
+
+#if defined(MODULE_SOCK_ASYNC_EVENT) || defined(DOXYGEN)
+/**
+ * @brief   Gets the asynchronous context of a raw IPv4/IPv6 sock
+ *
+ * @note    Only provided with module `sock_async_event`, for use by
+ *          @ref net_sock_async_event.
+ *
+ * @pre `(sock != NULL)`
+ *
+ * @param[in] sock  A raw IPv4/IPv6 sock object.
+ *
+ * @return  The asynchronous context of @p sock.
+ */
+sock_async_ctx_t *sock_ip_get_async_ctx(sock_ip_t *sock);
+#endif
+#endif
+
+#if defined(MODULE_SOCK_UDP) || defined(DOXYGEN)
+/**
+ * @brief   Sets the event callback for a UDP sock
+ *
+ * @pre `(sock != NULL)`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in] cb        An event callback. May be NULL to unset the callback.
+ * @param[in] cb_arg    Argument handed to @p cb.
+ */
+void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *cb_arg);
+
+#if defined(MODULE_SOCK_ASYNC_EVENT) || defined(DOXYGEN)
+/**
+ * @brief   Gets the asynchronous context of a UDP sock
+ *
+ * @note    Only provided with module `sock_async_event`, for use by
+ *          @ref net_sock_async_event.
+ *
+ * @pre `(sock != NULL)`
+ *
+ * @param[in] sock  A UDP sock object.
+ *
+ * @return  The asynchronous context of @p sock.
+ */
+sock_async_ctx_t *sock_udp_get_async_ctx(sock_udp_t *sock);
+#endif
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_SOCK_ASYNC_H */
+/** @} */
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  net_sock_async
+ * @{
+ *
+ * @file
+ * @brief   Type definitions for asynchronous sock
+ *
+ * Kept separate from @ref net/sock/async.h so stack-specific `sock_types.h`
+ * can include it without pulling in the sock API headers.
+ */
+#ifndef NET_SOCK_ASYNC_TYPES_H
+#define NET_SOCK_ASYNC_TYPES_H
+
+#if defined(MODULE_SOCK_ASYNC_EVENT) || defined(DOXYGEN)
+#include "event.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct sock_ip;     /* forward declaration */
+struct sock_udp;    /* forward declaration */
+
+/**
+ * @brief   Flag types to signify asynchronous sock events
+ *
+ * Several events may be reported with one call, so the flags have to be
+ * checked bitwise.
+ */
+typedef enum {
+    SOCK_ASYNC_MSG_RECV = 0x0010,   /**< Message received event */
+    SOCK_ASYNC_MSG_SENT = 0x0020,   /**< Message sent event */
+    SOCK_ASYNC_ERR      = 0x0040,   /**< Received message was dropped */
+} sock_async_flags_t;
+
+/**
+ * @brief   Event callback for @ref sock_ip_t
+ *
+ * @param[in] sock  The sock the event happened on
+ * @param[in] flags The event flags
+ * @param[in] arg   Argument given to sock_ip_set_cb()
+ */
+typedef void (*sock_ip_cb_t)(struct sock_ip *sock, sock_async_flags_t flags,
+                             void *arg);
+
+/**
+ * @brief   Event callback for @ref sock_udp_t
+ *
+ * @param[in] sock  The sock the event happened on
+ * @param[in] flags The event flags
+ * @param[in] arg   Argument given to sock_udp_set_cb()
+ */
+typedef void (*sock_udp_cb_t)(struct sock_udp *sock, sock_async_flags_t flags,
+                              void *arg);
+
+/**
+ * @brief   Storage for an event callback of any sock type
+ */
+typedef union {
+    /**
+     * @brief   Generic version, the sock is handed as `void *`
+     */
+    void (*generic)(void *sock, sock_async_flags_t flags, void *arg);
+    sock_ip_cb_t ip;                    /**< raw IP version */
+    sock_udp_cb_t udp;                  /**< UDP version */
+} sock_async_cb_t;
+
+#if defined(MODULE_SOCK_ASYNC_EVENT) || defined(DOXYGEN)
+/**
+ * @brief   Event of @ref net_sock_async_event
+ */
+typedef struct {
+    event_t super;                      /**< event structure that gets extended */
+    void *sock;                         /**< the sock the event is for */
+    sock_async_cb_t cb;                 /**< handler of the event */
+    void *cb_arg;                       /**< argument for sock_event_t::cb */
+    unsigned type;                      /**< flags of the pending events */
+} sock_event_t;
+
+/**
+ * @brief   Asynchronous context of a sock
+ *
+ * Stacks keep one of these in their sock types, see e.g.
+ * sock_udp_get_async_ctx().
+ */
+typedef struct {
+    sock_event_t event;                 /**< event posted to the queue */
+    event_queue_t *queue;               /**< queue the sock is bound to */
+} sock_async_ctx_t;
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_SOCK_ASYNC_TYPES_H */
+/** @} */
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_sock_async_event    Asynchronous sock with event API
+ * @ingroup     net_sock_async
+ * @brief       Binds socks to an @ref sys_event queue
+ *
+ * To activate, use `USEMODULE += sock_async_event` in your application's
+ * Makefile.
+ *
+ * With this module the callbacks of @ref net_sock_async are not called from
+ * the context of the network stack but from the thread handling the event
+ * queue the sock is bound to. This way, several protocols can share a single
+ * thread, e.g. one running event_loop():
+ *
+ * @code{.c}
+ * #include "event.h"
+ * #include "net/sock/udp.h"
+ * #include "net/sock/async_event.h"
+ *
+ * static event_queue_t _queue;
+ * static sock_udp_t _sock;
+ * static uint8_t _buf[128];
+ *
+ * static void _handler(sock_udp_t *sock, sock_async_flags_t flags, void *arg)
+ * {
+ *     (void)arg;
+ *     if (flags & SOCK_ASYNC_MSG_RECV) {
+ *         sock_udp_ep_t remote;
+ *         ssize_t res;
+ *
+ *         while ((res = sock_udp_recv(sock, _buf, sizeof(_buf), 0,
+ *                                     &remote)) >= 0) {
+ *             sock_udp_send(sock, _buf, res, &remote);
+ *         }
+ *     }
+ * }
+ *
+ * int main(void)
+ * {
+ *     sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+ *
+ *     local.port = 12345;
+ *     event_queue_init(&_queue);
+ *     if (sock_udp_create(&_sock, &local, NULL, 0) < 0) {
+ *         return 1;
+ *     }
+ *     sock_udp_event_init(&_sock, &_queue, _handler, NULL);
+ *     event_loop(&_queue);
+ *     return 0;
+ * }
+ * @endcode
+ *
+ * Events that happen before the handler ran are coalesced, so one call of
+ * the handler may report several received messages. The handler should
+ * therefore receive until the sock returns `-EAGAIN`.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Asynchronous sock using @ref sys_event definitions
+ */
+#ifndef NET_SOCK_ASYNC_EVENT_H
+#define NET_SOCK_ASYNC_EVENT_H
+
+#include "event.h"
+#include "net/sock/async.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(MODULE_SOCK_IP) || defined(DOXYGEN)
+/**
+ * @brief   Makes a raw IPv4/IPv6 sock able to handle asynchronous events
+ *          using @ref sys_event
+ *
+ * @pre `(sock != NULL) && (ev_queue != NULL) && (handler != NULL)`
+ *
+ * @param[in] sock          A raw IPv4/IPv6 sock object.
+ * @param[in] ev_queue      The queue the events on @p sock will be added to.
+ * @param[in] handler       The event handler function to call on an event
+ *                          on @p sock.
+ * @param[in] handler_arg   Argument provided to @p handler.
+ */
+void sock_ip_event_init(sock_ip_t *sock, event_queue_t *ev_queue,
+                        sock_ip_cb_t handler, void *handler_arg);
+#endif
+
+#if defined(MODULE_SOCK_UDP) || defined(DOXYGEN)
+/**
+ * @brief   Makes a UDP sock able to handle asynchronous events using
+ *          @ref sys_event
+ *
+ * @pre `(sock != NULL) && (ev_queue != NULL) && (handler != NULL)`
+ *
+ * @param[in] sock          A UDP sock object.
+ * @param[in] ev_queue      The queue the events on @p sock will be added to.
+ * @param[in] handler       The event handler function to call on an event
+ *                          on @p sock.
+ * @param[in] handler_arg   Argument provided to @p handler.
+ */
+void sock_udp_event_init(sock_udp_t *sock, event_queue_t *ev_queue,
+                         sock_udp_cb_t handler, void *handler_arg);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_SOCK_ASYNC_EVENT_H */
+/** @} */
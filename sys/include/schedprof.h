@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_schedprof Scheduler profiling
+ * @ingroup     sys
+ * @brief       Per-thread CPU accounting and scheduling latency histograms
+ *
+ * This module hooks into the scheduler and records for every thread
+ *
+ * - the accumulated run time,
+ * - the number of times it was scheduled,
+ * - the number of times it was switched out while still runnable
+ *   (preempted or yielded),
+ * - a log2 histogram of the length of each run,
+ * - a log2 histogram of the wait-to-run latency, i.e. the time between a
+ *   thread becoming runnable and actually being scheduled.
+ *
+ * Time is taken from the DWT cycle counter on Cortex-M CPUs that have one and
+ * from xtimer everywhere else, see @ref SCHEDPROF_CLOCK_HZ. Bucket `i` of a
+ * histogram counts all samples `v` with `2^i <= v < 2^(i + 1)` clock ticks,
+ * bucket 0 also counts samples of 0 ticks and the last bucket collects
+ * everything that does not fit into the others. Buckets saturate at
+ * `UINT16_MAX`.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Scheduler profiling interface
+ */
+#ifndef SCHEDPROF_H
+#define SCHEDPROF_H
+
+#include <stdint.h>
+
+#include "cpu.h"
+#include "kernel_types.h"
+#include "periph_conf.h"
+#include "thread.h"
+
+#if !defined(DWT_CTRL_CYCCNTENA_Msk) || defined(DOXYGEN)
+#include "xtimer.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of buckets per histogram
+ */
+#ifndef SCHEDPROF_HIST_NUMOF
+#define SCHEDPROF_HIST_NUMOF    (24U)
+#endif
+
+#if defined(DWT_CTRL_CYCCNTENA_Msk) && !defined(DOXYGEN)
+#define SCHEDPROF_CLOCK_HZ      (CLOCK_CORECLOCK)
+#else
+/**
+ * @brief   Frequency of the clock used for profiling
+ */
+#define SCHEDPROF_CLOCK_HZ      (XTIMER_HZ)
+#endif
+
+/**
+ * @brief   Profiling data of a single thread
+ */
+typedef struct {
+    uint64_t runtime;           /**< accumulated run time in clock ticks */
+    uint32_t last_start;        /**< time stamp of the last schedule */
+    uint32_t ready_since;       /**< time stamp the thread became runnable */
+    uint32_t switches;          /**< how often the thread was scheduled */
+    uint32_t preemptions;       /**< how often the thread was switched out
+                                     while still runnable */
+    uint32_t run_max;           /**< longest run in clock ticks */
+    uint32_t wait_max;          /**< longest wait-to-run latency in clock
+                                     ticks */
+    uint16_t run_hist[SCHEDPROF_HIST_NUMOF];    /**< run length histogram */
+    uint16_t wait_hist[SCHEDPROF_HIST_NUMOF];   /**< wait-to-run latency
+                                                     histogram */
+} schedprof_t;
+
+/**
+ * @brief   Profiling data of all threads, indexed by PID
+ */
+extern schedprof_t schedprof_threads[KERNEL_PID_LAST + 1];
+
+/**
+ * @brief   Get the current value of the profiling clock
+ *
+ * @return  current clock value in ticks of @ref SCHEDPROF_CLOCK_HZ
+ */
+static inline uint32_t schedprof_now(void)
+{
+#if defined(DWT_CTRL_CYCCNTENA_Msk) && !defined(DOXYGEN)
+    return DWT->CYCCNT;
+#else
+    return xtimer_now().ticks32;
+#endif
+}
+
+/**
+ * @brief   Initializes the profiling clock and resets all statistics
+ *
+ * @note    Called by @ref auto_init
+ */
+void schedprof_init(void);
+
+/**
+ * @brief   Resets the statistics of all threads
+ */
+void schedprof_reset(void);
+
+/**
+ * @brief   Takes a consistent snapshot of a thread's profiling data
+ *
+ * @param[in] pid   PID of the thread
+ * @param[out] out  snapshot of the profiling data
+ */
+void schedprof_get(kernel_pid_t pid, schedprof_t *out);
+
+/**
+ * @brief   Scheduler hook: the scheduler switches from @p prev to @p next
+ *
+ * @pre     Interrupts are disabled
+ *
+ * @param[in] prev  thread that was running, may be NULL
+ * @param[in] next  thread that will run next
+ */
+void schedprof_switch(thread_t *prev, thread_t *next);
+
+/**
+ * @brief   Scheduler hook: @p thread was put on a run queue
+ *
+ * @pre     Interrupts are disabled
+ *
+ * @param[in] thread    thread that became runnable
+ */
+static inline void schedprof_ready(thread_t *thread)
+{
+    schedprof_threads[thread->pid].ready_since = schedprof_now();
+}
+
+/**
+ * @brief   Prints a `ps`-like table of the statistics of all threads
+ */
+void schedprof_print(void);
+
+/**
+ * @brief   Prints the statistics of all threads including histograms in a
+ *          machine-readable format
+ *
+ * One JSON object is printed per thread and line.
+ */
+void schedprof_dump(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHEDPROF_H */
+/** @} */
@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_spscrb Single-producer single-consumer ringbuffer
+ * @ingroup     sys
+ * @brief       Lock-free ringbuffer for elements of arbitrary size
+ *
+ * The ringbuffer can be used without any locking by one producer and one
+ * consumer, e.g. an ISR and a thread. The producer only ever writes
+ * spscrb_t::writes and the consumer only ever writes spscrb_t::reads, so
+ * interrupts are only disabled on CPUs that can not load or store an
+ * `unsigned` atomically (see @ref SPSCRB_ATOMIC_INDEX).
+ *
+ * Besides copying in and out (spscrb_put(), spscrb_get()), both sides can
+ * work directly on the buffer: spscrb_peek_write() and spscrb_peek_read()
+ * return the largest contiguous region that can be written or read, and
+ * spscrb_commit_write() and spscrb_commit_read() hand it over to the other
+ * side.
+ *
+ * @attention   The number of elements must be a power of two!
+ *
+ * @{
+ *
+ * @file
+ * @brief       Single-producer single-consumer ringbuffer interface
+ *              definition
+ */
+
+#ifndef SPSCRB_H
+#define SPSCRB_H
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "irq.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Set to 1 if the CPU loads and stores an `unsigned` atomically
+ *
+ * If 0, interrupts are disabled while accessing the read and write counters.
+ */
+#ifndef SPSCRB_ATOMIC_INDEX
+#ifdef MODULE_ATMEGA_COMMON
+#define SPSCRB_ATOMIC_INDEX     (0)
+#else
+#define SPSCRB_ATOMIC_INDEX     (1)
+#endif
+#endif
+
+/**
+ * @brief   Single-producer single-consumer ringbuffer
+ */
+typedef struct {
+    uint8_t *buf;               /**< Buffer to operate on */
+    unsigned elem_size;         /**< Size of one element in bytes */
+    unsigned size;              /**< Number of elements, power of 2 */
+    volatile unsigned reads;    /**< total number of elements read */
+    volatile unsigned writes;   /**< total number of elements written */
+} spscrb_t;
+
+/**
+ * @brief   Static initializer
+ *
+ * @param[in] BUF       Array of elements to use as buffer, the number of
+ *                      elements must be a power of 2.
+ */
+#define SPSCRB_INIT(BUF) { (uint8_t *)(BUF), sizeof((BUF)[0]), \
+                           sizeof(BUF) / sizeof((BUF)[0]), 0, 0 }
+
+/**
+ * @brief   Initialize a ringbuffer
+ *
+ * @param[out] rb           Ringbuffer to initialize.
+ * @param[in]  buf          Buffer of `num * elem_size` bytes.
+ * @param[in]  elem_size    Size of one element in bytes.
+ * @param[in]  num          Number of elements in @p buf, must be power of 2.
+ */
+static inline void spscrb_init(spscrb_t *rb, void *buf, unsigned elem_size,
+                               unsigned num)
+{
+    assert((elem_size > 0) && (num != 0) && ((num & (num - 1)) == 0));
+
+    rb->buf = buf;
+    rb->elem_size = elem_size;
+    rb->size = num;
+    rb->reads = 0;
+    rb->writes = 0;
+}
+
+/**
+ * @brief   Loads a counter of the ringbuffer written by the other side
+ *
+ * @internal
+ */
+static inline unsigned _spscrb_load(const volatile unsigned *cnt)
+{
+#if SPSCRB_ATOMIC_INDEX
+    unsigned res = *cnt;
+#else
+    unsigned state = irq_disable();
+    unsigned res = *cnt;
+
+    irq_restore(state);
+#endif
+    /* make sure the data is not accessed before the counter covering it */
+    __asm__ volatile ("" : : : "memory");
+    return res;
+}
+
+/**
+ * @brief   Stores a counter of the ringbuffer after the data it covers
+ *
+ * @internal
+ */
+static inline void _spscrb_store(volatile unsigned *cnt, unsigned val)
+{
+    /* make sure the data is in place before the other side sees it */
+    __asm__ volatile ("" : : : "memory");
+#if SPSCRB_ATOMIC_INDEX
+    *cnt = val;
+#else
+    unsigned state = irq_disable();
+
+    *cnt = val;
+    irq_restore(state);
+#endif
+}
+
+/**
+ * @brief   Get number of elements available for reading
+ *
+ * @param[in] rb    Ringbuffer to operate on
+ *
+ * @return  number of elements
+ */
+static inline unsigned spscrb_avail(const spscrb_t *rb)
+{
+    return _spscrb_load(&rb->writes) - _spscrb_load(&rb->reads);
+}
+
+/**
+ * @brief   Get number of elements that can be written
+ *
+ * @param[in] rb    Ringbuffer to operate on
+ *
+ * @return  number of elements
+ */
+static inline unsigned spscrb_free(const spscrb_t *rb)
+{
+    return rb->size - spscrb_avail(rb);
+}
+
+/**
+ * @brief   Test if the ringbuffer is empty
+ *
+ * @param[in] rb    Ringbuffer to operate on
+ *
+ * @return  1 if empty, 0 otherwise
+ */
+static inline int spscrb_empty(const spscrb_t *rb)
+{
+    return spscrb_avail(rb) == 0;
+}
+
+/**
+ * @brief   Test if the ringbuffer is full
+ *
+ * @param[in] rb    Ringbuffer to operate on
+ *
+ * @return  1 if full, 0 otherwise
+ */
+static inline int spscrb_full(const spscrb_t *rb)
+{
+    return spscrb_avail(rb) == rb->size;
+}
+
+/**
+ * @brief   Add elements to the ringbuffer
+ *
+ * @note    Must only be called by the producer.
+ *
+ * @param[in] rb    Ringbuffer to operate on
+ * @param[in] src   Elements to add
+ * @param[in] n     Maximum number of elements to add
+ *
+ * @return  number of elements added
+ */
+unsigned spscrb_put(spscrb_t *rb, const void *src, unsigned n);
+
+/**
+ * @brief   Get elements from the ringbuffer
+ *
+ * @note    Must only be called by the consumer.
+ *
+ * @param[in]  rb   Ringbuffer to operate on
+ * @param[out] dst  Buffer to copy the elements to
+ * @param[in]  n    Maximum number of elements to get
+ *
+ * @return  number of elements copied to @p dst
+ */
+unsigned spscrb_get(spscrb_t *rb, void *dst, unsigned n);
+
+/**
+ * @brief   Drop elements from the ringbuffer
+ *
+ * @note    Must only be called by the consumer.
+ *
+ * @param[in] rb    Ringbuffer to operate on
+ * @param[in] n     Maximum number of elements to drop
+ *
+ * @return  number of elements dropped
+ */
+unsigned spscrb_drop(spscrb_t *rb, unsigned n);
+
+/**
+ * @brief   Get the largest contiguous region that can be written
+ *
+ * @note    Must only be called by the producer.
+ *
+ * @param[in]  rb   Ringbuffer to operate on
+ * @param[out] n    Number of elements that fit into the region
+ *
+ * @return  start of the region, NULL if the ringbuffer is full
+ */
+void *spscrb_peek_write(spscrb_t *rb, unsigned *n);
+
+/**
+ * @brief   Make elements written to a region returned by
+ *          spscrb_peek_write() available to the consumer
+ *
+ * @param[in] rb    Ringbuffer to operate on
+ * @param[in] n     Number of elements written, not more than returned by
+ *                  spscrb_peek_write()
+ */
+static inline void spscrb_commit_write(spscrb_t *rb, unsigned n)
+{
+    assert(n <= spscrb_free(rb));
+    _spscrb_store(&rb->writes, rb->writes + n);
+}
+
+/**
+ * @brief   Get the largest contiguous region that can be read
+ *
+ * @note    Must only be called by the consumer.
+ *
+ * @param[in]  rb   Ringbuffer to operate on
+ * @param[out] n    Number of elements in the region
+ *
+ * @return  start of the region, NULL if the ringbuffer is empty
+ */
+const void *spscrb_peek_read(spscrb_t *rb, unsigned *n);
+
+/**
+ * @brief   Release elements read from a region returned by
+ *          spscrb_peek_read() to the producer
+ *
+ * @param[in] rb    Ringbuffer to operate on
+ * @param[in] n     Number of elements read, not more than returned by
+ *                  spscrb_peek_read()
+ */
+static inline void spscrb_commit_read(spscrb_t *rb, unsigned n)
+{
+    assert(n <= spscrb_avail(rb));
+    _spscrb_store(&rb->reads, rb->reads + n);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPSCRB_H */
+/** @} */
@@ -158,6 +158,25 @@ extern "C" {
  */
 #define VFS_ANY_FD (-1)
 
+/**
+ * @name    Readiness events used by vfs_file_ops::poll and vfs_poll
+ * @{
+ */
+#define VFS_POLLIN      (0x01)  /**< data can be read without blocking */
+#define VFS_POLLOUT     (0x04)  /**< data can be written without blocking */
+#define VFS_POLLERR     (0x08)  /**< an error is pending on the file */
+#define VFS_POLLHUP     (0x10)  /**< the peer hung up */
+/** @} */
+
+#ifndef VFS_POLL_THREAD_FLAG
+/**
+ * @brief Thread flag set on the waiter of vfs_file_ops::poll
+ *
+ * Must not collide with any other thread flag the polling thread waits on.
+ */
+#define VFS_POLL_THREAD_FLAG    (0x2000)
+#endif
+
 /* Forward declarations */
 /**
  * @brief struct @c vfs_file_ops typedef
@@ -370,6 +389,32 @@ struct vfs_file_ops {
      * @return <0 on error
      */
     ssize_t (*write) (vfs_file_t *filp, const void *src, size_t nbytes);
+
+    /**
+     * @brief Query readiness of an open file and register a waiter
+     *
+     * If @p waiter is not @c KERNEL_PID_UNDEF, the driver must set
+     * @ref VFS_POLL_THREAD_FLAG on @p waiter whenever the readiness of the
+     * file may have changed, until it is called again with
+     * @c KERNEL_PID_UNDEF. Setting the flag may happen from interrupt context.
+     *
+     * Only one waiter per file is supported: while a thread is registered,
+     * registering another thread must fail with -EBUSY, and unregistering
+     * must only take effect if called by the registered thread.
+     *
+     * Files that do not implement this operation are always ready for
+     * reading and writing, like regular files.
+     *
+     * @param[in]  filp     pointer to open file
+     * @param[in]  events   mask of VFS_POLLIN and VFS_POLLOUT to check for
+     * @param[in]  waiter   thread to notify or KERNEL_PID_UNDEF to unregister
+     *
+     * @return mask of the events that are ready (VFS_POLLERR and VFS_POLLHUP
+     *         are reported regardless of @p events)
+     * @return -EBUSY if another thread is registered as waiter
+     * @return <0 on error
+     */
+    int (*poll) (vfs_file_t *filp, unsigned events, kernel_pid_t waiter);
 };
 
 /**
@@ -669,6 +714,21 @@ ssize_t vfs_read(int fd, void *dest, size_t count);
  */
 ssize_t vfs_write(int fd, const void *src, size_t count);
 
+/**
+ * @brief Query readiness of an open file and register a waiter
+ *
+ * See vfs_file_ops::poll for the semantics of @p waiter.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[in]  events   mask of VFS_POLLIN and VFS_POLLOUT to check for
+ * @param[in]  waiter   thread to notify or KERNEL_PID_UNDEF to unregister
+ *
+ * @return mask of the events that are ready
+ * @return -EBUSY if another thread is registered as waiter
+ * @return <0 on error
+ */
+int vfs_poll(int fd, unsigned events, kernel_pid_t waiter);
+
 /**
  * @brief Open a directory for reading with readdir
  *
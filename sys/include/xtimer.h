@@ -20,6 +20,11 @@
  * number of active timers.  The reason for this is that multiplexing is
  * realized by next-first singly linked lists.
  *
+ * With the `xtimer_pheap` pseudomodule the lists are replaced by pairing
+ * heaps.  Setting a timer is O(1), removing one is O(log n) amortized, at the
+ * cost of two additional pointers per timer.  Timers with the exact same
+ * target time may then fire in any order.
+ *
  * @{
  * @file
  * @brief   xtimer interface definitions
@@ -32,6 +37,7 @@
 #include <stdint.h>
 #include "timex.h"
 #include "msg.h"
+#include "mbox.h"
 #include "mutex.h"
 
 #include "board.h"
@@ -69,6 +75,10 @@ typedef void (*xtimer_callback_t)(void*);
  */
 typedef struct xtimer {
     struct xtimer *next;         /**< reference to next timer in timer lists */
+#if defined(MODULE_XTIMER_PHEAP) || defined(DOXYGEN)
+    struct xtimer *child;        /**< leftmost child in timer heap */
+    struct xtimer *prev;         /**< left sibling or parent in timer heap */
+#endif
     uint32_t target;             /**< lower 32bit absolute target time */
     uint32_t long_target;        /**< upper 32bit absolute target time */
     xtimer_callback_t callback;  /**< callback function to call when timer
@@ -343,6 +353,25 @@ static inline int xtimer_msg_receive_timeout(msg_t *msg, uint32_t timeout);
  */
 static inline int xtimer_msg_receive_timeout64(msg_t *msg, uint64_t timeout);
 
+/**
+ * @brief receive a message from a mailbox blocking but with timeout
+ *
+ * Like @ref xtimer_msg_receive_timeout(), the waiting thread is put on a
+ * shared deadline queue instead of arming an xtimer of its own, so a message
+ * arriving in time costs no timer operation in the common case.
+ *
+ * @note    Only available with module `core_mbox`.
+ *
+ * @param[in]  mbox     mailbox to receive from
+ * @param[out] msg      pointer to a msg_t which will be filled in case of
+ *                      no timeout
+ * @param[in]  timeout  timeout in microseconds relative
+ *
+ * @return     < 0 on timeout, other value otherwise
+ */
+static inline int xtimer_mbox_get_timeout(mbox_t *mbox, msg_t *msg,
+                                          uint64_t timeout);
+
 /**
  * @brief Convert microseconds to xtimer ticks
  *
@@ -541,6 +570,18 @@ void xtimer_set_timeout_flag(xtimer_t *t, uint32_t timeout);
 #define XTIMER_PERIODIC_RELATIVE (512)
 #endif
 
+#ifndef XTIMER_DEADLINE_RETRY
+/**
+ * @brief   Deadline retry interval in ticks
+ *
+ * If a thread in xtimer_msg_receive_timeout() or xtimer_mbox_get_timeout()
+ * is not blocked when its deadline expires (e.g. because it was preempted
+ * right before or after blocking), the deadline is handled again after this
+ * many ticks instead of waking the thread.
+ */
+#define XTIMER_DEADLINE_RETRY (XTIMER_BACKOFF * 4)
+#endif
+
 /*
  * Default xtimer configuration
  */
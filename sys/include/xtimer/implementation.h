@@ -90,6 +90,7 @@ void _xtimer_set_wakeup(xtimer_t *timer, uint32_t offset, kernel_pid_t pid);
 void _xtimer_set_wakeup64(xtimer_t *timer, uint64_t offset, kernel_pid_t pid);
 int _xtimer_msg_receive_timeout(msg_t *msg, uint32_t ticks);
 int _xtimer_msg_receive_timeout64(msg_t *msg, uint64_t ticks);
+int _xtimer_mbox_get_timeout64(mbox_t *mbox, msg_t *msg, uint64_t ticks);
 
 /**
  * @brief  Sleep for the given number of ticks
@@ -251,6 +252,13 @@ static inline int xtimer_msg_receive_timeout64(msg_t *msg, uint64_t timeout)
     return _xtimer_msg_receive_timeout64(msg, _xtimer_ticks_from_usec64(timeout));
 }
 
+static inline int xtimer_mbox_get_timeout(mbox_t *mbox, msg_t *msg,
+                                          uint64_t timeout)
+{
+    return _xtimer_mbox_get_timeout64(mbox, msg,
+                                      _xtimer_ticks_from_usec64(timeout));
+}
+
 static inline xtimer_ticks32_t xtimer_ticks_from_usec(uint32_t usec)
 {
     xtimer_ticks32_t ticks;
@@ -22,12 +22,20 @@
 void isrpipe_init(isrpipe_t *isrpipe, char *buf, size_t bufsize)
 {
     mutex_init(&isrpipe->mutex);
-    tsrb_init(&isrpipe->tsrb, buf, bufsize);
+    spscrb_init(&isrpipe->rb, buf, 1, bufsize);
 }
 
 int isrpipe_write_one(isrpipe_t *isrpipe, char c)
 {
-    int res = tsrb_add_one(&isrpipe->tsrb, c);
+    unsigned n;
+    char *pos = spscrb_peek_write(&isrpipe->rb, &n);
+    int res = -1;
+
+    if (pos != NULL) {
+        *pos = c;
+        spscrb_commit_write(&isrpipe->rb, 1);
+        res = 0;
+    }
 
     /* `res` is either 0 on success or -1 when the buffer is full. Either way,
      * unlocking the mutex is fine.
@@ -37,11 +45,20 @@ int isrpipe_write_one(isrpipe_t *isrpipe, char c)
     return res;
 }
 
+int isrpipe_write(isrpipe_t *isrpipe, const char *buf, size_t count)
+{
+    int res = spscrb_put(&isrpipe->rb, buf, count);
+
+    mutex_unlock(&isrpipe->mutex);
+
+    return res;
+}
+
 int isrpipe_read(isrpipe_t *isrpipe, char *buffer, size_t count)
 {
     int res;
 
-    while (!(res = tsrb_get(&isrpipe->tsrb, buffer, count))) {
+    while (!(res = spscrb_get(&isrpipe->rb, buffer, count))) {
         mutex_lock(&isrpipe->mutex);
     }
     return res;
@@ -90,7 +90,7 @@ static void time_evt(void *arg)
     thread_flags_set((thread_t *)arg, TFLAGS_TIMEOUT);
 }
 
-static int syncsend(uint8_t resp, size_t len, bool unlock)
+static int syncsendv(uint8_t resp, const iolist_t *snips, bool unlock)
 {
     int res = EMCUTE_TIMEOUT;
     waiton = resp;
@@ -101,7 +101,7 @@ static int syncsend(uint8_t resp, size_t len, bool unlock)
 
     for (unsigned retries = 0; retries <= EMCUTE_N_RETRY; retries++) {
         DEBUG("[emcute] syncsend: sending round %i\n", retries);
-        sock_udp_send(&sock, tbuf, len, &gateway);
+        sock_udp_sendv(&sock, snips, &gateway);
 
         xtimer_set(&timer, (EMCUTE_T_RETRY * US_PER_SEC));
         thread_flags_t flags = thread_flags_wait_any(TFLAGS_ANY);
@@ -121,6 +121,13 @@ static int syncsend(uint8_t resp, size_t len, bool unlock)
     return res;
 }
 
+static int syncsend(uint8_t resp, size_t len, bool unlock)
+{
+    const iolist_t snip = { NULL, tbuf, len };
+
+    return syncsendv(resp, &snip, unlock);
+}
+
 static void on_disconnect(void)
 {
     if (waiton == DISCONNECT) {
@@ -344,7 +351,6 @@ int emcute_pub(emcute_topic_t *topic, const void *data, size_t len,
     mutex_lock(&txlock);
 
     size_t pos = set_len(tbuf, (len + 6));
-    len += (pos + 6);
     tbuf[pos++] = PUBLISH;
     tbuf[pos++] = flags;
     byteorder_htobebufs(&tbuf[pos], topic->id);
@@ -352,13 +358,16 @@ int emcute_pub(emcute_topic_t *topic, const void *data, size_t len,
     byteorder_htobebufs(&tbuf[pos], id_next);
     waitonid = id_next++;
     pos += 2;
-    memcpy(&tbuf[pos], data, len);
+
+    /* send the payload straight from the caller's buffer */
+    const iolist_t payload = { NULL, (void *)data, len };
+    const iolist_t pkt = { (iolist_t *)&payload, tbuf, pos };
 
     if (flags & EMCUTE_QOS_1) {
-        res = syncsend(PUBACK, len, true);
+        res = syncsendv(PUBACK, &pkt, true);
     }
     else {
-        sock_udp_send(&sock, tbuf, len, &gateway);
+        sock_udp_sendv(&sock, &pkt, &gateway);
         mutex_unlock(&txlock);
     }
 
@@ -481,11 +490,12 @@ int emcute_willupd_msg(const void *data, size_t len)
     mutex_lock(&txlock);
 
     size_t pos = set_len(tbuf, (len + 1));
-    len += (pos + 1);
     tbuf[pos++] = WILLMSGUPD;
-    memcpy(&tbuf[pos], data, len);
 
-    return syncsend(WILLMSGRESP, len, true);
+    const iolist_t msg = { NULL, (void *)data, len };
+    const iolist_t pkt = { (iolist_t *)&msg, tbuf, pos };
+
+    return syncsendv(WILLMSGRESP, &pkt, true);
 }
 
 void emcute_run(uint16_t port, const char *id)
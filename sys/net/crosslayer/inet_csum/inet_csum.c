@@ -13,16 +13,111 @@
  */
 
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include "byteorder.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+/* word type that may alias the (byte) buffers handed to this module */
+typedef uint32_t __attribute__((__may_alias__)) _word_t;
+typedef uint16_t __attribute__((__may_alias__)) _half_t;
+
+/**
+ * @brief   Adds @p len bytes of @p buf to the accumulators @p acc
+ *
+ * The one's complement sum is independent of the byte order (RFC 1071,
+ * section 2 (B)), so the buffer is summed up in native byte order a 32-bit
+ * word at a time into 64-bit accumulators. Carries are only folded back in
+ * by _finish(). Leading bytes up to the next word boundary and trailing
+ * bytes are added separately, so only aligned loads are used.
+ *
+ * If the parity of the address of @p buf does not match the parity of its
+ * offset within the checksum domain, the aligned loads pair the bytes the
+ * wrong way round. The sum of such a buffer goes into the second accumulator
+ * and is swapped by _finish().
+ *
+ * @param[in,out] acc       Accumulators for the correctly and the wrongly
+ *                          paired sums.
+ * @param[in] buf           A buffer.
+ * @param[in] len           Length of @p buf in byte.
+ * @param[in] accum_len     Offset of @p buf within the checksum domain.
+ */
+static void _accumulate(uint64_t *acc, const uint8_t *buf, size_t len,
+                        size_t accum_len)
+{
+    uint64_t sum = 0;
+    unsigned idx = (accum_len ^ (uintptr_t)buf) & 1;
+
+    if (((uintptr_t)buf & 1) && (len > 0)) {
+        /* add first byte as bottom half of the (aligned) preceding word */
+        uint16_t half = 0;
+
+        ((uint8_t *)&half)[1] = *buf;
+        sum += half;
+        buf++;
+        len--;
+    }
+    if (((uintptr_t)buf & 2) && (len > 1)) {
+        sum += *((const _half_t *)buf);
+        buf += 2;
+        len -= 2;
+    }
+    for (; len >= (4 * sizeof(_word_t)); len -= 4 * sizeof(_word_t)) {
+        const _word_t *words = (const _word_t *)buf;
+
+        sum += words[0];
+        sum += words[1];
+        sum += words[2];
+        sum += words[3];
+        buf += 4 * sizeof(_word_t);
+    }
+    for (; len >= sizeof(_word_t); len -= sizeof(_word_t)) {
+        sum += *((const _word_t *)buf);
+        buf += sizeof(_word_t);
+    }
+    if (len > 1) {
+        sum += *((const _half_t *)buf);
+        buf += 2;
+        len -= 2;
+    }
+    if (len > 0) {
+        /* add last byte as top half of the (aligned) word */
+        uint16_t half = 0;
+
+        ((uint8_t *)&half)[0] = *buf;
+        sum += half;
+    }
+    acc[idx] += sum;
+}
+
+static inline uint16_t _fold(uint64_t acc)
+{
+    acc = (acc & 0xffffffff) + (acc >> 32);
+    acc = (acc & 0xffffffff) + (acc >> 32);
+    acc = (acc & 0xffff) + (acc >> 16);
+    acc = (acc & 0xffff) + (acc >> 16);
+    return (uint16_t)acc;
+}
+
+/**
+ * @brief   Adds the accumulators @p acc to @p sum
+ */
+static uint16_t _finish(uint16_t sum, const uint64_t *acc)
+{
+    uint32_t csum = _fold(acc[0]) + byteorder_swaps(_fold(acc[1]));
+
+    csum = ntohs(_fold(csum)) + sum;
+    return _fold(csum);
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
-    uint32_t csum = sum;
+    uint64_t acc[2] = { 0, 0 };
+    uint16_t csum;
 
     DEBUG("inet_sum: sum = 0x%04" PRIx16 ", len = %" PRIu16, sum, len);
 #if ENABLE_DEBUG
@@ -35,31 +130,38 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
 #endif
 
     if (len == 0)
-        return csum;
+        return sum;
 
-    if (accum_len & 1) {      /* if accumulated length is odd */
-        csum += *buf;         /* add first byte as bottom half of 16-byte word */
-        buf++;
-        len--;
-        accum_len++;
-    }
+    _accumulate(acc, buf, len, accum_len);
+    csum = _finish(sum, acc);
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
-    }
+    DEBUG("inet_sum: new sum = 0x%04" PRIx16 "\n", csum);
+
+    return csum;
+}
 
-    if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
+uint16_t inet_csum_iolist(uint16_t sum, const iolist_t *iolist,
+                          const iolist_t *end, size_t *accum_len)
+{
+    uint64_t acc[2] = { 0, 0 };
+    size_t len = *accum_len;
 
-    while (csum >> 16) {
-        uint16_t carry = csum >> 16;
-        csum = (csum & 0xffff) + carry;
+    for (; (iolist != NULL) && (iolist != end); iolist = iolist->iol_next) {
+        _accumulate(acc, iolist->iol_base, iolist->iol_len, len);
+        len += iolist->iol_len;
     }
+    *accum_len = len;
+    return _finish(sum, acc);
+}
 
-    DEBUG("inet_sum: new sum = 0x%04" PRIx32 "\n", csum);
+uint16_t inet_csum_update(uint16_t csum, const uint8_t *old_buf,
+                          const uint8_t *new_buf, uint16_t len)
+{
+    /* ~HC + m' */
+    uint16_t sum = inet_csum((uint16_t)~csum, new_buf, len);
 
-    return csum;
+    /* ~(~HC + m' + ~m) */
+    return inet_csum_update16((uint16_t)~sum, inet_csum(0, old_buf, len), 0);
 }
 
 /** @} */
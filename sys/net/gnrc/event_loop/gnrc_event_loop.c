@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <errno.h>
+
+#include "irq.h"
+#include "thread_flags.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/event_loop.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#if ((GNRC_EVENT_LOOP_PKTQ_SIZE & (GNRC_EVENT_LOOP_PKTQ_SIZE - 1)) != 0)
+#error "GNRC_EVENT_LOOP_PKTQ_SIZE must be a power of two"
+#endif
+
+/**
+ * @brief   Packet pending for a layer
+ */
+typedef struct {
+    gnrc_event_loop_layer_t *layer; /**< target layer */
+    gnrc_pktsnip_t *pkt;            /**< the packet */
+    uint16_t cmd;                   /**< netapi command */
+} _pending_t;
+
+event_queue_t gnrc_event_loop_queue;
+
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+static gnrc_event_loop_layer_t *_layers = NULL;
+
+#if ENABLE_DEBUG
+static char _stack[GNRC_EVENT_LOOP_STACK_SIZE + THREAD_EXTRA_STACKSIZE_PRINTF];
+#else
+static char _stack[GNRC_EVENT_LOOP_STACK_SIZE];
+#endif
+
+static _pending_t _pktq[GNRC_EVENT_LOOP_PKTQ_SIZE];
+static unsigned _pktq_head = 0, _pktq_fill = 0;
+
+static void _handle_pktq(event_t *event);
+static event_t _pktq_event = { .handler = _handle_pktq };
+
+static void *_event_loop(void *args);
+
+kernel_pid_t gnrc_event_loop_init(void)
+{
+    if (_pid == KERNEL_PID_UNDEF) {
+        /* packets may already be posted before the thread claimed the queue */
+        event_queue_init_detached(&gnrc_event_loop_queue);
+        _pid = thread_create(_stack, sizeof(_stack), GNRC_EVENT_LOOP_PRIO,
+                             THREAD_CREATE_STACKTEST, _event_loop, NULL,
+                             "gnrc");
+    }
+    return _pid;
+}
+
+static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    unsigned state = irq_disable();
+
+    if (_pktq_fill == GNRC_EVENT_LOOP_PKTQ_SIZE) {
+        irq_restore(state);
+        DEBUG("gnrc_event_loop: packet queue full, dropping %p\n",
+              (void *)pkt);
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    _pending_t *p = &_pktq[(_pktq_head + _pktq_fill) &
+                           (GNRC_EVENT_LOOP_PKTQ_SIZE - 1)];
+
+    p->layer = ctx;
+    p->pkt = pkt;
+    p->cmd = cmd;
+    _pktq_fill++;
+    irq_restore(state);
+    event_post(&gnrc_event_loop_queue, &_pktq_event);
+}
+
+void gnrc_event_loop_register(gnrc_event_loop_layer_t *layer,
+                              gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    assert((layer != NULL) && (layer->handle != NULL));
+    layer->cbd.cb = _netapi_cb;
+    layer->cbd.ctx = layer;
+    gnrc_netreg_entry_init_cb(&layer->entry, demux_ctx, &layer->cbd);
+
+    unsigned state = irq_disable();
+    gnrc_event_loop_layer_t **ptr = &_layers;
+
+    /* append, so layers are offered messages in order of registration */
+    while (*ptr != NULL) {
+        ptr = &(*ptr)->next;
+    }
+    layer->next = NULL;
+    *ptr = layer;
+    irq_restore(state);
+    gnrc_netreg_register(type, &layer->entry);
+}
+
+static void _handle_pktq(event_t *event)
+{
+    (void)event;
+    while (1) {
+        _pending_t p;
+        unsigned state = irq_disable();
+
+        if (_pktq_fill == 0) {
+            irq_restore(state);
+            return;
+        }
+        p = _pktq[_pktq_head];
+        _pktq_head = (_pktq_head + 1) & (GNRC_EVENT_LOOP_PKTQ_SIZE - 1);
+        _pktq_fill--;
+        irq_restore(state);
+
+        msg_t msg = { .sender_pid = _pid, .type = p.cmd,
+                      .content = { .ptr = p.pkt } };
+
+        if (!p.layer->handle(&msg)) {
+            DEBUG("gnrc_event_loop: layer did not handle %p\n",
+                  (void *)p.pkt);
+            gnrc_pktbuf_release(p.pkt);
+        }
+    }
+}
+
+static void _handle_msg(msg_t *msg)
+{
+    switch (msg->type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            /* can't tell which layer the packet is meant for */
+            DEBUG("gnrc_event_loop: dropping packet sent to thread directly\n");
+            gnrc_pktbuf_release(msg->content.ptr);
+            return;
+        default:
+            break;
+    }
+    for (gnrc_event_loop_layer_t *layer = _layers; layer != NULL;
+         layer = layer->next) {
+        if (layer->handle(msg)) {
+            return;
+        }
+    }
+    if ((msg->type == GNRC_NETAPI_MSG_TYPE_GET) ||
+        (msg->type == GNRC_NETAPI_MSG_TYPE_SET)) {
+        msg_t reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK,
+                        .content = { .value = (uint32_t)-ENOTSUP } };
+
+        msg_reply(msg, &reply);
+        return;
+    }
+    DEBUG("gnrc_event_loop: unhandled message of type 0x%04x\n", msg->type);
+}
+
+static void *_event_loop(void *args)
+{
+    msg_t msg_q[GNRC_EVENT_LOOP_MSG_QUEUE_SIZE];
+
+    (void)args;
+    msg_init_queue(msg_q, GNRC_EVENT_LOOP_MSG_QUEUE_SIZE);
+    event_queue_claim(&gnrc_event_loop_queue);
+
+    while (1) {
+        msg_t msg;
+        event_t *event;
+
+        /* events might have been posted before the queue was claimed, so
+         * look for work before waiting for the first time */
+        while (msg_try_receive(&msg) == 1) {
+            _handle_msg(&msg);
+        }
+        while ((event = event_get(&gnrc_event_loop_queue)) != NULL) {
+            event->handler(event);
+        }
+        DEBUG("gnrc_event_loop: waiting for events or messages\n");
+        thread_flags_wait_any(THREAD_FLAG_EVENT | THREAD_FLAG_MSG_WAITING);
+    }
+
+    return NULL;
+}
+
+/** @} */
@@ -90,6 +90,7 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 
     if (pkt->type != GNRC_NETTYPE_NETIF) {
         DEBUG("gnrc_netif_ethernet: First header was not generic netif header\n");
+        gnrc_pktbuf_release(pkt);
         return -EBADMSG;
     }
 
@@ -118,6 +119,7 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
         if (payload == NULL) {
             DEBUG("gnrc_netif_ethernet: empty multicast packets over Ethernet "
                   "are not yet supported\n");
+            gnrc_pktbuf_release(pkt);
             return -ENOTSUP;
         }
         _addr_set_multicast(hdr.dst, payload);
@@ -129,6 +131,7 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     else {
         DEBUG("gnrc_netif_ethernet: destination address had unexpected "
               "format\n");
+        gnrc_pktbuf_release(pkt);
         return -EBADMSG;
     }
 
@@ -158,12 +161,109 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     return res;
 }
 
+static gnrc_pktsnip_t *_netif_hdr_build(gnrc_netif_t *netif,
+                                        const ethernet_hdr_t *hdr)
+{
+    gnrc_pktsnip_t *netif_hdr;
+
+    netif_hdr = gnrc_pktbuf_add(NULL, NULL,
+                                sizeof(gnrc_netif_hdr_t) + (2 * ETHERNET_ADDR_LEN),
+                                GNRC_NETTYPE_NETIF);
+    if (netif_hdr == NULL) {
+        DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
+        return NULL;
+    }
+
+    gnrc_netif_hdr_init(netif_hdr->data, ETHERNET_ADDR_LEN, ETHERNET_ADDR_LEN);
+    gnrc_netif_hdr_set_src_addr(netif_hdr->data, hdr->src, ETHERNET_ADDR_LEN);
+    gnrc_netif_hdr_set_dst_addr(netif_hdr->data, hdr->dst, ETHERNET_ADDR_LEN);
+    ((gnrc_netif_hdr_t *)netif_hdr->data)->if_pid = netif->pid;
+    return netif_hdr;
+}
+
+/**
+ * @brief   Receives a frame from a driver supporting
+ *          @ref netdev_driver_t::recv_iol
+ *
+ * The ethernet header is read into a local variable and the payload right into
+ * its final packet buffer snip, so neither needs to be copied afterwards.
+ */
+static gnrc_pktsnip_t *_recv_iol(gnrc_netif_t *netif, int bytes_expected)
+{
+    netdev_t *dev = netif->dev;
+    ethernet_hdr_t hdr;
+    gnrc_pktsnip_t *pkt, *netif_hdr;
+
+    if (bytes_expected <= (int)sizeof(ethernet_hdr_t)) {
+        DEBUG("gnrc_netif_ethernet: frame too short.\n");
+        dev->driver->recv(dev, NULL, bytes_expected, NULL);
+        return NULL;
+    }
+    pkt = gnrc_pktbuf_add(NULL, NULL, bytes_expected - sizeof(ethernet_hdr_t),
+                          GNRC_NETTYPE_UNDEF);
+    if (!pkt) {
+        DEBUG("gnrc_netif_ethernet: cannot allocate pktsnip.\n");
+        /* drop the packet */
+        dev->driver->recv(dev, NULL, bytes_expected, NULL);
+        return NULL;
+    }
+
+    iolist_t payload = { .iol_base = pkt->data, .iol_len = pkt->size };
+    iolist_t iolist = { .iol_next = &payload, .iol_base = &hdr,
+                        .iol_len = sizeof(hdr) };
+    int nread = dev->driver->recv_iol(dev, &iolist, NULL);
+
+    if (nread <= (int)sizeof(ethernet_hdr_t)) {
+        DEBUG("gnrc_netif_ethernet: read error.\n");
+        goto safe_out;
+    }
+#ifdef MODULE_NETSTATS_L2
+    netif->stats.rx_count++;
+    netif->stats.rx_bytes += nread;
+#endif
+
+    if (nread < bytes_expected) {
+        /* shrinking keeps the data where it is */
+        gnrc_pktbuf_realloc_data(pkt, nread - sizeof(ethernet_hdr_t));
+    }
+
+#ifdef MODULE_L2FILTER
+    if (!l2filter_pass(dev->filter, hdr.src, ETHERNET_ADDR_LEN)) {
+        DEBUG("gnrc_netif_ethernet: incoming packet filtered by l2filter\n");
+        goto safe_out;
+    }
+#endif
+
+    /* set payload type from ethertype */
+    pkt->type = gnrc_nettype_from_ethertype(byteorder_ntohs(hdr.type));
+
+    netif_hdr = _netif_hdr_build(netif, &hdr);
+    if (netif_hdr == NULL) {
+        goto safe_out;
+    }
+
+    DEBUG("gnrc_netif_ethernet: received packet from %02x:%02x:%02x:%02x:%02x:%02x "
+          "of length %d\n",
+          hdr.src[0], hdr.src[1], hdr.src[2], hdr.src[3], hdr.src[4],
+          hdr.src[5], nread);
+
+    LL_APPEND(pkt, netif_hdr);
+    return pkt;
+
+safe_out:
+    gnrc_pktbuf_release(pkt);
+    return NULL;
+}
+
 static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 {
     netdev_t *dev = netif->dev;
     int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
     gnrc_pktsnip_t *pkt = NULL;
 
+    if ((bytes_expected > 0) && (dev->driver->recv_iol != NULL)) {
+        return _recv_iol(netif, bytes_expected);
+    }
     if (bytes_expected > 0) {
         pkt = gnrc_pktbuf_add(NULL, NULL,
                               bytes_expected,
@@ -216,22 +316,13 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
         pkt->type = gnrc_nettype_from_ethertype(byteorder_ntohs(hdr->type));
 
         /* create netif header */
-        gnrc_pktsnip_t *netif_hdr;
-        netif_hdr = gnrc_pktbuf_add(NULL, NULL,
-                                    sizeof(gnrc_netif_hdr_t) + (2 * ETHERNET_ADDR_LEN),
-                                    GNRC_NETTYPE_NETIF);
+        gnrc_pktsnip_t *netif_hdr = _netif_hdr_build(netif, hdr);
 
         if (netif_hdr == NULL) {
-            DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
             pkt = eth_hdr;
             goto safe_out;
         }
 
-        gnrc_netif_hdr_init(netif_hdr->data, ETHERNET_ADDR_LEN, ETHERNET_ADDR_LEN);
-        gnrc_netif_hdr_set_src_addr(netif_hdr->data, hdr->src, ETHERNET_ADDR_LEN);
-        gnrc_netif_hdr_set_dst_addr(netif_hdr->data, hdr->dst, ETHERNET_ADDR_LEN);
-        ((gnrc_netif_hdr_t *)netif_hdr->data)->if_pid = netif->pid;
-
         DEBUG("gnrc_netif_ethernet: received packet from %02x:%02x:%02x:%02x:%02x:%02x "
               "of length %d\n",
               hdr->src[0], hdr->src[1], hdr->src[2], hdr->src[3], hdr->src[4],
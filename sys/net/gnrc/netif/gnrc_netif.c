@@ -25,6 +25,8 @@
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/ipv6.h"
 #endif /* MODULE_GNRC_IPV6_NIB */
+#include "net/gnrc/ipv6/route_cache.h"
+#include "net/gnrc/sixlowpan/iphc/cache.h"
 #ifdef MODULE_NETSTATS
 #include "net/netstats.h"
 #endif
@@ -34,6 +36,9 @@
 
 #include "net/gnrc/netif.h"
 #include "net/gnrc/netif/internal.h"
+#ifdef MODULE_GNRC_NETIF_PKTQ
+#include "net/gnrc/netif/pktq.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -614,6 +619,7 @@ int gnrc_netif_ipv6_addr_add_internal(gnrc_netif_t *netif,
 #endif /* GNRC_IPV6_NIB_CONF_ARSM */
     netif->ipv6.addrs_flags[idx] = flags;
     memcpy(&netif->ipv6.addrs[idx], addr, sizeof(netif->ipv6.addrs[idx]));
+    gnrc_ipv6_route_cache_invalidate();
 #ifdef MODULE_GNRC_IPV6_NIB
     if (_get_state(netif, idx) == GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) {
         void *state = NULL;
@@ -660,6 +666,7 @@ void gnrc_netif_ipv6_addr_remove_internal(gnrc_netif_t *netif,
         if (ipv6_addr_equal(&netif->ipv6.addrs[i], addr)) {
             netif->ipv6.addrs_flags[i] = 0;
             ipv6_addr_set_unspecified(&netif->ipv6.addrs[i]);
+            gnrc_ipv6_route_cache_invalidate();
         }
         else {
             ipv6_addr_t tmp;
@@ -1129,6 +1136,9 @@ static void _update_l2addr_from_dev(gnrc_netif_t *netif)
     if (res > 0) {
         netif->l2addr_len = res;
     }
+    /* addresses compressed with the previous address are not elidable
+     * anymore */
+    gnrc_sixlowpan_iphc_cache_invalidate();
 }
 
 static void _init_from_device(gnrc_netif_t *netif)
@@ -1273,7 +1283,8 @@ static void *_gnrc_netif_thread(void *args)
     netdev_t *dev;
     int res;
     msg_t reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK };
-    msg_t msg, msg_queue[GNRC_NETIF_MSG_QUEUE_SIZE];
+    msg_t msg_batch[GNRC_NETIF_MSG_BATCH_SIZE];
+    msg_t msg_queue[GNRC_NETIF_MSG_QUEUE_SIZE];
 
     DEBUG("gnrc_netif: starting thread %i\n", sched_active_pid);
     netif = args;
@@ -1311,74 +1322,95 @@ static void *_gnrc_netif_thread(void *args)
     }
 #ifdef MODULE_NETSTATS_L2
     memset(&netif->stats, 0, sizeof(netstats_t));
+#endif
+#ifdef MODULE_GNRC_NETIF_PKTQ
+    gnrc_netif_pktq_init(&netif->send_queue);
 #endif
     /* now let rest of GNRC use the interface */
     gnrc_netif_release(netif);
 
     while (1) {
         DEBUG("gnrc_netif: waiting for incoming messages\n");
-        msg_receive(&msg);
-        /* dispatch netdev, MAC and gnrc_netapi messages */
-        switch (msg.type) {
-            case NETDEV_MSG_TYPE_EVENT:
-                DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_EVENT received\n");
-                dev->driver->isr(dev);
-                break;
-            case GNRC_NETAPI_MSG_TYPE_SND:
-                DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
-                res = netif->ops->send(netif, msg.content.ptr);
-                if (res < 0) {
-                    DEBUG("gnrc_netif: error sending packet %p (code: %i)\n",
-                          msg.content.ptr, res);
-                }
+        int num = msg_receive_batch(msg_batch, GNRC_NETIF_MSG_BATCH_SIZE);
+
+        for (int i = 0; i < num; i++) {
+            msg_t *msg = &msg_batch[i];
+
+            /* dispatch netdev, MAC and gnrc_netapi messages */
+            switch (msg->type) {
+                case NETDEV_MSG_TYPE_EVENT:
+                    DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_EVENT received\n");
+                    dev->driver->isr(dev);
+                    break;
+                case GNRC_NETAPI_MSG_TYPE_SND:
+                    DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
+#ifdef MODULE_GNRC_NETIF_PKTQ
+                    /* sent after the batch was handled */
+                    gnrc_netif_pktq_put(&netif->send_queue, msg->content.ptr);
+#else
+                    res = netif->ops->send(netif, msg->content.ptr);
+                    if (res < 0) {
+                        DEBUG("gnrc_netif: error sending packet %p (code: %i)\n",
+                              msg->content.ptr, res);
+                    }
 #ifdef MODULE_NETSTATS_L2
-                else {
-                    netif->stats.tx_bytes += res;
-                }
+                    else {
+                        netif->stats.tx_bytes += res;
+                    }
 #endif
-                break;
-            case GNRC_NETAPI_MSG_TYPE_SET:
-                opt = msg.content.ptr;
+#endif
+                    break;
+#ifdef MODULE_GNRC_NETIF_PKTQ
+                case GNRC_NETIF_PKTQ_DEQUEUE_MSG:
+                    DEBUG("gnrc_netif: GNRC_NETIF_PKTQ_DEQUEUE_MSG received\n");
+                    break;
+#endif
+                case GNRC_NETAPI_MSG_TYPE_SET:
+                    opt = msg->content.ptr;
 #ifdef MODULE_NETOPT
-                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SET received. opt=%s\n",
-                      netopt2str(opt->opt));
+                    DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SET received. opt=%s\n",
+                          netopt2str(opt->opt));
 #else
-                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SET received. opt=%d\n",
-                      opt->opt);
+                    DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SET received. opt=%d\n",
+                          opt->opt);
 #endif
-                /* set option for device driver */
-                res = netif->ops->set(netif, opt);
-                DEBUG("gnrc_netif: response of netif->ops->set(): %i\n", res);
-                reply.content.value = (uint32_t)res;
-                msg_reply(&msg, &reply);
-                break;
-            case GNRC_NETAPI_MSG_TYPE_GET:
-                opt = msg.content.ptr;
+                    /* set option for device driver */
+                    res = netif->ops->set(netif, opt);
+                    DEBUG("gnrc_netif: response of netif->ops->set(): %i\n", res);
+                    reply.content.value = (uint32_t)res;
+                    msg_reply(msg, &reply);
+                    break;
+                case GNRC_NETAPI_MSG_TYPE_GET:
+                    opt = msg->content.ptr;
 #ifdef MODULE_NETOPT
-                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_GET received. opt=%s\n",
-                      netopt2str(opt->opt));
+                    DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_GET received. opt=%s\n",
+                          netopt2str(opt->opt));
 #else
-                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_GET received. opt=%d\n",
-                      opt->opt);
+                    DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_GET received. opt=%d\n",
+                          opt->opt);
 #endif
-                /* get option from device driver */
-                res = netif->ops->get(netif, opt);
-                DEBUG("gnrc_netif: response of netif->ops->get(): %i\n", res);
-                reply.content.value = (uint32_t)res;
-                msg_reply(&msg, &reply);
-                break;
-            default:
-                if (netif->ops->msg_handler) {
-                    DEBUG("gnrc_netif: delegate message of type 0x%04x to "
-                          "netif->ops->msg_handler()\n", msg.type);
-                    netif->ops->msg_handler(netif, &msg);
-                }
-                else {
-                    DEBUG("gnrc_netif: unknown message type 0x%04x"
-                          "(no message handler defined)\n", msg.type);
-                }
-                break;
+                    /* get option from device driver */
+                    res = netif->ops->get(netif, opt);
+                    DEBUG("gnrc_netif: response of netif->ops->get(): %i\n", res);
+                    reply.content.value = (uint32_t)res;
+                    msg_reply(msg, &reply);
+                    break;
+                default:
+                    if (netif->ops->msg_handler) {
+                        DEBUG("gnrc_netif: delegate message of type 0x%04x to "
+                              "netif->ops->msg_handler()\n", msg->type);
+                        netif->ops->msg_handler(netif, msg);
+                    }
+                    else {
+                        DEBUG("gnrc_netif: unknown message type 0x%04x"
+                              "(no message handler defined)\n", msg->type);
+                    }
+                    break;
+            }
         }
+#ifdef MODULE_GNRC_NETIF_PKTQ
+        gnrc_netif_pktq_send(netif);
+#endif
     }
     /* never reached */
     return NULL;
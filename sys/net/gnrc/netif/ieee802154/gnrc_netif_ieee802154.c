@@ -236,6 +236,7 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     }
     if (pkt->type != GNRC_NETTYPE_NETIF) {
         DEBUG("_send_ieee802154: first header is not generic netif header\n");
+        gnrc_pktbuf_release(pkt);
         return -EBADMSG;
     }
     netif_hdr = pkt->data;
@@ -266,6 +267,7 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
                                         dst, dst_len, dev_pan,
                                         dev_pan, flags, state->seq++)) == 0) {
         DEBUG("_send_ieee802154: Error preperaring frame\n");
+        gnrc_pktbuf_release(pkt);
         return -EINVAL;
     }
 
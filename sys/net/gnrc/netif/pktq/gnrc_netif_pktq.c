@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/netif/pktq.h"
+#include "xtimer.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+static inline unsigned _idx(const gnrc_netif_pktq_t *q, unsigned pos)
+{
+    return (q->head + pos) % GNRC_NETIF_PKTQ_SIZE;
+}
+
+void gnrc_netif_pktq_init(gnrc_netif_pktq_t *q)
+{
+    memset(q, 0, sizeof(gnrc_netif_pktq_t));
+    q->retry_msg.type = GNRC_NETIF_PKTQ_DEQUEUE_MSG;
+}
+
+int gnrc_netif_pktq_put(gnrc_netif_pktq_t *q, gnrc_pktsnip_t *pkt)
+{
+    int res = 0;
+
+    if (q->fill == GNRC_NETIF_PKTQ_SIZE) {
+        q->stats.dropped++;
+        res = -ENOBUFS;
+        if (!GNRC_NETIF_PKTQ_DROP_HEAD) {
+            DEBUG("gnrc_netif_pktq: queue full, dropping %p\n", (void *)pkt);
+            gnrc_pktbuf_release_error(pkt, ENOBUFS);
+            return res;
+        }
+        gnrc_pktsnip_t *head = gnrc_netif_pktq_get(q);
+        DEBUG("gnrc_netif_pktq: queue full, dropping %p\n", (void *)head);
+        gnrc_pktbuf_release_error(head, ENOBUFS);
+    }
+    q->pkts[_idx(q, q->fill)] = pkt;
+    q->stats.queued++;
+    if (++q->fill > q->stats.max_fill) {
+        q->stats.max_fill = q->fill;
+    }
+    return res;
+}
+
+gnrc_pktsnip_t *gnrc_netif_pktq_get(gnrc_netif_pktq_t *q)
+{
+    gnrc_pktsnip_t *pkt = gnrc_netif_pktq_peek(q);
+
+    if (pkt != NULL) {
+        q->pkts[q->head] = NULL;
+        q->head = _idx(q, 1);
+        q->fill--;
+    }
+    return pkt;
+}
+
+static void _retry(gnrc_netif_t *netif)
+{
+    gnrc_netif_pktq_t *q = &netif->send_queue;
+
+    xtimer_set_msg(&q->retry_timer, GNRC_NETIF_PKTQ_RETRY_US, &q->retry_msg,
+                   netif->pid);
+}
+
+static unsigned _send_batch(gnrc_netif_t *netif)
+{
+    gnrc_netif_pktq_t *q = &netif->send_queue;
+    gnrc_pktsnip_t *pkts[GNRC_NETIF_PKTQ_BURST];
+    unsigned num = 0, sent;
+
+    while ((num < GNRC_NETIF_PKTQ_BURST) && (num < q->fill)) {
+        pkts[num] = q->pkts[_idx(q, num)];
+        num++;
+    }
+    sent = netif->ops->send_batch(netif, pkts, num);
+    assert(sent <= num);
+    /* the device released the packets it took, so they just leave the
+     * queue */
+    for (unsigned i = 0; i < sent; i++) {
+        gnrc_netif_pktq_get(q);
+    }
+    if (sent < num) {
+        DEBUG("gnrc_netif_pktq: device busy, retrying %p later\n",
+              (void *)gnrc_netif_pktq_peek(q));
+        q->stats.busy++;
+        _retry(netif);
+    }
+    return sent;
+}
+
+unsigned gnrc_netif_pktq_send(gnrc_netif_t *netif)
+{
+    gnrc_netif_pktq_t *q = &netif->send_queue;
+    gnrc_pktsnip_t *pkt;
+    unsigned num = 0;
+
+    if ((netif->ops->send_batch != NULL) && (q->fill > 0)) {
+        num = _send_batch(netif);
+        if (num < GNRC_NETIF_PKTQ_BURST) {
+            /* either the queue is empty or the retry timer is set */
+            return num;
+        }
+    }
+    while ((num < GNRC_NETIF_PKTQ_BURST) &&
+           ((pkt = gnrc_netif_pktq_peek(q)) != NULL)) {
+        /* gnrc_netif_ops_t::send() releases the packet, keep it in the queue
+         * in case the device is busy */
+        gnrc_pktbuf_hold(pkt, 1);
+        int res = netif->ops->send(netif, pkt);
+
+        if (res == -EBUSY) {
+            DEBUG("gnrc_netif_pktq: device busy, retrying %p later\n",
+                  (void *)pkt);
+            q->stats.busy++;
+            _retry(netif);
+            return num;
+        }
+        if (res < 0) {
+            DEBUG("gnrc_netif_pktq: error sending packet %p (code: %i)\n",
+                  (void *)pkt, res);
+        }
+#ifdef MODULE_NETSTATS_L2
+        else {
+            netif->stats.tx_bytes += res;
+        }
+#endif
+        /* the packet was handled by the device, drop the reference of the
+         * queue */
+        gnrc_pktbuf_release(gnrc_netif_pktq_get(q));
+        num++;
+    }
+    if (gnrc_netif_pktq_usage(q) > 0) {
+        msg_t msg = { .type = GNRC_NETIF_PKTQ_DEQUEUE_MSG };
+
+        if (msg_send_to_self(&msg) != 1) {
+            /* message queue is full, don't leave the packets stranded until
+             * some other message arrives */
+            DEBUG("gnrc_netif_pktq: unable to wake up thread, retrying later\n");
+            _retry(netif);
+        }
+    }
+    return num;
+}
+
+void gnrc_netif_pktq_flush(gnrc_netif_pktq_t *q)
+{
+    gnrc_pktsnip_t *pkt;
+
+    xtimer_remove(&q->retry_timer);
+    while ((pkt = gnrc_netif_pktq_get(q)) != NULL) {
+        gnrc_pktbuf_release(pkt);
+    }
+}
+
+/** @} */
@@ -38,16 +38,13 @@ static inline uint16_t _calc_csum(gnrc_pktsnip_t *hdr,
                                   gnrc_pktsnip_t *payload)
 {
     uint16_t csum = 0;
-    uint16_t len = (uint16_t)hdr->size;
+    size_t len = hdr->size;
 
-    while (payload && (payload != hdr)) {
-        csum = inet_csum_slice(csum, payload->data, payload->size, len);
-        len += (uint16_t)payload->size;
-        payload = payload->next;
-    }
+    csum = inet_csum_iolist(csum, (iolist_t *)payload, (iolist_t *)hdr, &len);
 
     csum = inet_csum(csum, hdr->data, hdr->size);
-    csum = ipv6_hdr_inet_csum(csum, pseudo_hdr->data, PROTNUM_ICMPV6, len);
+    csum = ipv6_hdr_inet_csum(csum, pseudo_hdr->data, PROTNUM_ICMPV6,
+                              (uint16_t)len);
 
     return ~csum;
 }
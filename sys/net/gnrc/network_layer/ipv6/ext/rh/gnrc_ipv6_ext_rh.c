@@ -15,10 +15,14 @@
  * @author Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include "net/inet_csum.h"
 #include "net/ipv6/ext/rh.h"
 #include "net/gnrc.h"
 
 #include "net/gnrc/icmpv6/error.h"
+#include "net/icmpv6.h"
+#include "net/tcp.h"
+#include "net/udp.h"
 
 #ifdef MODULE_GNRC_RPL_SRH
 #include "net/gnrc/rpl/srh.h"
@@ -112,4 +116,72 @@ int gnrc_ipv6_ext_rh_process(gnrc_pktsnip_t *pkt)
     return res;
 }
 
+/* returns the checksum field of an upper-layer header, NULL if unknown */
+static network_uint16_t *_csum_field(gnrc_pktsnip_t *payload)
+{
+    switch (payload->type) {
+#ifdef MODULE_GNRC_ICMPV6
+        case GNRC_NETTYPE_ICMPV6:
+            if (payload->size >= sizeof(icmpv6_hdr_t)) {
+                return &((icmpv6_hdr_t *)payload->data)->csum;
+            }
+            break;
+#endif
+#ifdef MODULE_GNRC_TCP
+        case GNRC_NETTYPE_TCP:
+            if (payload->size >= sizeof(tcp_hdr_t)) {
+                return &((tcp_hdr_t *)payload->data)->checksum;
+            }
+            break;
+#endif
+#ifdef MODULE_GNRC_UDP
+        case GNRC_NETTYPE_UDP:
+            if (payload->size >= sizeof(udp_hdr_t)) {
+                return &((udp_hdr_t *)payload->data)->checksum;
+            }
+            break;
+#endif
+        default:
+            break;
+    }
+    return NULL;
+}
+
+void gnrc_ipv6_ext_rh_update_csum(gnrc_pktsnip_t *payload,
+                                  const ipv6_hdr_t *ipv6,
+                                  const ipv6_ext_rh_t *rh)
+{
+    ipv6_addr_t final_dst;
+    network_uint16_t *field;
+    uint16_t csum;
+
+    if ((rh->seg_left == 0) || ((field = _csum_field(payload)) == NULL)) {
+        /* destination already is the final destination or there is no
+         * checksum to update */
+        return;
+    }
+    switch (rh->type) {
+#ifdef MODULE_GNRC_RPL_SRH
+        case IPV6_EXT_RH_TYPE_RPL_SRH:
+            if (gnrc_rpl_srh_final_dst(ipv6, (gnrc_rpl_srh_t *)rh,
+                                       &final_dst) < 0) {
+                return;
+            }
+            break;
+#endif
+        default:
+            DEBUG("ipv6_ext_rh: unknown routing header type %u\n", rh->type);
+            return;
+    }
+    csum = inet_csum_update(byteorder_ntohs(*field), ipv6->dst.u8,
+                            final_dst.u8, sizeof(ipv6_addr_t));
+#ifdef MODULE_GNRC_UDP
+    if ((csum == 0) && (payload->type == GNRC_NETTYPE_UDP)) {
+        /* https://tools.ietf.org/html/rfc8200#section-8.1 bullet 4 */
+        csum = 0xffff;
+    }
+#endif
+    *field = byteorder_htons(csum);
+}
+
 /** @} */
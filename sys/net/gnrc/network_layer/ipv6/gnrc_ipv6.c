@@ -34,16 +34,25 @@
 
 #include "net/gnrc/ipv6.h"
 
+#ifdef MODULE_GNRC_IPV6_EXT_RH
+#include "net/gnrc/ipv6/ext/rh.h"
+#endif
+#ifdef MODULE_GNRC_EVENT_LOOP
+#include "net/gnrc/event_loop.h"
+#endif
+
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
 #define _MAX_L2_ADDR_LEN    (8U)
 
+#ifndef MODULE_GNRC_EVENT_LOOP
 #if ENABLE_DEBUG
 static char _stack[GNRC_IPV6_STACK_SIZE + THREAD_EXTRA_STACKSIZE_PRINTF];
 #else
 static char _stack[GNRC_IPV6_STACK_SIZE];
 #endif
+#endif
 
 #ifdef MODULE_FIB
 #include "net/fib.h"
@@ -53,12 +62,44 @@ static char _stack[GNRC_IPV6_STACK_SIZE];
  */
 static fib_entry_t _fib_entries[GNRC_IPV6_FIB_TABLE_SIZE];
 
+#ifdef MODULE_FIB_TRIE
+/**
+ * @brief buffer for the longest-prefix-match index of the forwarding table
+ */
+static fib_trie_node_t _fib_trie_nodes[FIB_TRIE_NODES_NUMOF(GNRC_IPV6_FIB_TABLE_SIZE)];
+#endif
+
 /**
  * @brief the IPv6 forwarding table
  */
 fib_table_t gnrc_ipv6_fib_table;
 #endif
 
+#ifdef MODULE_GNRC_IPV6_ROUTE_CACHE
+#include "net/gnrc/ipv6/route_cache.h"
+
+/**
+ * @brief   Memoized next hop resolution of a unicast destination
+ */
+typedef struct {
+    ipv6_addr_t dst;            /**< the destination */
+    ipv6_addr_t src;            /**< selected source address, `::` if unknown */
+    unsigned gen;               /**< @ref gnrc_ipv6_route_cache_gen at the time
+                                 *   of resolution */
+    kernel_pid_t req_iface;     /**< interface requested by the sender,
+                                 *   KERNEL_PID_UNDEF for any */
+    kernel_pid_t iface;         /**< interface to the next hop */
+    uint8_t l2addr[GNRC_IPV6_NIB_L2ADDR_MAX_LEN];   /**< link-layer address of
+                                                     *   the next hop */
+    uint8_t l2addr_len;         /**< length of _route_cache_t::l2addr */
+} _route_cache_t;
+
+/* starts at 1, so zero-initialized entries are never valid */
+unsigned gnrc_ipv6_route_cache_gen = 1;
+
+static _route_cache_t _route_cache[GNRC_IPV6_ROUTE_CACHE_SIZE];
+#endif
+
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 kernel_pid_t gnrc_ipv6_pid = KERNEL_PID_UNDEF;
@@ -69,21 +110,38 @@ static void _receive(gnrc_pktsnip_t *pkt);
  * prep_hdr: prepare header for sending (call to _fill_ipv6_hdr()), otherwise
  * assume it is already prepared */
 static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr);
+/* handles a message for IPv6, returns false if it is not meant for IPv6 */
+static bool _handle_msg(msg_t *msg);
+#ifdef MODULE_GNRC_EVENT_LOOP
+static gnrc_event_loop_layer_t _layer = GNRC_EVENT_LOOP_LAYER_INIT(_handle_msg);
+#else
 /* Main event loop for IPv6 */
 static void *_event_loop(void *args);
+#endif
 
 kernel_pid_t gnrc_ipv6_init(void)
 {
     if (gnrc_ipv6_pid == KERNEL_PID_UNDEF) {
+#ifdef MODULE_GNRC_EVENT_LOOP
+        gnrc_ipv6_pid = gnrc_event_loop_init();
+        /* register interest in all IPv6 packets */
+        gnrc_event_loop_register(&_layer, GNRC_NETTYPE_IPV6,
+                                 GNRC_NETREG_DEMUX_CTX_ALL);
+#else
         gnrc_ipv6_pid = thread_create(_stack, sizeof(_stack), GNRC_IPV6_PRIO,
                                       THREAD_CREATE_STACKTEST,
                                       _event_loop, NULL, "ipv6");
+#endif
     }
 
 #ifdef MODULE_FIB
     gnrc_ipv6_fib_table.data.entries = _fib_entries;
     gnrc_ipv6_fib_table.table_type = FIB_TABLE_TYPE_SH;
     gnrc_ipv6_fib_table.size = GNRC_IPV6_FIB_TABLE_SIZE;
+#ifdef MODULE_FIB_TRIE
+    gnrc_ipv6_fib_table.trie.nodes = _fib_trie_nodes;
+    gnrc_ipv6_fib_table.trie.nodes_numof = FIB_TRIE_NODES_NUMOF(GNRC_IPV6_FIB_TABLE_SIZE);
+#endif
     fib_init(&gnrc_ipv6_fib_table);
 #endif
 
@@ -162,9 +220,59 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
     }
 }
 
+static bool _handle_msg(msg_t *msg)
+{
+    switch (msg->type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV received\n");
+            _receive(msg->content.ptr);
+            break;
+
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
+            _send(msg->content.ptr, true);
+            break;
+
+        case GNRC_NETAPI_MSG_TYPE_GET:
+        case GNRC_NETAPI_MSG_TYPE_SET: {
+            msg_t reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK,
+                            .content = { .value = (uint32_t)-ENOTSUP } };
+
+            DEBUG("ipv6: reply to unsupported get/set\n");
+            msg_reply(msg, &reply);
+            break;
+        }
+
+        case GNRC_IPV6_NIB_SND_UC_NS:
+        case GNRC_IPV6_NIB_SND_MC_NS:
+        case GNRC_IPV6_NIB_SND_NA:
+        case GNRC_IPV6_NIB_SEARCH_RTR:
+        case GNRC_IPV6_NIB_REPLY_RS:
+        case GNRC_IPV6_NIB_SND_MC_RA:
+        case GNRC_IPV6_NIB_REACH_TIMEOUT:
+        case GNRC_IPV6_NIB_DELAY_TIMEOUT:
+        case GNRC_IPV6_NIB_ADDR_REG_TIMEOUT:
+        case GNRC_IPV6_NIB_ABR_TIMEOUT:
+        case GNRC_IPV6_NIB_PFX_TIMEOUT:
+        case GNRC_IPV6_NIB_RTR_TIMEOUT:
+        case GNRC_IPV6_NIB_RECALC_REACH_TIME:
+        case GNRC_IPV6_NIB_REREG_ADDRESS:
+        case GNRC_IPV6_NIB_DAD:
+        case GNRC_IPV6_NIB_VALID_ADDR:
+            DEBUG("ipv6: NIB timer event received\n");
+            gnrc_ipv6_nib_handle_timer_event(msg->content.ptr, msg->type);
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+#ifndef MODULE_GNRC_EVENT_LOOP
 static void *_event_loop(void *args)
 {
-    msg_t msg, reply, msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
+    msg_t msg_batch[GNRC_IPV6_MSG_BATCH_SIZE];
+    msg_t msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             sched_active_pid);
 
@@ -174,58 +282,19 @@ static void *_event_loop(void *args)
     /* register interest in all IPv6 packets */
     gnrc_netreg_register(GNRC_NETTYPE_IPV6, &me_reg);
 
-    /* preinitialize ACK */
-    reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
-
     /* start event loop */
     while (1) {
         DEBUG("ipv6: waiting for incoming message.\n");
-        msg_receive(&msg);
-
-        switch (msg.type) {
-            case GNRC_NETAPI_MSG_TYPE_RCV:
-                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV received\n");
-                _receive(msg.content.ptr);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_SND:
-                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
-                _send(msg.content.ptr, true);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_GET:
-            case GNRC_NETAPI_MSG_TYPE_SET:
-                DEBUG("ipv6: reply to unsupported get/set\n");
-                reply.content.value = -ENOTSUP;
-                msg_reply(&msg, &reply);
-                break;
-
-            case GNRC_IPV6_NIB_SND_UC_NS:
-            case GNRC_IPV6_NIB_SND_MC_NS:
-            case GNRC_IPV6_NIB_SND_NA:
-            case GNRC_IPV6_NIB_SEARCH_RTR:
-            case GNRC_IPV6_NIB_REPLY_RS:
-            case GNRC_IPV6_NIB_SND_MC_RA:
-            case GNRC_IPV6_NIB_REACH_TIMEOUT:
-            case GNRC_IPV6_NIB_DELAY_TIMEOUT:
-            case GNRC_IPV6_NIB_ADDR_REG_TIMEOUT:
-            case GNRC_IPV6_NIB_ABR_TIMEOUT:
-            case GNRC_IPV6_NIB_PFX_TIMEOUT:
-            case GNRC_IPV6_NIB_RTR_TIMEOUT:
-            case GNRC_IPV6_NIB_RECALC_REACH_TIME:
-            case GNRC_IPV6_NIB_REREG_ADDRESS:
-            case GNRC_IPV6_NIB_DAD:
-            case GNRC_IPV6_NIB_VALID_ADDR:
-                DEBUG("ipv6: NIB timer event received\n");
-                gnrc_ipv6_nib_handle_timer_event(msg.content.ptr, msg.type);
-                break;
-            default:
-                break;
+        int num = msg_receive_batch(msg_batch, GNRC_IPV6_MSG_BATCH_SIZE);
+
+        for (int i = 0; i < num; i++) {
+            _handle_msg(&msg_batch[i]);
         }
     }
 
     return NULL;
 }
+#endif
 
 static void _send_to_iface(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
@@ -265,7 +334,7 @@ static void _send_to_iface(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     }
 }
 
-static gnrc_pktsnip_t *_create_netif_hdr(uint8_t *dst_l2addr,
+static gnrc_pktsnip_t *_create_netif_hdr(const uint8_t *dst_l2addr,
                                          unsigned dst_l2addr_len,
                                          gnrc_pktsnip_t *pkt,
                                          uint8_t flags)
@@ -304,6 +373,10 @@ static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
     int res;
     ipv6_hdr_t *hdr = ipv6->data;
     gnrc_pktsnip_t *payload, *prev;
+#ifdef MODULE_GNRC_IPV6_EXT_RH
+    gnrc_pktsnip_t *rh = NULL;
+    uint8_t protnum;
+#endif
 
     hdr->len = byteorder_htons(gnrc_pkt_len(ipv6->next));
     DEBUG("ipv6: set payload length to %u (network byteorder %04" PRIx16 ")\n",
@@ -355,6 +428,9 @@ static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
     DEBUG("ipv6: write protect up to payload to calculate checksum\n");
     payload = ipv6;
     prev = ipv6;
+#ifdef MODULE_GNRC_IPV6_EXT_RH
+    protnum = hdr->nh;
+#endif
     while (_is_ipv6_hdr(payload) && (payload->next != NULL)) {
         /* IPv6 header itself was already write-protected in caller function,
          * just write protect extension headers and payload header */
@@ -366,6 +442,14 @@ static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
         }
         prev->next = payload;
         prev = payload;
+#ifdef MODULE_GNRC_IPV6_EXT_RH
+        if (payload->type == GNRC_NETTYPE_IPV6_EXT) {
+            if (protnum == PROTNUM_IPV6_EXT_RH) {
+                rh = payload;
+            }
+            protnum = ((ipv6_ext_t *)payload->data)->nh;
+        }
+#endif
     }
     DEBUG("ipv6: calculate checksum for upper header.\n");
     if ((res = gnrc_netreg_calc_csum(payload, ipv6)) < 0) {
@@ -375,6 +459,12 @@ static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
             return res;
         }
     }
+#ifdef MODULE_GNRC_IPV6_EXT_RH
+    else if (rh != NULL) {
+        /* checksum was calculated with the next hop in the pseudo-header */
+        gnrc_ipv6_ext_rh_update_csum(payload, hdr, rh->data);
+    }
+#endif
 
     return 0;
 }
@@ -390,26 +480,116 @@ static bool _safe_fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
     return true;
 }
 
+#ifdef MODULE_GNRC_IPV6_ROUTE_CACHE
+static _route_cache_t *_route_cache_slot(const ipv6_addr_t *dst)
+{
+    uint32_t hash = dst->u32[0].u32 ^ dst->u32[1].u32 ^
+                    dst->u32[2].u32 ^ dst->u32[3].u32;
+
+    return &_route_cache[((hash * 2654435761U) >> 16) %
+                         GNRC_IPV6_ROUTE_CACHE_SIZE];
+}
+
+static _route_cache_t *_route_cache_get(const ipv6_addr_t *dst,
+                                        kernel_pid_t req_iface)
+{
+    _route_cache_t *entry = _route_cache_slot(dst);
+
+    if ((entry->gen == gnrc_ipv6_route_cache_gen) &&
+        (entry->req_iface == req_iface) &&
+        ipv6_addr_equal(&entry->dst, dst)) {
+        return entry;
+    }
+    return NULL;
+}
+
+static void _route_cache_put(unsigned gen, kernel_pid_t req_iface,
+                             const ipv6_hdr_t *hdr, bool src_selected,
+                             const gnrc_ipv6_nib_nc_t *nce)
+{
+    _route_cache_t *entry = _route_cache_slot(&hdr->dst);
+
+    switch (gnrc_ipv6_nib_nc_get_nud_state(nce)) {
+        case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED:
+        case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE:
+            break;
+        default:
+            /* leave the next packets to neighbor unreachability detection */
+            return;
+    }
+    DEBUG("ipv6: caching route to %s\n",
+          ipv6_addr_to_str(addr_str, &hdr->dst, sizeof(addr_str)));
+    memcpy(&entry->dst, &hdr->dst, sizeof(entry->dst));
+    if (src_selected) {
+        memcpy(&entry->src, &hdr->src, sizeof(entry->src));
+    }
+    else {
+        ipv6_addr_set_unspecified(&entry->src);
+    }
+    entry->gen = gen;
+    entry->req_iface = req_iface;
+    entry->iface = gnrc_ipv6_nib_nc_get_iface(nce);
+    memcpy(entry->l2addr, nce->l2addr, nce->l2addr_len);
+    entry->l2addr_len = nce->l2addr_len;
+}
+#endif  /* MODULE_GNRC_IPV6_ROUTE_CACHE */
+
 /* functions for sending */
 static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                           gnrc_netif_t *netif, ipv6_hdr_t *ipv6_hdr,
                           uint8_t netif_hdr_flags)
 {
     gnrc_ipv6_nib_nc_t nce;
+    const uint8_t *l2addr;
+    unsigned l2addr_len;
+#ifdef MODULE_GNRC_IPV6_ROUTE_CACHE
+    /* taken before resolution, so changes during resolution invalidate the
+     * new entry */
+    unsigned gen = gnrc_ipv6_route_cache_gen;
+    kernel_pid_t req_iface = (netif != NULL) ? netif->pid : KERNEL_PID_UNDEF;
+    bool select_src = prep_hdr && ipv6_addr_is_unspecified(&ipv6_hdr->src);
+    _route_cache_t *cached = _route_cache_get(&ipv6_hdr->dst, req_iface);
+#endif
 
     DEBUG("ipv6: send unicast\n");
-    if (gnrc_ipv6_nib_get_next_hop_l2addr(&ipv6_hdr->dst, netif, pkt,
-                                          &nce) < 0) {
-        /* packet is released by NIB */
-        DEBUG("ipv6: no link-layer address or interface for next hop to %s",
+#ifdef MODULE_GNRC_IPV6_ROUTE_CACHE
+    if (cached != NULL) {
+        DEBUG("ipv6: route to %s cached\n",
               ipv6_addr_to_str(addr_str, &ipv6_hdr->dst, sizeof(addr_str)));
-        return;
+        netif = gnrc_netif_get_by_pid(cached->iface);
+        if (select_src && !ipv6_addr_is_unspecified(&cached->src)) {
+            memcpy(&ipv6_hdr->src, &cached->src, sizeof(ipv6_hdr->src));
+        }
+        l2addr = cached->l2addr;
+        l2addr_len = cached->l2addr_len;
+    }
+    else
+#endif  /* MODULE_GNRC_IPV6_ROUTE_CACHE */
+    {
+        if (gnrc_ipv6_nib_get_next_hop_l2addr(&ipv6_hdr->dst, netif, pkt,
+                                              &nce) < 0) {
+            /* packet is released by NIB */
+            DEBUG("ipv6: no link-layer address or interface for next hop to %s",
+                  ipv6_addr_to_str(addr_str, &ipv6_hdr->dst, sizeof(addr_str)));
+            return;
+        }
+        netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
+        l2addr = nce.l2addr;
+        l2addr_len = nce.l2addr_len;
     }
-    netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
     assert(netif != NULL);
     if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+#ifdef MODULE_GNRC_IPV6_ROUTE_CACHE
+        if (cached == NULL) {
+            _route_cache_put(gen, req_iface, ipv6_hdr, select_src, &nce);
+        }
+        else if (select_src && ipv6_addr_is_unspecified(&cached->src)) {
+            /* source address was not selected when the route was cached */
+            memcpy(&cached->src, &ipv6_hdr->src, sizeof(cached->src));
+        }
+#endif  /* MODULE_GNRC_IPV6_ROUTE_CACHE */
         DEBUG("ipv6: add interface header to packet\n");
-        if ((pkt = _create_netif_hdr(nce.l2addr, nce.l2addr_len, pkt,
+        if ((pkt = _create_netif_hdr(l2addr, l2addr_len, pkt,
                                      netif_hdr_flags)) == NULL) {
             return;
         }
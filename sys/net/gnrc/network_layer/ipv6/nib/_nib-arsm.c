@@ -156,6 +156,7 @@ void _handle_sl2ao(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
         if (!_rtr_sol_on_6lr(netif, icmpv6)) {
             nce->l2addr_len = l2addr_len;
             memcpy(nce->l2addr, sl2ao + 1, l2addr_len);
+            gnrc_ipv6_route_cache_invalidate();
         }
 #endif  /* GNRC_IPV6_NIB_CONF_ARSM */
     }
@@ -353,6 +354,7 @@ void _handle_adv_l2(gnrc_netif_t *netif, _nib_onl_entry_t *nce,
         else {
             nce->l2addr_len = 0;
         }
+        gnrc_ipv6_route_cache_invalidate();
         if (_sflag_set((ndp_nbr_adv_t *)icmpv6)) {
             _set_reachable(netif, nce);
         }
@@ -432,6 +434,7 @@ void _set_nud_state(gnrc_netif_t *netif, _nib_onl_entry_t *nce,
 {
     nce->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
     nce->info |= state;
+    gnrc_ipv6_route_cache_invalidate();
 
 #if GNRC_IPV6_NIB_CONF_ROUTER
     gnrc_netif_acquire(netif);
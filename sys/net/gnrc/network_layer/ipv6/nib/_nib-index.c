@@ -0,0 +1,339 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   Hash index of on-link entries and prefix trie of off-link entries
+ *
+ * On-link entries are indexed by their address in a hash table with open
+ * addressing and linear probing. Since _nib_onl_get() allows the interface to
+ * be left unspecified, the interface is not part of the key but compared when
+ * probing. Removal shifts the following entries of the probe sequence back,
+ * so no tombstones are needed.
+ *
+ * Off-link entries are indexed in a path-compressed binary trie over their
+ * prefixes. Entries with the same prefix hang off the same trie node, sorted
+ * by their position in the NIB, so lookups return the same entry as a linear
+ * scan would.
+ */
+
+#include <string.h>
+
+#include "net/gnrc/ipv6/nib/conf.h"
+
+#include "_nib-internal.h"
+
+#if GNRC_IPV6_NIB_CONF_INDEX
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#if GNRC_IPV6_NIB_INDEX_SIZE <= GNRC_IPV6_NIB_NUMOF
+#error "GNRC_IPV6_NIB_INDEX_SIZE must be larger than GNRC_IPV6_NIB_NUMOF"
+#endif
+
+/**
+ * @brief   Node of the off-link prefix trie
+ */
+typedef struct _offl_node {
+    struct _offl_node *child[2];    /**< subtrees for bit _offl_node::pfx_len */
+    struct _offl_node *dup;         /**< next node with the same prefix */
+    _nib_offl_entry_t *entry;       /**< entry, NULL for a branching node */
+    ipv6_addr_t pfx;                /**< prefix, masked to pfx_len */
+    uint8_t pfx_len;                /**< length of the prefix in bits */
+} _offl_node_t;
+
+static _nib_onl_entry_t *_onl_index[GNRC_IPV6_NIB_INDEX_SIZE];
+/* every entry needs at most one node for itself and one branching node */
+static _offl_node_t _offl_nodes[2 * GNRC_IPV6_NIB_OFFL_NUMOF];
+static _offl_node_t *_offl_root;
+static _offl_node_t *_offl_free;
+
+void _nib_index_init(void)
+{
+    memset(_onl_index, 0, sizeof(_onl_index));
+    _offl_root = NULL;
+    _offl_free = NULL;
+    for (unsigned i = 0; i < (2 * GNRC_IPV6_NIB_OFFL_NUMOF); i++) {
+        _offl_nodes[i].child[0] = _offl_free;
+        _offl_free = &_offl_nodes[i];
+    }
+}
+
+static inline unsigned _onl_hash(const ipv6_addr_t *addr)
+{
+    uint32_t hash = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                    addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    /* multiplicative hashing to spread the bits of the IID */
+    return ((hash * 2654435761U) >> 16) % GNRC_IPV6_NIB_INDEX_SIZE;
+}
+
+static inline unsigned _onl_next(unsigned slot)
+{
+    return (slot + 1) % GNRC_IPV6_NIB_INDEX_SIZE;
+}
+
+void _nib_onl_index_add(_nib_onl_entry_t *node)
+{
+    unsigned slot;
+
+    if (ipv6_addr_is_unspecified(&node->ipv6)) {
+        return;
+    }
+    for (slot = _onl_hash(&node->ipv6); _onl_index[slot] != NULL;
+         slot = _onl_next(slot)) {
+        if (_onl_index[slot] == node) {
+            return;
+        }
+    }
+    DEBUG("nib: indexing on-link entry %p in slot %u\n", (void *)node, slot);
+    _onl_index[slot] = node;
+}
+
+void _nib_onl_index_del(_nib_onl_entry_t *node)
+{
+    unsigned slot;
+
+    if (ipv6_addr_is_unspecified(&node->ipv6)) {
+        return;
+    }
+    for (slot = _onl_hash(&node->ipv6); _onl_index[slot] != node;
+         slot = _onl_next(slot)) {
+        if (_onl_index[slot] == NULL) {
+            return;
+        }
+    }
+    DEBUG("nib: removing on-link entry %p from slot %u\n", (void *)node, slot);
+    /* move entries that would not be found anymore into the gap */
+    for (unsigned next = _onl_next(slot); _onl_index[next] != NULL;
+         next = _onl_next(next)) {
+        unsigned home = _onl_hash(&_onl_index[next]->ipv6);
+
+        /* entry stays if its home slot lies cyclically in (slot, next] */
+        if ((slot < next) ? ((slot < home) && (home <= next))
+                          : ((slot < home) || (home <= next))) {
+            continue;
+        }
+        _onl_index[slot] = _onl_index[next];
+        slot = next;
+    }
+    _onl_index[slot] = NULL;
+}
+
+_nib_onl_entry_t *_nib_onl_index_get(const ipv6_addr_t *addr, unsigned iface)
+{
+    _nib_onl_entry_t *res = NULL;
+
+    assert(!ipv6_addr_is_unspecified(addr));
+    for (unsigned slot = _onl_hash(addr); _onl_index[slot] != NULL;
+         slot = _onl_next(slot)) {
+        _nib_onl_entry_t *node = _onl_index[slot];
+
+        if ((node->mode != _EMPTY) &&
+            ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
+             (_nib_onl_get_if(node) == iface)) &&
+            ipv6_addr_equal(&node->ipv6, addr) &&
+            /* the linear search would return the first entry in the NIB */
+            ((res == NULL) || (node < res))) {
+            res = node;
+        }
+    }
+    return res;
+}
+
+static inline unsigned _bit(const ipv6_addr_t *addr, unsigned pos)
+{
+    return (addr->u8[pos >> 3] >> (7 - (pos & 0x7))) & 0x1;
+}
+
+static inline unsigned _common_bits(const ipv6_addr_t *a, const ipv6_addr_t *b,
+                                    unsigned max)
+{
+    unsigned common = ipv6_addr_match_prefix(a, b);
+
+    return (common < max) ? common : max;
+}
+
+static _offl_node_t *_offl_node_alloc(const ipv6_addr_t *pfx, unsigned pfx_len,
+                                      _nib_offl_entry_t *entry)
+{
+    _offl_node_t *node = _offl_free;
+
+    /* the pool is sized so that it can't run out */
+    assert(node != NULL);
+    _offl_free = node->child[0];
+    memset(node, 0, sizeof(_offl_node_t));
+    node->entry = entry;
+    ipv6_addr_init_prefix(&node->pfx, pfx, pfx_len);
+    node->pfx_len = pfx_len;
+    return node;
+}
+
+static void _offl_node_free(_offl_node_t *node)
+{
+    node->child[0] = _offl_free;
+    _offl_free = node;
+}
+
+/* removes the node at *link if it neither holds an entry nor branches */
+static void _offl_compress(_offl_node_t **link)
+{
+    _offl_node_t *node = *link;
+
+    if ((node->entry != NULL) ||
+        ((node->child[0] != NULL) && (node->child[1] != NULL))) {
+        return;
+    }
+    *link = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+    _offl_node_free(node);
+}
+
+void _nib_offl_index_add(_nib_offl_entry_t *dst)
+{
+    const ipv6_addr_t *pfx = &dst->pfx;
+    unsigned pfx_len = dst->pfx_len;
+    _offl_node_t **link = &_offl_root;
+
+    while (*link != NULL) {
+        _offl_node_t *node = *link;
+        unsigned common = _common_bits(&node->pfx, pfx,
+                                       (node->pfx_len < pfx_len) ? node->pfx_len
+                                                                 : pfx_len);
+
+        if (common == node->pfx_len) {
+            if (node->pfx_len < pfx_len) {
+                link = &node->child[_bit(pfx, node->pfx_len)];
+                continue;
+            }
+            if (node->entry == NULL) {
+                node->entry = dst;
+                return;
+            }
+            /* keep entries with the same prefix in NIB order */
+            _offl_node_t *dup = _offl_node_alloc(pfx, pfx_len, dst);
+
+            if (dst < node->entry) {
+                dup->entry = node->entry;
+                node->entry = dst;
+            }
+            while ((node->dup != NULL) && (node->dup->entry < dup->entry)) {
+                node = node->dup;
+            }
+            dup->dup = node->dup;
+            node->dup = dup;
+            return;
+        }
+
+        _offl_node_t *leaf = _offl_node_alloc(pfx, pfx_len, dst);
+
+        if (common == pfx_len) {
+            /* the new prefix covers the node's prefix */
+            leaf->child[_bit(&node->pfx, pfx_len)] = node;
+            *link = leaf;
+            return;
+        }
+        /* the prefixes diverge at bit `common` */
+        _offl_node_t *branch = _offl_node_alloc(pfx, common, NULL);
+        unsigned bit = _bit(pfx, common);
+
+        branch->child[bit] = leaf;
+        branch->child[!bit] = node;
+        *link = branch;
+        return;
+    }
+    *link = _offl_node_alloc(pfx, pfx_len, dst);
+}
+
+void _nib_offl_index_del(_nib_offl_entry_t *dst)
+{
+    const ipv6_addr_t *pfx = &dst->pfx;
+    unsigned pfx_len = dst->pfx_len;
+    _offl_node_t **parent_link = NULL;
+    _offl_node_t **link = &_offl_root;
+    _offl_node_t *node;
+
+    while ((*link != NULL) && ((*link)->pfx_len < pfx_len)) {
+        parent_link = link;
+        link = &(*link)->child[_bit(pfx, (*link)->pfx_len)];
+    }
+    node = *link;
+    if ((node == NULL) || (node->pfx_len != pfx_len)) {
+        DEBUG("nib: off-link entry %p not indexed\n", (void *)dst);
+        return;
+    }
+    for (_offl_node_t **dup = &node->dup; *dup != NULL; dup = &(*dup)->dup) {
+        if ((*dup)->entry == dst) {
+            _offl_node_t *tmp = *dup;
+
+            *dup = tmp->dup;
+            _offl_node_free(tmp);
+            return;
+        }
+    }
+    if (node->entry != dst) {
+        DEBUG("nib: off-link entry %p not indexed\n", (void *)dst);
+        return;
+    }
+    if (node->dup != NULL) {
+        _offl_node_t *tmp = node->dup;
+
+        node->entry = tmp->entry;
+        node->dup = tmp->dup;
+        _offl_node_free(tmp);
+        return;
+    }
+    node->entry = NULL;
+    _offl_compress(link);
+    if (parent_link != NULL) {
+        _offl_compress(parent_link);
+    }
+}
+
+_nib_offl_entry_t *_nib_offl_index_match(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+    _offl_node_t *node = _offl_root;
+    unsigned best_match = 0;
+
+    /* The nodes on the path to dst are exactly the entries whose prefix
+     * matches dst. Among them, pick the same entry as the linear search in
+     * _nib_offl_get_match() would: the one sharing the most bits with dst,
+     * and of those the first one in the NIB. This is not necessarily the one
+     * with the longest prefix, as bits beyond the prefix length count, too. */
+    while ((node != NULL) &&
+           (_common_bits(&node->pfx, dst, node->pfx_len) == node->pfx_len)) {
+        for (_offl_node_t *n = node; (n != NULL) && (n->entry != NULL);
+             n = n->dup) {
+            _nib_offl_entry_t *entry = n->entry;
+
+            if (entry->mode != _EMPTY) {
+                unsigned match = ipv6_addr_match_prefix(&entry->pfx, dst);
+
+                if ((match > best_match) ||
+                    ((match == best_match) && (res != NULL) && (entry < res))) {
+                    res = entry;
+                    best_match = match;
+                }
+            }
+        }
+        if (node->pfx_len == IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+        node = node->child[_bit(dst, node->pfx_len)];
+    }
+    return res;
+}
+
+#else   /* GNRC_IPV6_NIB_CONF_INDEX */
+typedef int dont_be_pedantic;
+#endif  /* GNRC_IPV6_NIB_CONF_INDEX */
+
+/** @} */
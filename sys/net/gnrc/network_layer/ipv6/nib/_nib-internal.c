@@ -48,6 +48,7 @@ static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 mutex_t _nib_mutex = MUTEX_INIT;
 evtimer_msg_t _nib_evtimer;
 
+static void _set_addr(_nib_onl_entry_t *node, const ipv6_addr_t *addr);
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node);
 static inline bool _node_unreachable(_nib_onl_entry_t *node);
@@ -64,6 +65,9 @@ void _nib_init(void)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* GNRC_IPV6_NIB_CONF_MULTIHOP_P6C */
 #endif  /* TEST_SUITES */
+#if GNRC_IPV6_NIB_CONF_INDEX
+    _nib_index_init();
+#endif  /* GNRC_IPV6_NIB_CONF_INDEX */
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
 }
@@ -180,6 +184,7 @@ _nib_onl_entry_t *_nib_nc_add(const ipv6_addr_t *addr, unsigned iface,
         /* masked above already */
         node->info |= cstate;
         node->mode |= _NC;
+        gnrc_ipv6_route_cache_invalidate();
     }
     if (node->next == NULL) {
         DEBUG("nib: queueing (addr = %s, iface = %u) for potential removal\n",
@@ -209,6 +214,15 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if GNRC_IPV6_NIB_CONF_INDEX
+    /* entries without an address are not indexed */
+    if (!ipv6_addr_is_unspecified(addr)) {
+        _nib_onl_entry_t *node = _nib_onl_index_get(addr, iface);
+
+        DEBUG("  Found %p\n", (void *)node);
+        return node;
+    }
+#endif  /* GNRC_IPV6_NIB_CONF_INDEX */
     for (unsigned i = 0; i < GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
@@ -233,6 +247,7 @@ void _nib_nc_set_reachable(_nib_onl_entry_t *node)
 
     node->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
     node->info |= GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE;
+    gnrc_ipv6_route_cache_invalidate();
 #ifdef TEST_SUITES
     /* exit early for unittests */
     if (netif == NULL) {
@@ -255,6 +270,7 @@ void _nib_nc_remove(_nib_onl_entry_t *node)
           ipv6_addr_to_str(addr_str, &node->ipv6, sizeof(addr_str)),
           _nib_onl_get_if(node));
     node->mode &= ~(_NC);
+    gnrc_ipv6_route_cache_invalidate();
     evtimer_del((evtimer_t *)&_nib_evtimer, &node->snd_na.event);
 #if GNRC_IPV6_NIB_CONF_ARSM
     evtimer_del((evtimer_t *)&_nib_evtimer, &node->nud_timeout.event);
@@ -359,6 +375,7 @@ _nib_dr_entry_t *_nib_drl_add(const ipv6_addr_t *router_addr, unsigned iface)
         }
         _override_node(router_addr, iface, def_router->next_hop);
         def_router->next_hop->mode |= _DRL;
+        gnrc_ipv6_route_cache_invalidate();
     }
     return def_router;
 }
@@ -373,6 +390,7 @@ void _nib_drl_remove(_nib_dr_entry_t *nib_dr)
     if (nib_dr == _prime_def_router) {
         _prime_def_router = NULL;
     }
+    gnrc_ipv6_route_cache_invalidate();
 }
 
 _nib_dr_entry_t *_nib_drl_iter(const _nib_dr_entry_t *last)
@@ -481,7 +499,7 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
             /* exact match (or next hop address was previously unset) */
             DEBUG("  %p is an exact match\n", (void *)tmp);
             if (next_hop != NULL) {
-                memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+                _set_addr(tmp_node, next_hop);
             }
             tmp->next_hop->mode |= _DST;
             return tmp;
@@ -502,6 +520,10 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+#if GNRC_IPV6_NIB_CONF_INDEX
+        _nib_offl_index_add(dst);
+#endif  /* GNRC_IPV6_NIB_CONF_INDEX */
+        gnrc_ipv6_route_cache_invalidate();
     }
     return dst;
 }
@@ -533,7 +555,11 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+#if GNRC_IPV6_NIB_CONF_INDEX
+        _nib_offl_index_del(dst);
+#endif  /* GNRC_IPV6_NIB_CONF_INDEX */
         memset(dst, 0, sizeof(_nib_offl_entry_t));
+        gnrc_ipv6_route_cache_invalidate();
     }
 }
 
@@ -558,11 +584,14 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
 
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
+    DEBUG("nib: get match for destination %s from NIB\n",
+          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+#if GNRC_IPV6_NIB_CONF_INDEX
+    return _nib_offl_index_match(dst);
+#else   /* GNRC_IPV6_NIB_CONF_INDEX */
     _nib_offl_entry_t *res = NULL;
     uint8_t best_match = 0;
 
-    DEBUG("nib: get match for destination %s from NIB\n",
-          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -583,6 +612,7 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
         }
     }
     return res;
+#endif  /* GNRC_IPV6_NIB_CONF_INDEX */
 }
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
@@ -805,12 +835,24 @@ _nib_offl_entry_t *_nib_pl_add(unsigned iface,
     return dst;
 }
 
+static void _set_addr(_nib_onl_entry_t *node, const ipv6_addr_t *addr)
+{
+#if GNRC_IPV6_NIB_CONF_INDEX
+    /* the index finds entries by their address */
+    _nib_onl_index_del(node);
+    memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+    _nib_onl_index_add(node);
+#else   /* GNRC_IPV6_NIB_CONF_INDEX */
+    memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+#endif  /* GNRC_IPV6_NIB_CONF_INDEX */
+}
+
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node)
 {
     _nib_onl_clear(node);
     if (addr != NULL) {
-        memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+        _set_addr(node, addr);
     }
     _nib_onl_set_if(node, iface);
 }
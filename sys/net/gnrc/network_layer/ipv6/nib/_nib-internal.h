@@ -33,6 +33,7 @@
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
 #endif
+#include "net/gnrc/ipv6/route_cache.h"
 #include "net/gnrc/ipv6/nib/ft.h"
 #include "net/gnrc/ipv6/nib/nc.h"
 #include "net/gnrc/ipv6/nib/conf.h"
@@ -304,6 +305,91 @@ static inline void _nib_onl_set_if(_nib_onl_entry_t *node, unsigned iface)
  */
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 
+#if GNRC_IPV6_NIB_CONF_INDEX || defined(DOXYGEN)
+/**
+ * @brief   Empties the hash index of on-link entries and the prefix trie of
+ *          off-link entries
+ *
+ * @note    Only available if @ref GNRC_IPV6_NIB_CONF_INDEX.
+ */
+void _nib_index_init(void);
+
+/**
+ * @brief   Adds an on-link entry to the hash index
+ *
+ * Entries with the unspecified address are not indexed. The address of an
+ * entry must not change while it is in the index.
+ *
+ * @note    Only available if @ref GNRC_IPV6_NIB_CONF_INDEX.
+ *
+ * @param[in] node  An entry.
+ */
+void _nib_onl_index_add(_nib_onl_entry_t *node);
+
+/**
+ * @brief   Removes an on-link entry from the hash index
+ *
+ * @note    Only available if @ref GNRC_IPV6_NIB_CONF_INDEX.
+ *
+ * @param[in] node  An entry. May not be in the index.
+ */
+void _nib_onl_index_del(_nib_onl_entry_t *node);
+
+/**
+ * @brief   Gets a node by IPv6 address and interface from the hash index
+ *
+ * @pre     `(addr != NULL) && !ipv6_addr_is_unspecified(addr)`
+ *
+ * @note    Only available if @ref GNRC_IPV6_NIB_CONF_INDEX.
+ *
+ * @param[in] addr  The address of a node.
+ * @param[in] iface The interface to the node. May be 0 for any interface.
+ *
+ * @return  The first entry in the NIB matching @p addr and @p iface
+ *          (see _nib_onl_get()).
+ * @return  NULL, if there is no such entry.
+ */
+_nib_onl_entry_t *_nib_onl_index_get(const ipv6_addr_t *addr, unsigned iface);
+
+/**
+ * @brief   Adds an off-link entry to the prefix trie
+ *
+ * @note    Only available if @ref GNRC_IPV6_NIB_CONF_INDEX.
+ *
+ * @param[in] dst   An entry with _nib_offl_entry_t::pfx and
+ *                  _nib_offl_entry_t::pfx_len set.
+ */
+void _nib_offl_index_add(_nib_offl_entry_t *dst);
+
+/**
+ * @brief   Removes an off-link entry from the prefix trie
+ *
+ * @note    Only available if @ref GNRC_IPV6_NIB_CONF_INDEX.
+ *
+ * @param[in] dst   An entry, with _nib_offl_entry_t::pfx and
+ *                  _nib_offl_entry_t::pfx_len still set.
+ */
+void _nib_offl_index_del(_nib_offl_entry_t *dst);
+
+/**
+ * @brief   Gets the off-link entry best matching a destination from the
+ *          prefix trie
+ *
+ * Selects the same entry as the linear search without
+ * @ref GNRC_IPV6_NIB_CONF_INDEX: of all entries whose prefix matches @p dst,
+ * the one whose _nib_offl_entry_t::pfx shares the most bits with @p dst and,
+ * of those, the first one in the NIB.
+ *
+ * @note    Only available if @ref GNRC_IPV6_NIB_CONF_INDEX.
+ *
+ * @param[in] dst   A destination address.
+ *
+ * @return  The best matching entry for @p dst.
+ * @return  NULL, if no prefix matches.
+ */
+_nib_offl_entry_t *_nib_offl_index_match(const ipv6_addr_t *dst);
+#endif  /* GNRC_IPV6_NIB_CONF_INDEX */
+
 /**
  * @brief   Clears out a NIB entry (on-link version)
  *
@@ -315,7 +401,11 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
     if (node->mode == _EMPTY) {
+#if GNRC_IPV6_NIB_CONF_INDEX
+        _nib_onl_index_del(node);
+#endif  /* GNRC_IPV6_NIB_CONF_INDEX */
         memset(node, 0, sizeof(_nib_onl_entry_t));
+        gnrc_ipv6_route_cache_invalidate();
         return true;
     }
     return false;
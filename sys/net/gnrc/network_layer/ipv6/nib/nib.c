@@ -1263,6 +1263,7 @@ static void _handle_pfx_timeout(_nib_offl_entry_t *pfx)
                                        &pfx->pfx) >= pfx->pfx_len) {
                 netif->ipv6.addrs_flags[i] &= ~GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_MASK;
                 netif->ipv6.addrs_flags[i] |= GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_DEPRECATED;
+                gnrc_ipv6_route_cache_invalidate();
             }
         }
         _evtimer_add(pfx, GNRC_IPV6_NIB_PFX_TIMEOUT, &pfx->pfx_timeout,
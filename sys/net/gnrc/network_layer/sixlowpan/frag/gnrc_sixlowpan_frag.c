@@ -21,6 +21,9 @@
 #include "net/gnrc/netapi.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/sixlowpan/frag.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+#include "net/gnrc/sixlowpan/frag/sfr.h"
+#endif
 #include "net/gnrc/sixlowpan/internal.h"
 #include "net/gnrc/netif.h"
 #include "net/sixlowpan.h"
@@ -277,6 +280,20 @@ gnrc_sixlowpan_msg_frag_t *gnrc_sixlowpan_msg_frag_get(void)
     return NULL;
 }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+gnrc_sixlowpan_msg_frag_t *gnrc_sixlowpan_msg_frag_get_sfr(uint8_t tag)
+{
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_MSG_FRAG_SIZE; i++) {
+        if ((_fragment_msg[i].pkt != NULL) &&
+            (_fragment_msg[i].sfr.frags > 0) &&
+            (_fragment_msg[i].tag == tag)) {
+            return &_fragment_msg[i];
+        }
+    }
+    return NULL;
+}
+#endif
+
 void gnrc_sixlowpan_frag_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
 {
     assert(ctx != NULL);
@@ -301,6 +318,11 @@ void gnrc_sixlowpan_frag_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
         return;
     }
 #endif
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    if (gnrc_sixlowpan_frag_sfr_send(iface, fragment_msg, payload_len)) {
+        return;
+    }
+#endif
 
     /* Check whether to send the first or an Nth fragment */
     if (fragment_msg->offset == 0) {
@@ -367,14 +389,6 @@ uint16_t gnrc_sixlowpan_frag_next_tag(void)
 
 void gnrc_sixlowpan_frag_rbuf_base_rm(gnrc_sixlowpan_rbuf_base_t *entry)
 {
-    while (entry->ints != NULL) {
-        gnrc_sixlowpan_rbuf_int_t *next = entry->ints->next;
-
-        entry->ints->start = 0;
-        entry->ints->end = 0;
-        entry->ints->next = NULL;
-        entry->ints = next;
-    }
     entry->datagram_size = 0;
 }
 
@@ -383,6 +397,23 @@ void gnrc_sixlowpan_frag_rbuf_gc(void)
     rbuf_gc();
 }
 
+int gnrc_sixlowpan_frag_rbuf_add(gnrc_netif_hdr_t *netif_hdr,
+                                 gnrc_pktsnip_t *frag, size_t hdr_len,
+                                 size_t offset, size_t datagram_size,
+                                 uint16_t tag, unsigned page)
+{
+    return rbuf_add_frag(netif_hdr, frag, hdr_len, offset, datagram_size, tag,
+                         page);
+}
+
+bool gnrc_sixlowpan_frag_rbuf_int_get(const gnrc_sixlowpan_rbuf_t *rbuf,
+                                      uint16_t from,
+                                      gnrc_sixlowpan_rbuf_int_t *interval)
+{
+    assert((rbuf != NULL) && (interval != NULL));
+    return rbuf_int_get(rbuf, from, interval);
+}
+
 void gnrc_sixlowpan_frag_rbuf_remove(gnrc_sixlowpan_rbuf_t *rbuf)
 {
     assert(rbuf != NULL);
@@ -416,6 +447,9 @@ void gnrc_sixlowpan_frag_rbuf_dispatch_when_complete(gnrc_sixlowpan_rbuf_t *rbuf
         new_netif_hdr->flags = netif_hdr->flags;
         new_netif_hdr->lqi = netif_hdr->lqi;
         new_netif_hdr->rssi = netif_hdr->rssi;
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+        gnrc_sixlowpan_frag_sfr_rbuf_complete(&rbuf->super);
+#endif
         LL_APPEND(rbuf->pkt, netif);
         gnrc_sixlowpan_dispatch_recv(rbuf->pkt, NULL, 0);
         gnrc_sixlowpan_frag_rbuf_remove(rbuf);
@@ -12,40 +12,59 @@
  * @file
  */
 
+#include <errno.h>
 #include <inttypes.h>
 #include <stdbool.h>
+#include <string.h>
 
+#include "bitfield.h"
 #include "rbuf.h"
 #include "net/ipv6.h"
 #include "net/ipv6/hdr.h"
 #include "net/gnrc.h"
 #include "net/gnrc/sixlowpan.h"
 #include "net/gnrc/sixlowpan/frag.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#endif
 #include "net/sixlowpan.h"
 #include "thread.h"
 #include "xtimer.h"
-#include "utlist.h"
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
-/* estimated fragment payload size to determinate RBUF_INT_SIZE, default to
- * MAC payload size - fragment header. */
-#ifndef GNRC_SIXLOWPAN_FRAG_SIZE
-/* assuming 64-bit source/destination address, source PAN ID omitted */
-#define GNRC_SIXLOWPAN_FRAG_SIZE (104 - 5)
+#ifndef RBUF_HASH_SIZE
+/**
+ * @brief   Number of buckets of the hash index over the reassembly buffer
+ */
+#define RBUF_HASH_SIZE      (RBUF_SIZE)
 #endif
 
-#ifndef RBUF_INT_SIZE
-/* same as ((int) ceil((double) N / D)) */
-#define DIV_CEIL(N, D) (((N) + (D) - 1) / (D))
-#define RBUF_INT_SIZE (DIV_CEIL(IPV6_MIN_MTU, GNRC_SIXLOWPAN_FRAG_SIZE) * RBUF_SIZE)
+#if (RBUF_SIZE >= UINT8_MAX)
+#error "GNRC_SIXLOWPAN_FRAG_RBUF_SIZE must be smaller than 255"
 #endif
 
-static gnrc_sixlowpan_rbuf_int_t rbuf_int[RBUF_INT_SIZE];
+/* 0 marks the end of a list, so entries are referenced by index + 1 */
+#define RBUF_NONE           (0U)
 
 static gnrc_sixlowpan_rbuf_t rbuf[RBUF_SIZE];
 
+/**
+ * @brief   Links of a reassembly buffer entry to the rest of the buffer
+ */
+static struct {
+    uint8_t bucket_next;    /**< next entry in the same hash bucket */
+    uint8_t older;          /**< next older entry or next free entry */
+    uint8_t newer;          /**< next newer entry */
+} _links[RBUF_SIZE];
+
+static uint8_t _buckets[RBUF_HASH_SIZE];    /**< first entry of each bucket */
+static uint8_t _oldest;                     /**< least recently updated entry */
+static uint8_t _newest;                     /**< most recently updated entry */
+static uint8_t _free;                       /**< first free entry */
+static uint8_t _used;                       /**< entries that were ever used */
+
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
 static xtimer_t _gc_timer;
@@ -54,14 +73,9 @@ static msg_t _gc_timer_msg = { .type = GNRC_SIXLOWPAN_MSG_FRAG_GC_RBUF };
 /* ------------------------------------
  * internal function definitions
  * ------------------------------------*/
-/* checks whether start and end overlaps, but not identical to, given interval i */
-static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_rbuf_int_t *i,
-                                               uint16_t start, uint16_t end);
-/* gets a free entry from interval buffer */
-static gnrc_sixlowpan_rbuf_int_t *_rbuf_int_get_free(void);
-/* update interval buffer of entry */
-static bool _rbuf_update_ints(gnrc_sixlowpan_rbuf_base_t *entry,
-                              uint16_t offset, size_t frag_size);
+/* marks the units of a fragment as received */
+static void _rbuf_mark(gnrc_sixlowpan_rbuf_t *entry, uint16_t offset,
+                       size_t frag_size);
 /* gets an entry identified by its tupel */
 static gnrc_sixlowpan_rbuf_t *_rbuf_get(const void *src, size_t src_len,
                                         const void *dst, size_t dst_len,
@@ -70,6 +84,10 @@ static gnrc_sixlowpan_rbuf_t *_rbuf_get(const void *src, size_t src_len,
 /* internal add to repeat add when fragments overlapped */
 static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                      size_t offset, unsigned page);
+/* adds the payload of a fragment with a fragment header of hdr_len bytes */
+static int _rbuf_add_frag(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
+                          size_t hdr_len, size_t offset, size_t datagram_size,
+                          uint16_t tag, unsigned page);
 
 /* status codes for _rbuf_add() */
 enum {
@@ -77,32 +95,137 @@ enum {
     RBUF_ADD_ERROR,
     RBUF_ADD_REPEAT,
     RBUF_ADD_DUPLICATE,
+    RBUF_ADD_NOSPACE,
 };
 
-static int _check_fragments(gnrc_sixlowpan_rbuf_base_t *entry,
-                            size_t frag_size, size_t offset)
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+static int _rbuf_forward(gnrc_sixlowpan_frag_vrb_t *vrb, gnrc_pktsnip_t *pkt,
+                         size_t offset)
 {
-    gnrc_sixlowpan_rbuf_int_t *ptr = entry->ints;
+    gnrc_pktsnip_t *netif = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
 
-    /* If the fragment overlaps another fragment and differs in either the size
-     * or the offset of the overlapped fragment, discards the datagram
-     * https://tools.ietf.org/html/rfc4944#section-5.3 */
-    while (ptr != NULL) {
-        if (_rbuf_int_overlap_partially(ptr, offset, offset + frag_size - 1)) {
+    if (offset == 0) {
+        /* the first fragment was already forwarded with a new header */
+        DEBUG("6lo rbuf: first fragment already forwarded\n");
+        gnrc_pktbuf_release(pkt);
+        return RBUF_ADD_DUPLICATE;
+    }
+    DEBUG("6lo rbuf: forward fragment (offset = %u)\n", (unsigned)offset);
+    if (netif != NULL) {
+        pkt = gnrc_pktbuf_remove_snip(pkt, netif);
+    }
+    gnrc_sixlowpan_frag_vrb_send(vrb, pkt,
+                                 pkt->size - sizeof(sixlowpan_frag_n_t));
+    return RBUF_ADD_SUCCESS;
+}
+#endif
 
-            /* "A fresh reassembly may be commenced with the most recently
-             * received link fragment"
-             * https://tools.ietf.org/html/rfc4944#section-5.3 */
-            return RBUF_ADD_REPEAT;
+static inline unsigned _idx(const gnrc_sixlowpan_rbuf_t *entry)
+{
+    return (entry - rbuf) + 1;
+}
+
+static inline gnrc_sixlowpan_rbuf_t *_entry(unsigned idx)
+{
+    return (idx == RBUF_NONE) ? NULL : &rbuf[idx - 1];
+}
+
+static unsigned _hash(const uint8_t *src, size_t src_len,
+                      const uint8_t *dst, size_t dst_len,
+                      size_t size, uint16_t tag)
+{
+    /* djb2 over the tupel identifying a datagram */
+    uint32_t hash = 5381 + ((uint32_t)size << 16) + tag;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = ((hash << 5) + hash) ^ src[i];
+    }
+    for (unsigned i = 0; i < dst_len; i++) {
+        hash = ((hash << 5) + hash) ^ dst[i];
+    }
+    return hash % RBUF_HASH_SIZE;
+}
+
+static inline uint8_t *_bucket(const gnrc_sixlowpan_rbuf_t *entry)
+{
+    return &_buckets[_hash(entry->super.src, entry->super.src_len,
+                           entry->super.dst, entry->super.dst_len,
+                           entry->super.datagram_size, entry->super.tag)];
+}
+
+/* removes entry from the list of entries sorted by age */
+static void _age_unlink(unsigned idx)
+{
+    unsigned older = _links[idx - 1].older, newer = _links[idx - 1].newer;
+
+    if (older == RBUF_NONE) {
+        _oldest = newer;
+    }
+    else {
+        _links[older - 1].newer = newer;
+    }
+    if (newer == RBUF_NONE) {
+        _newest = older;
+    }
+    else {
+        _links[newer - 1].older = older;
+    }
+}
+
+/* makes entry the newest in the list of entries sorted by age */
+static void _age_append(unsigned idx)
+{
+    _links[idx - 1].older = _newest;
+    _links[idx - 1].newer = RBUF_NONE;
+    if (_newest == RBUF_NONE) {
+        _oldest = idx;
+    }
+    else {
+        _links[_newest - 1].newer = idx;
+    }
+    _newest = idx;
+}
+
+static int _check_fragments(gnrc_sixlowpan_rbuf_t *entry,
+                            size_t frag_size, size_t offset)
+{
+    unsigned first = offset / 8U, last = (offset + frag_size - 1) / 8U;
+    bool overlaps = false;
+    /* a fragment is identical to a received one if it starts where a
+     * received fragment starts and ends where that fragment ends */
+    bool identical = bf_isset(entry->starts, first);
+
+    for (unsigned i = first; i <= last; i++) {
+        if (bf_isset(entry->received, i)) {
+            overlaps = true;
+        }
+        else {
+            identical = false;
         }
-        /* End was already checked in overlap check */
-        if (ptr->start == offset) {
-            DEBUG("6lo rbuf: fragment already in reassembly buffer");
-            return RBUF_ADD_DUPLICATE;
+        if ((i > first) && bf_isset(entry->starts, i)) {
+            identical = false;
         }
-        ptr = ptr->next;
     }
-    return RBUF_ADD_SUCCESS;
+    if (!overlaps) {
+        return RBUF_ADD_SUCCESS;
+    }
+    if (identical && ((last + 1U) < GNRC_SIXLOWPAN_FRAG_RBUF_UNITS) &&
+        bf_isset(entry->received, last + 1U) &&
+        !bf_isset(entry->starts, last + 1U)) {
+        /* received fragment is longer */
+        identical = false;
+    }
+    /* If the fragment overlaps another fragment and differs in either the size
+     * or the offset of the overlapped fragment, discards the datagram
+     * https://tools.ietf.org/html/rfc4944#section-5.3 */
+    if (!identical) {
+        /* "A fresh reassembly may be commenced with the most recently
+         * received link fragment"
+         * https://tools.ietf.org/html/rfc4944#section-5.3 */
+        return RBUF_ADD_REPEAT;
+    }
+    DEBUG("6lo rbuf: fragment already in reassembly buffer");
+    return RBUF_ADD_DUPLICATE;
 }
 
 void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
@@ -116,10 +239,7 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
 static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                      size_t offset, unsigned page)
 {
-    gnrc_sixlowpan_rbuf_t *entry;
     sixlowpan_frag_n_t *frag = pkt->data;
-    uint8_t *data = ((uint8_t *)pkt->data) + sizeof(sixlowpan_frag_t);
-    size_t frag_size;
 
     /* check if provided offset is the same as in fragment */
     assert(((((frag->disp_size.u8[0] & SIXLOWPAN_FRAG_DISP_MASK) ==
@@ -127,30 +247,80 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
            ((((frag->disp_size.u8[0] & SIXLOWPAN_FRAG_DISP_MASK) ==
                 SIXLOWPAN_FRAG_N_DISP)) && (offset == (frag->offset * 8U))));
     rbuf_gc();
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    gnrc_sixlowpan_frag_vrb_t *vrb = gnrc_sixlowpan_frag_vrb_get(
+            gnrc_netif_hdr_get_src_addr(netif_hdr), netif_hdr->src_l2addr_len,
+            gnrc_netif_hdr_get_dst_addr(netif_hdr), netif_hdr->dst_l2addr_len,
+            byteorder_ntohs(frag->disp_size) & SIXLOWPAN_FRAG_SIZE_MASK,
+            byteorder_ntohs(frag->tag));
+
+    if (vrb != NULL) {
+        return _rbuf_forward(vrb, pkt, offset);
+    }
+#endif
+    return _rbuf_add_frag(netif_hdr, pkt,
+                          (offset == 0) ? sizeof(sixlowpan_frag_t)
+                                        : sizeof(sixlowpan_frag_n_t),
+                          offset,
+                          byteorder_ntohs(frag->disp_size) &
+                          SIXLOWPAN_FRAG_SIZE_MASK,
+                          byteorder_ntohs(frag->tag), page);
+}
+
+int rbuf_add_frag(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *frag,
+                  size_t hdr_len, size_t offset, size_t datagram_size,
+                  uint16_t tag, unsigned page)
+{
+    int res;
+
+    rbuf_gc();
+    res = _rbuf_add_frag(netif_hdr, frag, hdr_len, offset, datagram_size, tag,
+                         page);
+    switch (res) {
+        case RBUF_ADD_SUCCESS:
+            return 0;
+        case RBUF_ADD_NOSPACE:
+            return -ENOSPC;
+        case RBUF_ADD_REPEAT:
+            /* datagram was discarded, but the fragment was not released */
+            gnrc_pktbuf_release(frag);
+            /* intentionally falls through */
+        default:
+            return -EINVAL;
+    }
+}
+
+static int _rbuf_add_frag(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
+                          size_t hdr_len, size_t offset, size_t datagram_size,
+                          uint16_t tag, unsigned page)
+{
+    gnrc_sixlowpan_rbuf_t *entry;
+    uint8_t *data = ((uint8_t *)pkt->data) + hdr_len;
+    size_t frag_size = pkt->size - hdr_len;
+
+    if ((datagram_size == 0) || (datagram_size > SIXLOWPAN_FRAG_MAX_LEN)) {
+        DEBUG("6lo rbuf: unsupported datagram size %u\n",
+              (unsigned)datagram_size);
+        gnrc_pktbuf_release(pkt);
+        return RBUF_ADD_ERROR;
+    }
     entry = _rbuf_get(gnrc_netif_hdr_get_src_addr(netif_hdr), netif_hdr->src_l2addr_len,
                       gnrc_netif_hdr_get_dst_addr(netif_hdr), netif_hdr->dst_l2addr_len,
-                      byteorder_ntohs(frag->disp_size) & SIXLOWPAN_FRAG_SIZE_MASK,
-                      byteorder_ntohs(frag->tag), page);
+                      datagram_size, tag, page);
 
     if (entry == NULL) {
         DEBUG("6lo rbuf: reassembly buffer full.\n");
         gnrc_pktbuf_release(pkt);
-        return RBUF_ADD_ERROR;
+        return RBUF_ADD_NOSPACE;
     }
 
     /* dispatches in the first fragment are ignored */
-    if (offset == 0) {
-        frag_size = pkt->size - sizeof(sixlowpan_frag_t);
-        if (data[0] == SIXLOWPAN_UNCOMP) {
-            frag_size--;
-        }
-    }
-    else {
-        frag_size = pkt->size - sizeof(sixlowpan_frag_n_t);
-        data++; /* FRAGN header is one byte longer (offset) */
+    if ((offset == 0) && (data[0] == SIXLOWPAN_UNCOMP)) {
+        frag_size--;
     }
 
-    if ((offset + frag_size) > entry->super.datagram_size) {
+    if (((offset + frag_size) > entry->super.datagram_size) ||
+        ((offset % 8U) != 0)) {
         DEBUG("6lo rfrag: fragment too big for resulting datagram, discarding datagram\n");
         gnrc_pktbuf_release(entry->pkt);
         gnrc_pktbuf_release(pkt);
@@ -158,7 +328,7 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         return RBUF_ADD_ERROR;
     }
 
-    switch (_check_fragments(&entry->super, frag_size, offset)) {
+    switch (_check_fragments(entry, frag_size, offset)) {
         case RBUF_ADD_REPEAT:
             DEBUG("6lo rfrag: overlapping intervals, discarding datagram\n");
             gnrc_pktbuf_release(entry->pkt);
@@ -171,114 +341,130 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
             break;
     }
 
-    if (_rbuf_update_ints(&entry->super, offset, frag_size)) {
-        DEBUG("6lo rbuf: add fragment data\n");
-        entry->super.current_size += (uint16_t)frag_size;
-        if (offset == 0) {
+    _rbuf_mark(entry, offset, frag_size);
+    DEBUG("6lo rbuf: add fragment data\n");
+    entry->super.current_size += (uint16_t)frag_size;
+    if (offset == 0) {
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC
-            if (sixlowpan_iphc_is(data)) {
-                gnrc_pktsnip_t *frag_hdr = gnrc_pktbuf_mark(pkt,
-                        sizeof(sixlowpan_frag_t), GNRC_NETTYPE_SIXLOWPAN);
-                if (frag_hdr == NULL) {
-                    gnrc_pktbuf_release(entry->pkt);
-                    gnrc_pktbuf_release(pkt);
-                    rbuf_rm(entry);
-                    return RBUF_ADD_ERROR;
-                }
-                gnrc_sixlowpan_iphc_recv(pkt, entry, 0);
-                return RBUF_ADD_SUCCESS;
+        if (sixlowpan_iphc_is(data)) {
+            gnrc_pktsnip_t *frag_hdr = gnrc_pktbuf_mark(pkt, hdr_len,
+                    GNRC_NETTYPE_SIXLOWPAN);
+            if (frag_hdr == NULL) {
+                gnrc_pktbuf_release(entry->pkt);
+                gnrc_pktbuf_release(pkt);
+                rbuf_rm(entry);
+                return RBUF_ADD_ERROR;
             }
-            else
+            gnrc_sixlowpan_iphc_recv(pkt, entry, 0);
+            return RBUF_ADD_SUCCESS;
+        }
+        else
 #endif
-            if (data[0] == SIXLOWPAN_UNCOMP) {
-                data++;
-            }
+        if (data[0] == SIXLOWPAN_UNCOMP) {
+            data++;
         }
-        memcpy(((uint8_t *)entry->pkt->data) + offset, data,
-               frag_size);
     }
+    memcpy(((uint8_t *)entry->pkt->data) + offset, data, frag_size);
     gnrc_sixlowpan_frag_rbuf_dispatch_when_complete(entry, netif_hdr);
     gnrc_pktbuf_release(pkt);
     return RBUF_ADD_SUCCESS;
 }
 
-static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_rbuf_int_t *i,
-                                               uint16_t start, uint16_t end)
+void rbuf_rm(gnrc_sixlowpan_rbuf_t *entry)
 {
-    /* start and ends are both inclusive, so using <= for both */
-    return ((i->start <= end) && (start <= i->end)) && /* overlaps */
-        ((start != i->start) || (end != i->end)); /* not identical */
-}
+    unsigned idx = _idx(entry);
+    uint8_t *ptr;
 
-static gnrc_sixlowpan_rbuf_int_t *_rbuf_int_get_free(void)
-{
-    for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
-        if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
-            return rbuf_int + i;
-        }
+    if (entry->super.datagram_size == 0) {
+        /* entry is not linked into the index (anymore) */
+        entry->pkt = NULL;
+        return;
     }
-
-    return NULL;
-}
-
-void rbuf_rm(gnrc_sixlowpan_rbuf_t *entry)
-{
+    ptr = _bucket(entry);
+    /* unlink from hash bucket */
+    while (*ptr != idx) {
+        assert(*ptr != RBUF_NONE);
+        ptr = &_links[*ptr - 1].bucket_next;
+    }
+    *ptr = _links[idx - 1].bucket_next;
+    _age_unlink(idx);
+    /* add to free entries */
+    _links[idx - 1].older = _free;
+    _free = idx;
     gnrc_sixlowpan_frag_rbuf_base_rm(&entry->super);
     entry->pkt = NULL;
 }
 
-static bool _rbuf_update_ints(gnrc_sixlowpan_rbuf_base_t *entry,
-                              uint16_t offset, size_t frag_size)
+bool rbuf_int_get(const gnrc_sixlowpan_rbuf_t *entry, uint16_t from,
+                  gnrc_sixlowpan_rbuf_int_t *interval)
 {
-    gnrc_sixlowpan_rbuf_int_t *new;
-    uint16_t end = (uint16_t)(offset + frag_size - 1);
+    /* discarding const for bitfield API, fields are only read */
+    uint8_t *received = (uint8_t *)entry->received;
+    uint8_t *starts = (uint8_t *)entry->starts;
+    unsigned units = (entry->super.datagram_size + 7U) / 8U;
+
+    for (unsigned i = (from + 7U) / 8U; i < units; i++) {
+        if (bf_isset(starts, i)) {
+            unsigned end = i + 1;
+
+            while ((end < units) && bf_isset(received, end) &&
+                   !bf_isset(starts, end)) {
+                end++;
+            }
+            interval->start = i * 8U;
+            interval->end = ((end * 8U) < entry->super.datagram_size)
+                          ? ((end * 8U) - 1U)
+                          : (entry->super.datagram_size - 1U);
+            return true;
+        }
+    }
+    return false;
+}
 
-    new = _rbuf_int_get_free();
+static void _rbuf_mark(gnrc_sixlowpan_rbuf_t *entry, uint16_t offset,
+                       size_t frag_size)
+{
+    unsigned last = (offset + frag_size - 1) / 8U;
 
-    if (new == NULL) {
-        DEBUG("6lo rfrag: no space left in rbuf interval buffer.\n");
-        return false;
+    bf_set(entry->starts, offset / 8U);
+    for (unsigned i = offset / 8U; i <= last; i++) {
+        bf_set(entry->received, i);
     }
 
-    new->start = offset;
-    new->end = end;
-
-    DEBUG("6lo rfrag: add interval (%" PRIu16 ", %" PRIu16 ") to entry (%s, ",
-          new->start, new->end, gnrc_netif_addr_to_str(entry->src,
-                                                       entry->src_len,
-                                                       l2addr_str));
-    DEBUG("%s, %u, %u)\n", gnrc_netif_addr_to_str(entry->dst,
-                                                  entry->dst_len,
+    DEBUG("6lo rfrag: add interval (%u, %u) to entry (%s, ",
+          (unsigned)offset, (unsigned)(offset + frag_size - 1),
+          gnrc_netif_addr_to_str(entry->super.src, entry->super.src_len,
+                                 l2addr_str));
+    DEBUG("%s, %u, %u)\n", gnrc_netif_addr_to_str(entry->super.dst,
+                                                  entry->super.dst_len,
                                                   l2addr_str),
-          entry->datagram_size, entry->tag);
-
-    LL_PREPEND(entry->ints, new);
-
-    return true;
+          entry->super.datagram_size, entry->super.tag);
 }
 
 void rbuf_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
-    unsigned int i;
+    gnrc_sixlowpan_rbuf_t *entry;
 
-    for (i = 0; i < RBUF_SIZE; i++) {
-        /* since pkt occupies pktbuf, aggressivly collect garbage */
-        if ((rbuf[i].pkt != NULL) &&
-              ((now_usec - rbuf[i].super.arrival) > RBUF_TIMEOUT)) {
-            DEBUG("6lo rfrag: entry (%s, ",
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) timed out\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    gnrc_sixlowpan_frag_vrb_gc();
+#endif
+    /* entries are sorted by arrival, so stop at the first that did not time
+     * out */
+    while (((entry = _entry(_oldest)) != NULL) &&
+           ((now_usec - entry->super.arrival) > RBUF_TIMEOUT)) {
+        DEBUG("6lo rfrag: entry (%s, ",
+              gnrc_netif_addr_to_str(entry->super.src,
+                                     entry->super.src_len,
+                                     l2addr_str));
+        DEBUG("%s, %u, %u) timed out\n",
+              gnrc_netif_addr_to_str(entry->super.dst,
+                                     entry->super.dst_len,
+                                     l2addr_str),
+              (unsigned)entry->super.datagram_size, entry->super.tag);
 
-            gnrc_pktbuf_release(rbuf[i].pkt);
-            rbuf_rm(&(rbuf[i]));
-        }
+        gnrc_pktbuf_release(entry->pkt);
+        rbuf_rm(entry);
     }
 }
 
@@ -292,48 +478,49 @@ static gnrc_sixlowpan_rbuf_t *_rbuf_get(const void *src, size_t src_len,
                                         size_t size, uint16_t tag,
                                         unsigned page)
 {
-    gnrc_sixlowpan_rbuf_t *res = NULL, *oldest = NULL;
+    gnrc_sixlowpan_rbuf_t *res = NULL;
     uint32_t now_usec = xtimer_now_usec();
-
-    for (unsigned int i = 0; i < RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.datagram_size == size) &&
-            (rbuf[i].super.tag == tag) && (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
+    uint8_t *bucket = &_buckets[_hash(src, src_len, dst, dst_len, size, tag)];
+
+    /* check first if entry already available */
+    for (unsigned idx = *bucket; idx != RBUF_NONE;
+         idx = _links[idx - 1].bucket_next) {
+        gnrc_sixlowpan_rbuf_t *entry = _entry(idx);
+
+        if ((entry->super.datagram_size == size) &&
+            (entry->super.tag == tag) && (entry->super.src_len == src_len) &&
+            (entry->super.dst_len == dst_len) &&
+            (memcmp(entry->super.src, src, src_len) == 0) &&
+            (memcmp(entry->super.dst, dst, dst_len) == 0)) {
+            DEBUG("6lo rfrag: entry %p (%s, ", (void *)entry,
+                  gnrc_netif_addr_to_str(entry->super.src,
+                                         entry->super.src_len,
                                          l2addr_str));
             DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
+                  gnrc_netif_addr_to_str(entry->super.dst,
+                                         entry->super.dst_len,
                                          l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
-            rbuf[i].super.arrival = now_usec;
+                  (unsigned)entry->super.datagram_size, entry->super.tag);
+            entry->super.arrival = now_usec;
+            _age_unlink(idx);
+            _age_append(idx);
             _set_rbuf_timeout();
-            return &(rbuf[i]);
-        }
-
-        /* if there is a free spot: remember it */
-        if ((res == NULL) && rbuf_entry_empty(&rbuf[i])) {
-            res = &(rbuf[i]);
-        }
-
-        /* remember oldest slot */
-        /* note that xtimer_now will overflow in ~1.2 hours */
-        if ((oldest == NULL) ||
-            (oldest->super.arrival - rbuf[i].super.arrival < UINT32_MAX / 2)) {
-            oldest = &(rbuf[i]);
+            return entry;
         }
     }
 
+    if (_free != RBUF_NONE) {
+        res = _entry(_free);
+        _free = _links[_free - 1].older;
+    }
+    else if (_used < RBUF_SIZE) {
+        res = &rbuf[_used++];
+    }
     /* entry not in buffer and no empty spot found */
-    if (res == NULL) {
+    else {
+        gnrc_sixlowpan_rbuf_t *oldest = _entry(_oldest);
+
         assert(oldest != NULL);
-        /* if oldest is not empty, res must not be NULL (because otherwise
-         * oldest could have been picked as res) */
         assert(!rbuf_entry_empty(oldest));
         if (GNRC_SIXLOWPAN_FRAG_RBUF_AGGRESSIVE_OVERRIDE ||
             ((now_usec - oldest->super.arrival) >
@@ -341,7 +528,9 @@ static gnrc_sixlowpan_rbuf_t *_rbuf_get(const void *src, size_t src_len,
             DEBUG("6lo rfrag: reassembly buffer full, remove oldest entry\n");
             gnrc_pktbuf_release(oldest->pkt);
             rbuf_rm(oldest);
+            /* oldest is now the first free entry */
             res = oldest;
+            _free = _links[_free - 1].older;
         }
         else {
             return NULL;
@@ -364,6 +553,9 @@ static gnrc_sixlowpan_rbuf_t *_rbuf_get(const void *src, size_t src_len,
     res->pkt = gnrc_pktbuf_add(NULL, NULL, size, reass_type);
     if (res->pkt == NULL) {
         DEBUG("6lo rfrag: can not allocate reassembly buffer space.\n");
+        /* return entry to free entries */
+        _links[_idx(res) - 1].older = _free;
+        _free = _idx(res);
         return NULL;
     }
 
@@ -377,6 +569,11 @@ static gnrc_sixlowpan_rbuf_t *_rbuf_get(const void *src, size_t src_len,
     res->super.dst_len = dst_len;
     res->super.tag = tag;
     res->super.current_size = 0;
+    memset(res->received, 0, sizeof(res->received));
+    memset(res->starts, 0, sizeof(res->starts));
+    _links[_idx(res) - 1].bucket_next = *bucket;
+    *bucket = _idx(res);
+    _age_append(_idx(res));
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
@@ -395,7 +592,12 @@ static gnrc_sixlowpan_rbuf_t *_rbuf_get(const void *src, size_t src_len,
 void rbuf_reset(void)
 {
     xtimer_remove(&_gc_timer);
-    memset(rbuf_int, 0, sizeof(rbuf_int));
+    memset(_links, 0, sizeof(_links));
+    memset(_buckets, 0, sizeof(_buckets));
+    _oldest = RBUF_NONE;
+    _newest = RBUF_NONE;
+    _free = RBUF_NONE;
+    _used = 0;
     for (unsigned int i = 0; i < RBUF_SIZE; i++) {
         if ((rbuf[i].pkt != NULL) &&
             (rbuf[i].pkt->users > 0)) {
@@ -57,6 +57,33 @@ extern "C" {
 void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *frag,
               size_t offset, unsigned page);
 
+/**
+ * @brief   Adds a new fragment with an arbitrary fragment header to the
+ *          reassembly buffer. If the packet is complete, dispatch the packet
+ *          with the transmit information of the last fragment.
+ *
+ * @param[in] netif_hdr     The interface header of the fragment, with
+ *                          gnrc_netif_hdr_t::if_pid and its source and
+ *                          destination address set.
+ * @param[in] frag          The fragment to add. Released in any case.
+ * @param[in] hdr_len       Length of the fragment header at the start of
+ *                          @p frag.
+ * @param[in] offset        The fragment's offset in the uncompressed
+ *                          datagram. Must be a multiple of 8.
+ * @param[in] datagram_size Size of the uncompressed datagram.
+ * @param[in] tag           The datagram's tag.
+ * @param[in] page          Current 6Lo dispatch parsing page.
+ *
+ * @return  0, if the fragment was added or was a duplicate.
+ * @return  -ENOSPC, if there was no space to add the fragment.
+ * @return  -EINVAL, if the datagram was discarded due to the fragment.
+ *
+ * @internal
+ */
+int rbuf_add_frag(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *frag,
+                  size_t hdr_len, size_t offset, size_t datagram_size,
+                  uint16_t tag, unsigned page);
+
 /**
  * @brief   Checks timeouts and removes entries if necessary
  */
@@ -66,7 +93,9 @@ void rbuf_gc(void);
  * @brief   Unsets a reassembly buffer entry (but does not free
  *          rbuf_t::super::pkt)
  *
- * This functions sets rbuf_t::super::pkt to NULL and removes all rbuf::ints.
+ * This functions sets rbuf_t::super::pkt to NULL and removes the entry from
+ * the index of the reassembly buffer. Calling it for an entry that was
+ * already removed has no further effect.
  *
  * @param[in] rbuf  A reassembly buffer entry
  *
@@ -74,6 +103,22 @@ void rbuf_gc(void);
  */
 void rbuf_rm(gnrc_sixlowpan_rbuf_t *rbuf);
 
+/**
+ * @brief   Gets the interval of the first received fragment of a reassembly
+ *          buffer entry that starts at or after @p from
+ *
+ * @param[in] rbuf      A reassembly buffer entry
+ * @param[in] from      Offset to start the search at
+ * @param[out] interval The interval of the fragment found
+ *
+ * @return  true, if a fragment was found.
+ * @return  false, if there are no more fragments.
+ *
+ * @internal
+ */
+bool rbuf_int_get(const gnrc_sixlowpan_rbuf_t *rbuf, uint16_t from,
+                  gnrc_sixlowpan_rbuf_int_t *interval);
+
 /**
  * @brief   Checks if a reassembly buffer entry is unset
  *
@@ -0,0 +1,571 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/frag/sfr.h"
+#include "net/gnrc/sixlowpan/internal.h"
+#include "net/sixlowpan/sfr.h"
+#include "thread.h"
+#include "utlist.h"
+#include "xtimer.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+/**
+ * @brief   Receiving state of a datagram
+ */
+typedef struct {
+    uint8_t src[IEEE802154_LONG_ADDRESS_LEN];   /**< source address */
+    uint8_t dst[IEEE802154_LONG_ADDRESS_LEN];   /**< destination address */
+    uint8_t src_len;                            /**< length of _sfr_rx_t::src */
+    uint8_t dst_len;                            /**< length of _sfr_rx_t::dst */
+    uint8_t tag;                                /**< the datagram's tag */
+    bool complete;                              /**< datagram was reassembled */
+    kernel_pid_t if_pid;                        /**< receiving interface */
+    uint16_t datagram_size;                     /**< the datagram's size, 0
+                                                 *   for an empty entry */
+    uint32_t received;                          /**< received fragments */
+    uint32_t arrival;                           /**< time in microseconds of
+                                                 *   arrival of last received
+                                                 *   fragment */
+} _sfr_rx_t;
+
+static _sfr_rx_t _rx[GNRC_SIXLOWPAN_FRAG_SFR_RX_SIZE];
+
+static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
+
+static inline size_t _min(size_t a, size_t b)
+{
+    return (a < b) ? a : b;
+}
+
+/* bitmap of all fragments of a datagram */
+static inline uint32_t _all(unsigned frags)
+{
+    return (frags < SIXLOWPAN_SFR_ACK_BITMAP_SIZE) ? ~(UINT32_MAX >> frags)
+                                                   : UINT32_MAX;
+}
+
+static inline bool _waiting_for_ack(const gnrc_sixlowpan_frag_sfr_fb_t *sfr)
+{
+    return (sfr->msg.type == GNRC_SIXLOWPAN_MSG_FRAG_SFR_ARQ_TIMEOUT);
+}
+
+static void _set_arq_timeout(gnrc_sixlowpan_frag_sfr_fb_t *sfr)
+{
+    sfr->msg.type = GNRC_SIXLOWPAN_MSG_FRAG_SFR_ARQ_TIMEOUT;
+    sfr->arq_deadline = xtimer_now_usec() +
+                        GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_US;
+    xtimer_set_msg(&sfr->timer, GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_US,
+                   &sfr->msg, sched_active_pid);
+}
+
+/* a timeout message may already be queued when the timer is removed, so it
+ * only belongs to the current acknowledgment request once its deadline has
+ * passed */
+static inline bool _arq_timed_out(const gnrc_sixlowpan_frag_sfr_fb_t *sfr)
+{
+    return _waiting_for_ack(sfr) &&
+           ((int32_t)(xtimer_now_usec() - sfr->arq_deadline) >= 0);
+}
+
+static void _fb_release(gnrc_sixlowpan_msg_frag_t *fragment_msg, uint32_t err)
+{
+    xtimer_remove(&fragment_msg->sfr.timer);
+    gnrc_pktbuf_release_error(fragment_msg->pkt, err);
+    memset(&fragment_msg->sfr, 0, sizeof(fragment_msg->sfr));
+    fragment_msg->pkt = NULL;
+}
+
+static bool _fb_init(gnrc_netif_t *netif,
+                     gnrc_sixlowpan_msg_frag_t *fragment_msg,
+                     size_t payload_len)
+{
+    gnrc_sixlowpan_frag_sfr_fb_t *sfr = &fragment_msg->sfr;
+    /* bytes saved by header compression in the first fragment */
+    size_t comp_diff = fragment_msg->datagram_size - payload_len;
+    size_t max_size, frag1_size, frag_size, frags;
+
+    if (netif->sixlo.max_frag_size <= (sizeof(sixlowpan_sfr_rfrag_t) + 8U)) {
+        return false;
+    }
+    max_size = _min(netif->sixlo.max_frag_size - sizeof(sixlowpan_sfr_rfrag_t),
+                    SIXLOWPAN_SFR_FRAG_SIZE_MAX);
+    /* the offsets of all other fragments need to be a multiple of 8 for the
+     * reassembly buffer, so let the first fragment end at such a boundary
+     * in the uncompressed datagram */
+    frag1_size = ((max_size + comp_diff) & ~0x7U) - comp_diff;
+    frag_size = max_size & ~0x7U;
+    frags = 1 + ((payload_len - frag1_size) + frag_size - 1) / frag_size;
+    if (frags > SIXLOWPAN_SFR_ACK_BITMAP_SIZE) {
+        DEBUG("6lo sfr: %u fragments needed, falling back to RFC 4944\n",
+              (unsigned)frags);
+        return false;
+    }
+    memset(sfr, 0, sizeof(gnrc_sixlowpan_frag_sfr_fb_t));
+    sfr->msg.content.ptr = fragment_msg;
+    sfr->msg.type = GNRC_SIXLOWPAN_MSG_FRAG_SND;
+    sfr->frag1_size = frag1_size;
+    sfr->frag_size = frag_size;
+    sfr->frags = frags;
+    /* RFRAG only has space for 8 bits of the datagram tag */
+    fragment_msg->tag &= 0xff;
+    DEBUG("6lo sfr: sending datagram with tag %u in %u fragments\n",
+          fragment_msg->tag, (unsigned)frags);
+    return true;
+}
+
+/* copies len bytes starting at offset of pkt to data */
+static void _copy(uint8_t *data, const gnrc_pktsnip_t *pkt, size_t offset,
+                  size_t len)
+{
+    for (; (pkt != NULL) && (len > 0); pkt = pkt->next) {
+        size_t clen;
+
+        if (offset >= pkt->size) {
+            offset -= pkt->size;
+            continue;
+        }
+        clen = _min(pkt->size - offset, len);
+        memcpy(data, ((uint8_t *)pkt->data) + offset, clen);
+        data += clen;
+        len -= clen;
+        offset = 0;
+    }
+}
+
+static int _send_rfrag(gnrc_sixlowpan_msg_frag_t *fragment_msg,
+                       size_t payload_len, unsigned seq, bool ack_req)
+{
+    const gnrc_sixlowpan_frag_sfr_fb_t *sfr = &fragment_msg->sfr;
+    gnrc_netif_hdr_t *netif_hdr = fragment_msg->pkt->data, *new_netif_hdr;
+    gnrc_pktsnip_t *netif, *frag;
+    sixlowpan_sfr_rfrag_t *hdr;
+    size_t start = (seq == 0) ? 0
+                              : (sfr->frag1_size + (seq - 1) * sfr->frag_size);
+    size_t frag_size = _min((seq == 0) ? sfr->frag1_size : sfr->frag_size,
+                            payload_len - start);
+    /* header compression only affects the first fragment, so the offset of
+     * all others is shifted by the bytes compression saved */
+    uint16_t offset = (seq == 0) ? fragment_msg->datagram_size
+                                 : (start + (fragment_msg->datagram_size -
+                                             payload_len));
+
+    netif = gnrc_netif_hdr_build(gnrc_netif_hdr_get_src_addr(netif_hdr),
+                                 netif_hdr->src_l2addr_len,
+                                 gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                                 netif_hdr->dst_l2addr_len);
+    if (netif == NULL) {
+        DEBUG("6lo sfr: error allocating new link-layer header\n");
+        return -ENOMEM;
+    }
+    new_netif_hdr = netif->data;
+    new_netif_hdr->if_pid = netif_hdr->if_pid;
+    new_netif_hdr->flags = netif_hdr->flags;
+    new_netif_hdr->rssi = netif_hdr->rssi;
+    new_netif_hdr->lqi = netif_hdr->lqi;
+    frag = gnrc_pktbuf_add(NULL, NULL, sizeof(sixlowpan_sfr_rfrag_t) + frag_size,
+                           GNRC_NETTYPE_SIXLOWPAN);
+    if (frag == NULL) {
+        DEBUG("6lo sfr: error allocating fragment\n");
+        gnrc_pktbuf_release(netif);
+        return -ENOMEM;
+    }
+    hdr = frag->data;
+    sixlowpan_sfr_rfrag_init(hdr, fragment_msg->tag, seq, frag_size, offset);
+    if (ack_req) {
+        sixlowpan_sfr_rfrag_set_ack_req(hdr);
+    }
+    else {
+        /* Tell the link layer that we will send more fragments */
+        new_netif_hdr->flags |= GNRC_NETIF_HDR_FLAGS_MORE_DATA;
+    }
+    _copy((uint8_t *)(hdr + 1), fragment_msg->pkt->next, start, frag_size);
+    LL_PREPEND(frag, netif);
+    DEBUG("6lo sfr: send fragment (tag: %u, seq: %u, offset: %u, "
+          "fragment size: %u%s)\n", fragment_msg->tag, seq, offset,
+          (unsigned)frag_size, (ack_req) ? ", ACK requested" : "");
+    gnrc_sixlowpan_dispatch_send(frag, NULL, 0);
+    return 0;
+}
+
+static bool _schedule_next(gnrc_sixlowpan_msg_frag_t *fragment_msg)
+{
+    gnrc_sixlowpan_frag_sfr_fb_t *sfr = &fragment_msg->sfr;
+
+    sfr->msg.type = GNRC_SIXLOWPAN_MSG_FRAG_SND;
+    if (GNRC_SIXLOWPAN_FRAG_SFR_INTER_FRAME_GAP_US > 0) {
+        xtimer_set_msg(&sfr->timer, GNRC_SIXLOWPAN_FRAG_SFR_INTER_FRAME_GAP_US,
+                       &sfr->msg, sched_active_pid);
+        return true;
+    }
+    return gnrc_sixlowpan_frag_send_msg(fragment_msg);
+}
+
+bool gnrc_sixlowpan_frag_sfr_send(gnrc_netif_t *netif,
+                                  gnrc_sixlowpan_msg_frag_t *fragment_msg,
+                                  size_t payload_len)
+{
+    gnrc_sixlowpan_frag_sfr_fb_t *sfr = &fragment_msg->sfr;
+    uint32_t unsent;
+    unsigned seq;
+    bool ack_req;
+
+    if ((sfr->frags == 0) &&
+        ((fragment_msg->offset != 0) ||
+         !_fb_init(netif, fragment_msg, payload_len))) {
+        return false;
+    }
+    unsent = _all(sfr->frags) & ~sfr->sent;
+    if ((unsent == 0) || _waiting_for_ack(sfr)) {
+        return true;
+    }
+    /* send missing fragments and then new ones in order */
+    for (seq = 0; !(unsent & sixlowpan_sfr_ack_bit(seq)); seq++) {}
+    unsent &= ~sixlowpan_sfr_ack_bit(seq);
+    ack_req = (unsent == 0) ||
+              ((sfr->window + 1U) >= GNRC_SIXLOWPAN_FRAG_SFR_WIN_SIZE);
+    if (_send_rfrag(fragment_msg, payload_len, seq, ack_req) < 0) {
+        _fb_release(fragment_msg, ENOMEM);
+        return true;
+    }
+    sfr->sent |= sixlowpan_sfr_ack_bit(seq);
+    if (ack_req) {
+        sfr->window = 0;
+        _set_arq_timeout(sfr);
+        return true;
+    }
+    sfr->window++;
+    if (!_schedule_next(fragment_msg)) {
+        DEBUG("6lo sfr: message queue full, can't issue next fragment "
+              "sending\n");
+        _fb_release(fragment_msg, ENOMEM);
+        return true;
+    }
+    thread_yield();
+    return true;
+}
+
+void gnrc_sixlowpan_frag_sfr_arq_timeout(gnrc_sixlowpan_msg_frag_t *fragment_msg)
+{
+    gnrc_sixlowpan_frag_sfr_fb_t *sfr = &fragment_msg->sfr;
+
+    if ((fragment_msg->pkt == NULL) || !_arq_timed_out(sfr)) {
+        DEBUG("6lo sfr: stale acknowledgment timeout\n");
+        return;
+    }
+    if (++sfr->retries > GNRC_SIXLOWPAN_FRAG_SFR_FRAG_RETRIES) {
+        DEBUG("6lo sfr: no acknowledgment for datagram %u, giving up\n",
+              fragment_msg->tag);
+        _fb_release(fragment_msg, ETIMEDOUT);
+        return;
+    }
+    DEBUG("6lo sfr: no acknowledgment for datagram %u, resending window\n",
+          fragment_msg->tag);
+    sfr->sent = sfr->acked;
+    sfr->window = 0;
+    sfr->msg.type = GNRC_SIXLOWPAN_MSG_FRAG_SND;
+    gnrc_sixlowpan_frag_send(NULL, fragment_msg, 0);
+}
+
+static void _handle_ack(const gnrc_netif_hdr_t *netif_hdr,
+                        const sixlowpan_sfr_ack_t *ack)
+{
+    gnrc_sixlowpan_msg_frag_t *fragment_msg;
+    gnrc_sixlowpan_frag_sfr_fb_t *sfr;
+    const gnrc_netif_hdr_t *dst_hdr;
+    uint32_t bitmap;
+
+    fragment_msg = gnrc_sixlowpan_msg_frag_get_sfr(ack->base.tag);
+    if (fragment_msg == NULL) {
+        DEBUG("6lo sfr: no datagram for acknowledgment with tag %u\n",
+              ack->base.tag);
+        return;
+    }
+    sfr = &fragment_msg->sfr;
+    dst_hdr = fragment_msg->pkt->data;
+    if ((dst_hdr->dst_l2addr_len != netif_hdr->src_l2addr_len) ||
+        (memcmp(gnrc_netif_hdr_get_dst_addr(dst_hdr),
+                gnrc_netif_hdr_get_src_addr(netif_hdr),
+                netif_hdr->src_l2addr_len) != 0)) {
+        DEBUG("6lo sfr: acknowledgment not from %s\n",
+              gnrc_netif_addr_to_str(gnrc_netif_hdr_get_dst_addr(dst_hdr),
+                                     dst_hdr->dst_l2addr_len, l2addr_str));
+        return;
+    }
+    if (!_waiting_for_ack(sfr)) {
+        /* bitmaps are cumulative, so the solicited acknowledgment will have
+         * the same information */
+        DEBUG("6lo sfr: ignoring unsolicited acknowledgment\n");
+        return;
+    }
+    xtimer_remove(&sfr->timer);
+    bitmap = byteorder_ntohl(ack->bitmap);
+    if (bitmap == 0) {
+        DEBUG("6lo sfr: datagram %u aborted by receiver\n", ack->base.tag);
+        _fb_release(fragment_msg, ECANCELED);
+        return;
+    }
+    bitmap &= _all(sfr->frags);
+    if ((bitmap & ~sfr->acked) == 0) {
+        /* no progress */
+        if (++sfr->retries > GNRC_SIXLOWPAN_FRAG_SFR_FRAG_RETRIES) {
+            DEBUG("6lo sfr: datagram %u makes no progress, giving up\n",
+                  ack->base.tag);
+            _fb_release(fragment_msg, ETIMEDOUT);
+            return;
+        }
+    }
+    else {
+        sfr->retries = 0;
+    }
+    sfr->acked |= bitmap;
+    if (sfr->acked == _all(sfr->frags)) {
+        DEBUG("6lo sfr: datagram %u acknowledged completely\n",
+              ack->base.tag);
+        _fb_release(fragment_msg, GNRC_NETERR_SUCCESS);
+        return;
+    }
+    DEBUG("6lo sfr: fragments 0x%08lx of datagram %u missing\n",
+          (unsigned long)(_all(sfr->frags) & ~sfr->acked), ack->base.tag);
+    /* only resend what the receiver reported missing */
+    sfr->sent = sfr->acked;
+    sfr->window = 0;
+    sfr->msg.type = GNRC_SIXLOWPAN_MSG_FRAG_SND;
+    gnrc_sixlowpan_frag_send(NULL, fragment_msg, 0);
+}
+
+static void _send_ack(kernel_pid_t if_pid, const uint8_t *dst, size_t dst_len,
+                      uint8_t tag, uint32_t bitmap)
+{
+    gnrc_pktsnip_t *netif, *pkt;
+    gnrc_netif_hdr_t *netif_hdr;
+
+    pkt = gnrc_pktbuf_add(NULL, NULL, sizeof(sixlowpan_sfr_ack_t),
+                          GNRC_NETTYPE_SIXLOWPAN);
+    if (pkt == NULL) {
+        DEBUG("6lo sfr: error allocating acknowledgment\n");
+        return;
+    }
+    netif = gnrc_netif_hdr_build(NULL, 0, dst, dst_len);
+    if (netif == NULL) {
+        DEBUG("6lo sfr: error allocating link-layer header\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    netif_hdr = netif->data;
+    netif_hdr->if_pid = if_pid;
+    sixlowpan_sfr_ack_init(pkt->data, tag, bitmap);
+    LL_PREPEND(pkt, netif);
+    DEBUG("6lo sfr: acknowledge 0x%08lx of datagram %u to %s\n",
+          (unsigned long)bitmap, tag,
+          gnrc_netif_addr_to_str(dst, dst_len, l2addr_str));
+    gnrc_sixlowpan_dispatch_send(pkt, NULL, 0);
+}
+
+static inline bool _rx_entry_empty(const _sfr_rx_t *rx)
+{
+    return (rx->datagram_size == 0);
+}
+
+static void _rx_gc(void)
+{
+    uint32_t now_usec = xtimer_now_usec();
+
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_SFR_RX_SIZE; i++) {
+        if (!_rx_entry_empty(&_rx[i]) &&
+            ((now_usec - _rx[i].arrival) > GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)) {
+            DEBUG("6lo sfr: state for datagram %u timed out\n", _rx[i].tag);
+            memset(&_rx[i], 0, sizeof(_rx[i]));
+        }
+    }
+}
+
+static _sfr_rx_t *_rx_get(const gnrc_netif_hdr_t *netif_hdr, uint8_t tag)
+{
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_SFR_RX_SIZE; i++) {
+        _sfr_rx_t *rx = &_rx[i];
+
+        if (!_rx_entry_empty(rx) && (rx->tag == tag) &&
+            (rx->src_len == netif_hdr->src_l2addr_len) &&
+            (rx->dst_len == netif_hdr->dst_l2addr_len) &&
+            (memcmp(rx->src, gnrc_netif_hdr_get_src_addr(netif_hdr),
+                    rx->src_len) == 0) &&
+            (memcmp(rx->dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                    rx->dst_len) == 0)) {
+            return rx;
+        }
+    }
+    return NULL;
+}
+
+static _sfr_rx_t *_rx_add(const gnrc_netif_hdr_t *netif_hdr, uint8_t tag,
+                          uint16_t datagram_size)
+{
+    if ((netif_hdr->src_l2addr_len > IEEE802154_LONG_ADDRESS_LEN) ||
+        (netif_hdr->dst_l2addr_len > IEEE802154_LONG_ADDRESS_LEN)) {
+        return NULL;
+    }
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_SFR_RX_SIZE; i++) {
+        _sfr_rx_t *rx = &_rx[i];
+
+        if (_rx_entry_empty(rx)) {
+            memcpy(rx->src, gnrc_netif_hdr_get_src_addr(netif_hdr),
+                   netif_hdr->src_l2addr_len);
+            memcpy(rx->dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                   netif_hdr->dst_l2addr_len);
+            rx->src_len = netif_hdr->src_l2addr_len;
+            rx->dst_len = netif_hdr->dst_l2addr_len;
+            rx->tag = tag;
+            rx->complete = false;
+            rx->if_pid = netif_hdr->if_pid;
+            rx->datagram_size = datagram_size;
+            rx->received = 0;
+            return rx;
+        }
+    }
+    return NULL;
+}
+
+static void _handle_rfrag(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
+                          unsigned page)
+{
+    const sixlowpan_sfr_rfrag_t *hdr = pkt->data;
+    /* pkt is released when added to the reassembly buffer, so keep what is
+     * needed from the header */
+    const unsigned seq = sixlowpan_sfr_rfrag_get_seq(hdr);
+    const uint32_t bit = sixlowpan_sfr_ack_bit(seq);
+    const bool ack_req = sixlowpan_sfr_rfrag_ack_req(hdr);
+    const uint8_t tag = hdr->base.tag;
+    const uint16_t offset = sixlowpan_sfr_rfrag_get_offset(hdr);
+    _sfr_rx_t *rx;
+    bool complete;
+
+    if (sixlowpan_sfr_rfrag_get_frag_size(hdr) !=
+        (pkt->size - sizeof(sixlowpan_sfr_rfrag_t))) {
+        DEBUG("6lo sfr: fragment size does not match frame\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    _rx_gc();
+    rx = _rx_get(netif_hdr, tag);
+    if (seq == 0) {
+        if ((rx != NULL) && (rx->datagram_size != offset)) {
+            DEBUG("6lo sfr: tag %u reused for new datagram\n", tag);
+            memset(rx, 0, sizeof(_sfr_rx_t));
+            rx = NULL;
+        }
+        if ((offset == 0) ||
+            ((rx == NULL) && ((rx = _rx_add(netif_hdr, tag, offset)) == NULL))) {
+            DEBUG("6lo sfr: can not track datagram %u\n", tag);
+            gnrc_pktbuf_release(pkt);
+            return;
+        }
+    }
+    else if (rx == NULL) {
+        /* without the first fragment the datagram size is unknown; the
+         * fragment will be reported missing and sent again */
+        DEBUG("6lo sfr: first fragment of datagram %u missing, dropping "
+              "fragment %u\n", tag, seq);
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    rx->arrival = xtimer_now_usec();
+    complete = rx->complete;
+    if (complete || (rx->received & bit)) {
+        DEBUG("6lo sfr: duplicate fragment %u of datagram %u\n", seq, tag);
+        gnrc_pktbuf_release(pkt);
+    }
+    else {
+        int res;
+
+        rx->received |= bit;
+        res = gnrc_sixlowpan_frag_rbuf_add(netif_hdr, pkt,
+                                           sizeof(sixlowpan_sfr_rfrag_t),
+                                           (seq == 0) ? 0 : offset,
+                                           rx->datagram_size, tag, page);
+        if (res == -ENOSPC) {
+            /* not received as far as the sender is concerned */
+            rx->received &= ~bit;
+        }
+        else if (res < 0) {
+            DEBUG("6lo sfr: datagram %u discarded, aborting\n", tag);
+            _send_ack(rx->if_pid, rx->src, rx->src_len, tag, 0);
+            memset(rx, 0, sizeof(_sfr_rx_t));
+            return;
+        }
+    }
+    /* also acknowledge completion, in case the fragment that requested an
+     * acknowledgment arrived earlier */
+    if (ack_req || (rx->complete && !complete)) {
+        _send_ack(rx->if_pid, rx->src, rx->src_len, tag, rx->received);
+    }
+}
+
+void gnrc_sixlowpan_frag_sfr_recv(gnrc_pktsnip_t *pkt, void *ctx,
+                                  unsigned page)
+{
+    gnrc_netif_hdr_t *netif_hdr = pkt->next->data;
+    sixlowpan_sfr_t *hdr = pkt->data;
+
+    (void)ctx;
+    if (sixlowpan_sfr_ack_is(hdr)) {
+        if (pkt->size >= sizeof(sixlowpan_sfr_ack_t)) {
+            _handle_ack(netif_hdr, pkt->data);
+        }
+        else {
+            DEBUG("6lo sfr: acknowledgment too short\n");
+        }
+        gnrc_pktbuf_release(pkt);
+    }
+    else if (sixlowpan_sfr_rfrag_is(hdr) &&
+             (pkt->size > sizeof(sixlowpan_sfr_rfrag_t))) {
+        _handle_rfrag(netif_hdr, pkt, page);
+    }
+    else {
+        DEBUG("6lo sfr: not a recoverable fragment\n");
+        gnrc_pktbuf_release(pkt);
+    }
+}
+
+void gnrc_sixlowpan_frag_sfr_rbuf_complete(const gnrc_sixlowpan_rbuf_base_t *base)
+{
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_SFR_RX_SIZE; i++) {
+        _sfr_rx_t *rx = &_rx[i];
+
+        if (!_rx_entry_empty(rx) && (rx->tag == base->tag) &&
+            (rx->datagram_size == base->datagram_size) &&
+            (rx->src_len == base->src_len) && (rx->dst_len == base->dst_len) &&
+            (memcmp(rx->src, base->src, rx->src_len) == 0) &&
+            (memcmp(rx->dst, base->dst, rx->dst_len) == 0)) {
+            DEBUG("6lo sfr: datagram %u complete\n", rx->tag);
+            rx->complete = true;
+            return;
+        }
+    }
+}
+
+#ifdef TEST_SUITES
+void gnrc_sixlowpan_frag_sfr_reset(void)
+{
+    memset(_rx, 0, sizeof(_rx));
+}
+#endif
+
+/** @} */
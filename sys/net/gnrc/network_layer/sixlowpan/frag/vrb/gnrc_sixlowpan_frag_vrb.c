@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#include "net/gnrc/sixlowpan/internal.h"
+#include "net/sixlowpan.h"
+#include "utlist.h"
+#include "xtimer.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+static gnrc_sixlowpan_frag_vrb_t _vrb[GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+
+static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
+
+static inline bool _vrb_entry_empty(const gnrc_sixlowpan_frag_vrb_t *vrb)
+{
+    return (vrb->super.datagram_size == 0);
+}
+
+gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
+        const gnrc_sixlowpan_rbuf_base_t *base, gnrc_netif_t *out_netif,
+        const uint8_t *out_dst, size_t out_dst_len)
+{
+    assert(base != NULL);
+    assert(out_netif != NULL);
+    if (out_dst_len > sizeof(_vrb[0].out_dst)) {
+        DEBUG("6lo vrb: next hop address too long\n");
+        return NULL;
+    }
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        gnrc_sixlowpan_frag_vrb_t *vrb = &_vrb[i];
+
+        if (_vrb_entry_empty(vrb)) {
+            memcpy(&vrb->super, base, sizeof(vrb->super));
+            vrb->super.current_size = 0;
+            vrb->super.arrival = xtimer_now_usec();
+            vrb->out_netif = out_netif;
+            memcpy(vrb->out_dst, out_dst, out_dst_len);
+            vrb->out_dst_len = out_dst_len;
+            vrb->out_tag = gnrc_sixlowpan_frag_next_tag();
+            DEBUG("6lo vrb: forwarding (%s, ",
+                  gnrc_netif_addr_to_str(vrb->super.src, vrb->super.src_len,
+                                         l2addr_str));
+            DEBUG("%u, %u) to %s with tag %u\n",
+                  (unsigned)vrb->super.datagram_size, vrb->super.tag,
+                  gnrc_netif_addr_to_str(vrb->out_dst, vrb->out_dst_len,
+                                         l2addr_str), vrb->out_tag);
+            return vrb;
+        }
+    }
+    DEBUG("6lo vrb: virtual reassembly buffer full\n");
+    return NULL;
+}
+
+gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(
+        const uint8_t *src, size_t src_len, const uint8_t *dst, size_t dst_len,
+        size_t datagram_size, unsigned tag)
+{
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        gnrc_sixlowpan_frag_vrb_t *vrb = &_vrb[i];
+
+        if (!_vrb_entry_empty(vrb) &&
+            (vrb->super.datagram_size == datagram_size) &&
+            (vrb->super.tag == tag) &&
+            (vrb->super.src_len == src_len) &&
+            (vrb->super.dst_len == dst_len) &&
+            (memcmp(vrb->super.src, src, src_len) == 0) &&
+            (memcmp(vrb->super.dst, dst, dst_len) == 0)) {
+            return vrb;
+        }
+    }
+    return NULL;
+}
+
+void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrb)
+{
+    memset(vrb, 0, sizeof(gnrc_sixlowpan_frag_vrb_t));
+}
+
+void gnrc_sixlowpan_frag_vrb_gc(void)
+{
+    uint32_t now_usec = xtimer_now_usec();
+
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        if (!_vrb_entry_empty(&_vrb[i]) &&
+            ((now_usec - _vrb[i].super.arrival) >
+             GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US)) {
+            DEBUG("6lo vrb: entry (%s, %u, %u) timed out\n",
+                  gnrc_netif_addr_to_str(_vrb[i].super.src,
+                                         _vrb[i].super.src_len,
+                                         l2addr_str),
+                  (unsigned)_vrb[i].super.datagram_size, _vrb[i].super.tag);
+            gnrc_sixlowpan_frag_vrb_rm(&_vrb[i]);
+        }
+    }
+}
+
+int gnrc_sixlowpan_frag_vrb_send(gnrc_sixlowpan_frag_vrb_t *vrb,
+                                 gnrc_pktsnip_t *frag, size_t size)
+{
+    sixlowpan_frag_t *frag_hdr = frag->data;
+    gnrc_pktsnip_t *netif;
+    gnrc_netif_hdr_t *netif_hdr;
+
+    assert(frag->size >= sizeof(sixlowpan_frag_t));
+    netif = gnrc_netif_hdr_build(NULL, 0, vrb->out_dst, vrb->out_dst_len);
+    if (netif == NULL) {
+        DEBUG("6lo vrb: error allocating link-layer header\n");
+        gnrc_pktbuf_release(frag);
+        return -ENOMEM;
+    }
+    netif_hdr = netif->data;
+    netif_hdr->if_pid = vrb->out_netif->pid;
+    frag_hdr->tag = byteorder_htons(vrb->out_tag);
+    vrb->super.current_size += size;
+    vrb->super.arrival = xtimer_now_usec();
+    if (vrb->super.current_size < vrb->super.datagram_size) {
+        /* Tell the link layer that we will send more fragments */
+        netif_hdr->flags |= GNRC_NETIF_HDR_FLAGS_MORE_DATA;
+    }
+    else {
+        DEBUG("6lo vrb: datagram forwarded completely\n");
+        gnrc_sixlowpan_frag_vrb_rm(vrb);
+    }
+    LL_PREPEND(frag, netif);
+    gnrc_sixlowpan_dispatch_send(frag, NULL, 0);
+    return 0;
+}
+
+#ifdef TEST_SUITES
+void gnrc_sixlowpan_frag_vrb_reset(void)
+{
+    memset(_vrb, 0, sizeof(_vrb));
+}
+#endif
+
+/** @} */
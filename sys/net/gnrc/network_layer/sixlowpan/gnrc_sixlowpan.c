@@ -12,6 +12,8 @@
  * @file
  */
 
+#include <stdbool.h>
+
 #include "kernel_types.h"
 #include "net/gnrc.h"
 #include "thread.h"
@@ -20,28 +22,44 @@
 #include "net/gnrc/ipv6/hdr.h"
 #include "net/gnrc/sixlowpan.h"
 #include "net/gnrc/sixlowpan/frag.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+#include "net/gnrc/sixlowpan/frag/sfr.h"
+#endif
 #include "net/gnrc/sixlowpan/iphc.h"
 #include "net/gnrc/netif.h"
 #include "net/sixlowpan.h"
 
+#ifdef MODULE_GNRC_EVENT_LOOP
+#include "net/gnrc/event_loop.h"
+#endif
+
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 
+#ifndef MODULE_GNRC_EVENT_LOOP
 #if ENABLE_DEBUG
 static char _stack[GNRC_SIXLOWPAN_STACK_SIZE + THREAD_EXTRA_STACKSIZE_PRINTF];
 #else
 static char _stack[GNRC_SIXLOWPAN_STACK_SIZE];
 #endif
+#endif
 
 
 /* handles GNRC_NETAPI_MSG_TYPE_RCV commands */
 static void _receive(gnrc_pktsnip_t *pkt);
 /* handles GNRC_NETAPI_MSG_TYPE_SND commands */
 static void _send(gnrc_pktsnip_t *pkt);
+/* handles a message for 6LoWPAN, returns false if it is not meant for
+ * 6LoWPAN */
+static bool _handle_msg(msg_t *msg);
+#ifdef MODULE_GNRC_EVENT_LOOP
+static gnrc_event_loop_layer_t _layer = GNRC_EVENT_LOOP_LAYER_INIT(_handle_msg);
+#else
 /* Main event loop for 6LoWPAN */
 static void *_event_loop(void *args);
+#endif
 
 kernel_pid_t gnrc_sixlowpan_init(void)
 {
@@ -49,8 +67,15 @@ kernel_pid_t gnrc_sixlowpan_init(void)
         return _pid;
     }
 
+#ifdef MODULE_GNRC_EVENT_LOOP
+    _pid = gnrc_event_loop_init();
+    /* register interest in all 6LoWPAN packets */
+    gnrc_event_loop_register(&_layer, GNRC_NETTYPE_SIXLOWPAN,
+                             GNRC_NETREG_DEMUX_CTX_ALL);
+#else
     _pid = thread_create(_stack, sizeof(_stack), GNRC_SIXLOWPAN_PRIO,
                          THREAD_CREATE_STACKTEST, _event_loop, NULL, "6lo");
+#endif
 
     return _pid;
 }
@@ -218,6 +243,13 @@ static void _receive(gnrc_pktsnip_t *pkt)
         return;
     }
 #endif
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    else if (sixlowpan_sfr_is((sixlowpan_sfr_t *)dispatch)) {
+        DEBUG("6lo: received 6LoWPAN recoverable fragment\n");
+        gnrc_sixlowpan_frag_sfr_recv(pkt, NULL, 0);
+        return;
+    }
+#endif
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC
     else if (sixlowpan_iphc_is(dispatch)) {
         DEBUG("6lo: received 6LoWPAN IPHC comressed datagram\n");
@@ -305,9 +337,56 @@ static void _send(gnrc_pktsnip_t *pkt)
     gnrc_sixlowpan_multiplex_by_size(pkt, datagram_size, netif, 0);
 }
 
+static bool _handle_msg(msg_t *msg)
+{
+    switch (msg->type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_RCV received\n");
+            _receive(msg->content.ptr);
+            break;
+
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_SND received\n");
+            _send(msg->content.ptr);
+            break;
+
+        case GNRC_NETAPI_MSG_TYPE_GET:
+        case GNRC_NETAPI_MSG_TYPE_SET: {
+            msg_t reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK,
+                            .content = { .value = (uint32_t)-ENOTSUP } };
+
+            DEBUG("6lo: reply to unsupported get/set\n");
+            msg_reply(msg, &reply);
+            break;
+        }
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG
+        case GNRC_SIXLOWPAN_MSG_FRAG_SND:
+            DEBUG("6lo: send fragmented event received\n");
+            gnrc_sixlowpan_frag_send(NULL, msg->content.ptr, 0);
+            break;
+        case GNRC_SIXLOWPAN_MSG_FRAG_GC_RBUF:
+            DEBUG("6lo: garbage collect reassembly buffer event received\n");
+            gnrc_sixlowpan_frag_rbuf_gc();
+            break;
+#endif
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+        case GNRC_SIXLOWPAN_MSG_FRAG_SFR_ARQ_TIMEOUT:
+            DEBUG("6lo: acknowledgment timeout event received\n");
+            gnrc_sixlowpan_frag_sfr_arq_timeout(msg->content.ptr);
+            break;
+#endif
+
+        default:
+            DEBUG("6lo: operation not supported\n");
+            return false;
+    }
+    return true;
+}
+
+#ifndef MODULE_GNRC_EVENT_LOOP
 static void *_event_loop(void *args)
 {
-    msg_t msg, reply, msg_q[GNRC_SIXLOWPAN_MSG_QUEUE_SIZE];
+    msg_t msg, msg_q[GNRC_SIXLOWPAN_MSG_QUEUE_SIZE];
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             sched_active_pid);
 
@@ -317,49 +396,15 @@ static void *_event_loop(void *args)
     /* register interest in all 6LoWPAN packets */
     gnrc_netreg_register(GNRC_NETTYPE_SIXLOWPAN, &me_reg);
 
-    /* preinitialize ACK */
-    reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
-
     /* start event loop */
     while (1) {
         DEBUG("6lo: waiting for incoming message.\n");
         msg_receive(&msg);
-
-        switch (msg.type) {
-            case GNRC_NETAPI_MSG_TYPE_RCV:
-                DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_RCV received\n");
-                _receive(msg.content.ptr);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_SND:
-                DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_SND received\n");
-                _send(msg.content.ptr);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_GET:
-            case GNRC_NETAPI_MSG_TYPE_SET:
-                DEBUG("6lo: reply to unsupported get/set\n");
-                reply.content.value = -ENOTSUP;
-                msg_reply(&msg, &reply);
-                break;
-#ifdef MODULE_GNRC_SIXLOWPAN_FRAG
-            case GNRC_SIXLOWPAN_MSG_FRAG_SND:
-                DEBUG("6lo: send fragmented event received\n");
-                gnrc_sixlowpan_frag_send(NULL, msg.content.ptr, 0);
-                break;
-            case GNRC_SIXLOWPAN_MSG_FRAG_GC_RBUF:
-                DEBUG("6lo: garbage collect reassembly buffer event received\n");
-                gnrc_sixlowpan_frag_rbuf_gc();
-                break;
-#endif
-
-            default:
-                DEBUG("6lo: operation not supported\n");
-                break;
-        }
+        _handle_msg(&msg);
     }
 
     return NULL;
 }
+#endif
 
 /** @} */
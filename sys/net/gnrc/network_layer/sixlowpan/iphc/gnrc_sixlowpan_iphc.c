@@ -22,9 +22,18 @@
 #include "net/ipv6/hdr.h"
 #include "net/gnrc.h"
 #include "net/gnrc/netif/internal.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+#include "net/gnrc/ipv6/nib.h"
+#endif
 #include "net/gnrc/sixlowpan.h"
 #include "net/gnrc/sixlowpan/ctx.h"
 #include "net/gnrc/sixlowpan/frag.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#endif
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+#include "net/gnrc/sixlowpan/iphc/cache.h"
+#endif
 #include "net/gnrc/sixlowpan/internal.h"
 #include "net/sixlowpan.h"
 #include "utlist.h"
@@ -92,6 +101,53 @@
 #define NHC_UDP_8BIT_PORT           (0xF000)
 #define NHC_UDP_8BIT_MASK           (0xFF00)
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+/* forwards the datagram in rbuf using the virtual reassembly buffer */
+static bool _vrb_forward(gnrc_sixlowpan_rbuf_t *rbuf, gnrc_netif_t *iface,
+                         size_t frag_size);
+#endif
+
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+/* maximum length of IPHC with all addresses and UDP NHC inline:
+ * IPHC + CID + TF + NH + HL + 2 * address + UDP NHC */
+#define IPHC_CACHE_HDR_MAX_LEN      (SIXLOWPAN_IPHC_HDR_LEN + \
+                                     SIXLOWPAN_IPHC_CID_EXT_LEN + 4U + 1U + 1U + \
+                                     (2U * sizeof(ipv6_addr_t)) + 7U)
+
+/**
+ * @brief   Fields of a packet that determine its compressed headers
+ */
+typedef struct {
+    ipv6_addr_t src;            /**< source address */
+    ipv6_addr_t dst;            /**< destination address */
+    network_uint32_t v_tc_fl;   /**< version, traffic class, and flow label */
+    network_uint16_t src_port;  /**< UDP source port (if compressed) */
+    network_uint16_t dst_port;  /**< UDP destination port (if compressed) */
+    kernel_pid_t iface;         /**< interface the packet is sent over */
+    uint8_t nh;                 /**< next header */
+    uint8_t hl;                 /**< hop limit */
+    uint8_t l2addr_len;         /**< length of _iphc_cache_key_t::l2addr */
+    uint8_t l2addr[GNRC_NETIF_HDR_L2ADDR_MAX_LEN];  /**< link-layer
+                                                     *   destination */
+} _iphc_cache_key_t;
+
+/**
+ * @brief   Compression cache entry
+ */
+typedef struct {
+    _iphc_cache_key_t key;      /**< the flow */
+    unsigned gen;               /**< @ref gnrc_sixlowpan_iphc_cache_gen at the
+                                 *   time the headers were compressed */
+    uint16_t ctx_used;          /**< bitmap of context IDs used */
+    uint8_t hdr_len;            /**< length of _iphc_cache_t::hdr */
+    uint8_t hdr[IPHC_CACHE_HDR_MAX_LEN];    /**< the compressed headers */
+} _iphc_cache_t;
+
+unsigned gnrc_sixlowpan_iphc_cache_gen = 1;
+
+static _iphc_cache_t _iphc_cache[GNRC_SIXLOWPAN_IPHC_CACHE_SIZE];
+#endif
+
 static inline bool _context_overlaps_iid(gnrc_sixlowpan_ctx_t *ctx,
                                          ipv6_addr_t *addr,
                                          eui64_t *iid)
@@ -578,6 +634,15 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
            sixlo->size - payload_offset);
     if (rbuf != NULL) {
         rbuf->super.current_size += (uncomp_hdr_len - payload_offset);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+        /* recoverable fragments are acknowledged by the reassembling node */
+        if (sixlowpan_frag_is(sixlo->next->data) &&
+            _vrb_forward(rbuf, iface, uncomp_hdr_len +
+                                      (sixlo->size - payload_offset))) {
+            gnrc_pktbuf_release(sixlo);
+            return;
+        }
+#endif
         gnrc_sixlowpan_frag_rbuf_dispatch_when_complete(rbuf, netif_hdr);
     }
     else {
@@ -654,72 +719,25 @@ static inline bool _compressible(gnrc_pktsnip_t *hdr)
     }
 }
 
-void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
+static inline void _set_ctx_used(uint16_t *ctx_used,
+                                 const gnrc_sixlowpan_ctx_t *ctx)
+{
+    *ctx_used |= (1U << (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK));
+}
+
+/* writes the compressed headers of pkt (starting with its netif header) to
+ * iphc_hdr and marks the contexts used for it in ctx_used. Returns the length
+ * of the compressed headers or 0 on error */
+static uint16_t _iphc_hdr_encode(gnrc_pktsnip_t *pkt, uint8_t *iphc_hdr,
+                                 uint16_t *ctx_used)
 {
-    assert(pkt != NULL);
     gnrc_netif_hdr_t *netif_hdr = pkt->data;
-    ipv6_hdr_t *ipv6_hdr;
+    ipv6_hdr_t *ipv6_hdr = pkt->next->data;
     gnrc_netif_t *iface = gnrc_netif_hdr_get_netif(netif_hdr);
-    uint8_t *iphc_hdr;
     gnrc_sixlowpan_ctx_t *src_ctx = NULL, *dst_ctx = NULL;
-    gnrc_pktsnip_t *dispatch, *ptr = pkt->next;
     bool addr_comp = false;
-    size_t dispatch_size = 0;
-    /* datagram size before compression */
-    size_t orig_datagram_size = gnrc_pkt_len(pkt->next);
     uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
 
-    (void)ctx;
-    dispatch = NULL;    /* use dispatch as temporary pointer for prev */
-    /* determine maximum dispatch size and write protect all headers until
-     * then because they will be removed */
-    while ((ptr != NULL) && _compressible(ptr)) {
-        gnrc_pktsnip_t *tmp = gnrc_pktbuf_start_write(ptr);
-
-        if (tmp == NULL) {
-            DEBUG("6lo iphc: unable to write protect compressible header\n");
-            if (addr_comp) {    /* addr_comp was used as release indicator */
-                gnrc_pktbuf_release(pkt);
-            }
-            return;
-        }
-        ptr = tmp;
-        if (dispatch == NULL) {
-            /* pkt was already write protected in gnrc_sixlowpan.c:_send so
-             * we shouldn't do it again */
-            pkt->next = ptr;    /* reset original packet */
-        }
-        else {
-            dispatch->next = ptr;
-        }
-        if (ptr->type == GNRC_NETTYPE_UNDEF) {
-            /* most likely UDP for now so use that (XXX: extend if extension
-             * headers make problems) */
-            dispatch_size += sizeof(udp_hdr_t);
-            break;  /* nothing special after UDP so quit even if more UNDEF
-                     * come */
-        }
-        else {
-            dispatch_size += ptr->size;
-        }
-        dispatch = ptr; /* use dispatch as temporary point for prev */
-        ptr = ptr->next;
-    }
-    /* there should be at least one compressible header in `pkt`, otherwise this
-     * function should not be called */
-    assert(dispatch_size > 0);
-    ipv6_hdr = pkt->next->data;
-    dispatch = gnrc_pktbuf_add(NULL, NULL, dispatch_size,
-                               GNRC_NETTYPE_SIXLOWPAN);
-
-    if (dispatch == NULL) {
-        DEBUG("6lo iphc: error allocating dispatch space\n");
-        gnrc_pktbuf_release(pkt);
-        return;
-    }
-
-    iphc_hdr = dispatch->data;
-
     /* set initial dispatch value*/
     iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
     iphc_hdr[IPHC2_IDX] = 0;
@@ -828,6 +846,7 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
         if (src_ctx != NULL) {
             /* stateful source address compression */
             iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_SAC;
+            _set_ctx_used(ctx_used, src_ctx);
 
             if (((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) {
                 iphc_hdr[CID_EXT_IDX] |= ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) << 4);
@@ -842,8 +861,7 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
             if (gnrc_netif_ipv6_get_iid(iface, &iid) < 0) {
                 DEBUG("6lo iphc: could not get interface's IID\n");
                 gnrc_netif_release(iface);
-                gnrc_pktbuf_release(pkt);
-                return;
+                return 0;
             }
             gnrc_netif_release(iface);
 
@@ -935,6 +953,7 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
                  * (https://tools.ietf.org/html/rfc3306) with given context
                  * for unicast prefix -> context based compression */
                 iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_DAC;
+                _set_ctx_used(ctx_used, ctx);
                 if ((ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0) {
                     iphc_hdr[CID_EXT_IDX] |= (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
                 }
@@ -953,6 +972,7 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
         if (dst_ctx != NULL) {
             /* stateful destination address compression */
             iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_DAC;
+            _set_ctx_used(ctx_used, dst_ctx);
 
             if (((dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) {
                 iphc_hdr[CID_EXT_IDX] |= (dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
@@ -961,8 +981,7 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
 
         if (gnrc_netif_hdr_ipv6_iid_from_dst(iface, netif_hdr, &iid) < 0) {
             DEBUG("6lo iphc: could not get destination's IID\n");
-            gnrc_pktbuf_release(pkt);
-            return;
+            return 0;
         }
 
         if ((ipv6_hdr->dst.u64[1].u64 == iid.uint64.u64) ||
@@ -996,12 +1015,196 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
     }
 
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
-    switch (ipv6_hdr->nh) {
+    if (ipv6_hdr->nh == PROTNUM_UDP) {
+        gnrc_pktsnip_t *udp = pkt->next->next;
+
+        assert(udp->size >= sizeof(udp_hdr_t));
+        inline_pos += iphc_nhc_udp_encode(&iphc_hdr[inline_pos], udp);
+    }
+#endif
+
+    return inline_pos;
+}
+
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+static void _cache_key(const gnrc_pktsnip_t *pkt, _iphc_cache_key_t *key)
+{
+    const gnrc_netif_hdr_t *netif_hdr = pkt->data;
+    const ipv6_hdr_t *ipv6_hdr = pkt->next->data;
+
+    /* zero padding and unused fields so keys can be compared with memcmp() */
+    memset(key, 0, sizeof(*key));
+    key->src = ipv6_hdr->src;
+    key->dst = ipv6_hdr->dst;
+    key->v_tc_fl = ipv6_hdr->v_tc_fl;
+    key->iface = netif_hdr->if_pid;
+    key->nh = ipv6_hdr->nh;
+    key->hl = ipv6_hdr->hl;
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
+    /* the ports stay 0 if there is no UDP header to take them from */
+    if ((ipv6_hdr->nh == PROTNUM_UDP) && (pkt->next->next != NULL) &&
+        (pkt->next->next->size >= sizeof(udp_hdr_t))) {
+        const udp_hdr_t *udp_hdr = pkt->next->next->data;
+
+        key->src_port = udp_hdr->src_port;
+        key->dst_port = udp_hdr->dst_port;
+    }
+#endif
+    key->l2addr_len = netif_hdr->dst_l2addr_len;
+    memcpy(key->l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+           netif_hdr->dst_l2addr_len);
+}
+
+static _iphc_cache_t *_cache_slot(const _iphc_cache_key_t *key)
+{
+    uint32_t hash = key->dst.u32[3].u32 ^ key->src_port.u16 ^
+                    (key->dst_port.u16 << 16) ^ key->iface;
+
+    return &_iphc_cache[((hash * 2654435761U) >> 16) %
+                        GNRC_SIXLOWPAN_IPHC_CACHE_SIZE];
+}
+
+/* copies the cached compressed headers of pkt's flow to iphc_hdr. Returns
+ * their length or 0 if they are not cached */
+static uint16_t _cache_get(const gnrc_pktsnip_t *pkt,
+                           const _iphc_cache_key_t *key, uint8_t *iphc_hdr)
+{
+    const _iphc_cache_t *entry = _cache_slot(key);
+
+    if ((entry->hdr_len == 0) ||
+        (entry->gen != gnrc_sixlowpan_iphc_cache_gen) ||
+        (memcmp(&entry->key, key, sizeof(*key)) != 0)) {
+        return 0;
+    }
+    /* contexts may expire without invalidating the cache */
+    for (uint8_t id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
+        if (entry->ctx_used & (1U << id)) {
+            gnrc_sixlowpan_ctx_t *ctx = gnrc_sixlowpan_ctx_lookup_id(id);
+
+            if ((ctx == NULL) ||
+                !(ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
+                return 0;
+            }
+        }
+    }
+    DEBUG("6lo iphc: using cached compression\n");
+    memcpy(iphc_hdr, entry->hdr, entry->hdr_len);
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
+    if (key->nh == PROTNUM_UDP) {
+        const udp_hdr_t *udp_hdr = pkt->next->next->data;
+
+        /* checksum is the only field carried inline that varies in a flow */
+        memcpy(&iphc_hdr[entry->hdr_len - sizeof(udp_hdr->checksum)],
+               &udp_hdr->checksum, sizeof(udp_hdr->checksum));
+    }
+#else
+    (void)pkt;
+#endif
+    return entry->hdr_len;
+}
+
+static void _cache_put(const _iphc_cache_key_t *key, unsigned gen,
+                       uint16_t ctx_used, const uint8_t *iphc_hdr,
+                       uint16_t hdr_len)
+{
+    _iphc_cache_t *entry = _cache_slot(key);
+
+    if (hdr_len > sizeof(entry->hdr)) {
+        return;
+    }
+    entry->key = *key;
+    entry->gen = gen;
+    entry->ctx_used = ctx_used;
+    entry->hdr_len = hdr_len;
+    memcpy(entry->hdr, iphc_hdr, hdr_len);
+}
+#endif  /* MODULE_GNRC_SIXLOWPAN_IPHC_CACHE */
+
+static gnrc_pktsnip_t *_iphc_encode(gnrc_pktsnip_t *pkt)
+{
+    assert(pkt != NULL);
+    gnrc_pktsnip_t *dispatch, *ptr = pkt->next;
+    bool addr_comp = false;
+    size_t dispatch_size = 0;
+    uint16_t inline_pos = 0, ctx_used = 0;
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+    _iphc_cache_key_t key;
+    unsigned gen;
+#endif
+
+    dispatch = NULL;    /* use dispatch as temporary pointer for prev */
+    /* determine maximum dispatch size and write protect all headers until
+     * then because they will be removed */
+    while ((ptr != NULL) && _compressible(ptr)) {
+        gnrc_pktsnip_t *tmp = gnrc_pktbuf_start_write(ptr);
+
+        if (tmp == NULL) {
+            DEBUG("6lo iphc: unable to write protect compressible header\n");
+            if (addr_comp) {    /* addr_comp was used as release indicator */
+                gnrc_pktbuf_release(pkt);
+            }
+            return NULL;
+        }
+        ptr = tmp;
+        if (dispatch == NULL) {
+            /* pkt was already write protected in gnrc_sixlowpan.c:_send so
+             * we shouldn't do it again */
+            pkt->next = ptr;    /* reset original packet */
+        }
+        else {
+            dispatch->next = ptr;
+        }
+        if (ptr->type == GNRC_NETTYPE_UNDEF) {
+            /* most likely UDP for now so use that (XXX: extend if extension
+             * headers make problems) */
+            dispatch_size += sizeof(udp_hdr_t);
+            break;  /* nothing special after UDP so quit even if more UNDEF
+                     * come */
+        }
+        else {
+            dispatch_size += ptr->size;
+        }
+        dispatch = ptr; /* use dispatch as temporary point for prev */
+        ptr = ptr->next;
+    }
+    /* there should be at least one compressible header in `pkt`, otherwise this
+     * function should not be called */
+    assert(dispatch_size > 0);
+    dispatch = gnrc_pktbuf_add(NULL, NULL, dispatch_size,
+                               GNRC_NETTYPE_SIXLOWPAN);
+
+    if (dispatch == NULL) {
+        DEBUG("6lo iphc: error allocating dispatch space\n");
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+    _cache_key(pkt, &key);
+    inline_pos = _cache_get(pkt, &key, dispatch->data);
+    if (inline_pos == 0) {
+        /* a context or address changing while compressing invalidates the
+         * result for the cache */
+        gen = gnrc_sixlowpan_iphc_cache_gen;
+        inline_pos = _iphc_hdr_encode(pkt, dispatch->data, &ctx_used);
+        if (inline_pos > 0) {
+            _cache_put(&key, gen, ctx_used, dispatch->data, inline_pos);
+        }
+    }
+#else
+    inline_pos = _iphc_hdr_encode(pkt, dispatch->data, &ctx_used);
+#endif
+    if (inline_pos == 0) {
+        gnrc_pktbuf_release(dispatch);
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
+    switch (((ipv6_hdr_t *)pkt->next->data)->nh) {
         case PROTNUM_UDP: {
             gnrc_pktsnip_t *udp = pkt->next->next;
 
-            assert(udp->size >= sizeof(udp_hdr_t));
-            inline_pos += iphc_nhc_udp_encode(&iphc_hdr[inline_pos], udp);
             /* remove UDP header */
             if (udp->size > sizeof(udp_hdr_t)) {
                 udp = gnrc_pktbuf_mark(udp, sizeof(udp_hdr_t),
@@ -1010,7 +1213,8 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
                 if (udp == NULL) {
                     DEBUG("gnrc_sixlowpan_iphc_encode: unable to mark UDP header\n");
                     gnrc_pktbuf_release(dispatch);
-                    return;
+                    gnrc_pktbuf_release(pkt);
+                    return NULL;
                 }
             }
             gnrc_pktbuf_remove_snip(pkt, udp);
@@ -1032,7 +1236,163 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
     dispatch->next = pkt->next;
     pkt->next = dispatch;
 
-    gnrc_netif_t *netif = gnrc_netif_hdr_get_netif(netif_hdr);
+    return pkt;
+}
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+static bool _vrb_forwardable(const gnrc_sixlowpan_rbuf_t *rbuf,
+                             gnrc_netif_t *iface, size_t frag_size)
+{
+    const ipv6_hdr_t *ipv6_hdr = rbuf->pkt->data;
+
+    return (iface != NULL) && gnrc_netif_is_rtr(iface) &&
+           /* datagram was not complete yet */
+           (rbuf->super.current_size < rbuf->super.datagram_size) &&
+           (frag_size > sizeof(ipv6_hdr_t)) &&
+           (ipv6_hdr->hl > 1) &&
+           /* IPv6 layer needs to process these */
+           (ipv6_hdr->nh != PROTNUM_IPV6_EXT_HOPOPT) &&
+           (ipv6_hdr->nh != PROTNUM_IPV6_EXT_RH) &&
+           /* compression of inline UDP header requires the full header */
+           ((ipv6_hdr->nh != PROTNUM_UDP) ||
+            (frag_size >= (sizeof(ipv6_hdr_t) + sizeof(udp_hdr_t)))) &&
+           !ipv6_addr_is_multicast(&ipv6_hdr->dst) &&
+           !ipv6_addr_is_link_local(&ipv6_hdr->dst) &&
+           (gnrc_netif_get_by_ipv6_addr(&ipv6_hdr->dst) == NULL);
+}
+
+static gnrc_pktsnip_t *_vrb_frag1(const gnrc_sixlowpan_rbuf_t *rbuf,
+                                  size_t frag_size, gnrc_netif_t *out,
+                                  const gnrc_ipv6_nib_nc_t *nce)
+{
+    const uint8_t *data = rbuf->pkt->data;
+    gnrc_pktsnip_t *pkt, *ipv6, *netif;
+    gnrc_netif_hdr_t *netif_hdr;
+    ipv6_hdr_t *ipv6_hdr;
+
+    /* payload type as if it was forwarded by the IPv6 layer */
+    pkt = gnrc_pktbuf_add(NULL, data + sizeof(ipv6_hdr_t),
+                          frag_size - sizeof(ipv6_hdr_t), GNRC_NETTYPE_UNDEF);
+    if (pkt == NULL) {
+        return NULL;
+    }
+    ipv6 = gnrc_pktbuf_add(pkt, data, sizeof(ipv6_hdr_t), GNRC_NETTYPE_IPV6);
+    if (ipv6 == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    pkt = ipv6;
+    ipv6_hdr = pkt->data;
+    ipv6_hdr->hl--;
+    netif = gnrc_netif_hdr_build(NULL, 0, nce->l2addr, nce->l2addr_len);
+    if (netif == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    netif_hdr = netif->data;
+    netif_hdr->if_pid = out->pid;
+    LL_PREPEND(pkt, netif);
+    if ((pkt = _iphc_encode(pkt)) == NULL) {
+        return NULL;
+    }
+    /* first fragment must still fit into one frame of the outgoing
+     * interface */
+    if ((gnrc_pkt_len(pkt->next) + sizeof(sixlowpan_frag_t)) >
+        out->sixlo.max_frag_size) {
+        DEBUG("6lo iphc: first fragment too big for next hop\n");
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    /* netif header is built by the virtual reassembly buffer */
+    return gnrc_pktbuf_remove_snip(pkt, pkt);
+}
+
+static bool _vrb_forward(gnrc_sixlowpan_rbuf_t *rbuf, gnrc_netif_t *iface,
+                         size_t frag_size)
+{
+    const ipv6_hdr_t *ipv6_hdr = rbuf->pkt->data;
+    gnrc_sixlowpan_frag_vrb_t *vrb;
+    gnrc_pktsnip_t *pkt, *frag;
+    gnrc_netif_t *out;
+    gnrc_ipv6_nib_nc_t nce;
+    gnrc_sixlowpan_rbuf_int_t interval;
+    sixlowpan_frag_t *frag_hdr;
+
+    if (!_vrb_forwardable(rbuf, iface, frag_size) ||
+        (gnrc_ipv6_nib_get_next_hop_l2addr(&ipv6_hdr->dst, NULL, NULL,
+                                           &nce) < 0)) {
+        return false;
+    }
+    out = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
+    /* subsequent fragments are forwarded as they are, so they need to fit
+     * into the frames of the outgoing interface */
+    if ((out == NULL) || !(out->flags & GNRC_NETIF_FLAGS_6LO_HC) ||
+        (out->sixlo.max_frag_size == 0) ||
+        (out->sixlo.max_frag_size < iface->sixlo.max_frag_size)) {
+        return false;
+    }
+    if ((pkt = _vrb_frag1(rbuf, frag_size, out, &nce)) == NULL) {
+        return false;
+    }
+    vrb = gnrc_sixlowpan_frag_vrb_add(&rbuf->super, out, nce.l2addr,
+                                      nce.l2addr_len);
+    if (vrb == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return false;
+    }
+    frag = gnrc_pktbuf_add(pkt, NULL, sizeof(sixlowpan_frag_t),
+                           GNRC_NETTYPE_SIXLOWPAN);
+    if (frag == NULL) {
+        gnrc_sixlowpan_frag_vrb_rm(vrb);
+        gnrc_pktbuf_release(pkt);
+        return false;
+    }
+    frag_hdr = frag->data;
+    frag_hdr->disp_size = byteorder_htons(rbuf->super.datagram_size);
+    frag_hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+    DEBUG("6lo iphc: forward first fragment using VRB\n");
+    gnrc_sixlowpan_frag_vrb_send(vrb, frag, frag_size);
+    /* forward fragments that arrived before the first fragment (starting
+     * after offset 0). Since the datagram is not complete, vrb stays valid
+     * while doing so. */
+    for (uint16_t from = 1U;
+         gnrc_sixlowpan_frag_rbuf_int_get(rbuf, from, &interval);
+         from = interval.end + 1U) {
+        size_t size = interval.end - interval.start + 1;
+        sixlowpan_frag_n_t *frag_n_hdr;
+
+        frag = gnrc_pktbuf_add(NULL, NULL, sizeof(sixlowpan_frag_n_t) + size,
+                               GNRC_NETTYPE_SIXLOWPAN);
+        if (frag == NULL) {
+            DEBUG("6lo iphc: unable to forward fragment (offset = %u)\n",
+                  interval.start);
+            continue;
+        }
+        frag_n_hdr = frag->data;
+        frag_n_hdr->disp_size = byteorder_htons(rbuf->super.datagram_size);
+        frag_n_hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+        frag_n_hdr->offset = interval.start >> 3;
+        memcpy(frag_n_hdr + 1, ((uint8_t *)rbuf->pkt->data) + interval.start,
+               size);
+        gnrc_sixlowpan_frag_vrb_send(vrb, frag, size);
+    }
+    gnrc_pktbuf_release(rbuf->pkt);
+    gnrc_sixlowpan_frag_rbuf_remove(rbuf);
+    return true;
+}
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+
+void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
+{
+    assert(pkt != NULL);
+    gnrc_netif_t *netif = gnrc_netif_hdr_get_netif(pkt->data);
+    /* datagram size before compression */
+    size_t orig_datagram_size = gnrc_pkt_len(pkt->next);
+
+    (void)ctx;
+    if ((pkt = _iphc_encode(pkt)) == NULL) {
+        return;
+    }
     assert(netif != NULL);
     gnrc_sixlowpan_multiplex_by_size(pkt, orig_datagram_size, netif, page);
 }
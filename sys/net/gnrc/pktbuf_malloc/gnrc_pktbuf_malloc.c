@@ -254,6 +254,12 @@ void gnrc_pktbuf_stats(void)
 {
     LOG_INFO("pktbuf: no stat output for gnrc_pktbuf_malloc, use tools like valgrind\n");
 }
+
+size_t gnrc_pktbuf_high_water(bool reset)
+{
+    (void)reset;
+    return 0;
+}
 #endif
 
 #ifdef TEST_SUITES
@@ -0,0 +1,503 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Packet buffer implementation based on segregated slabs
+ *
+ * Packet snips and data are allocated from a set of @ref sys_memarray pools
+ * of fixed-size blocks. Data is put into the smallest class it fits into.
+ * gnrc_pktbuf_mark() splits a data block between two snips without copying,
+ * so every data block carries a usage counter and is only returned to its
+ * pool after the last snip referencing it is released.
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/types.h>
+
+#include "memarray.h"
+#include "mutex.h"
+#include "utlist.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+/* number of pointer-sized words a block of size bytes needs */
+#define _WORDS(size)        (((size) + sizeof(void *) - 1) / sizeof(void *))
+#define _BLOCK_SIZE(size)   (_WORDS(size) * sizeof(void *))
+
+/* class 0 holds the packet snips, the others hold packet data */
+#define _SNIP_CLASS         (0U)
+#define _CLASS_NUMOF        (5U)
+
+typedef struct {
+    memarray_t mem;         /**< pool of the class */
+    uint8_t *buf;           /**< start of the pool's storage */
+    uint8_t *users;         /**< usage counter per block */
+    uint16_t size;          /**< block size */
+    uint16_t numof;         /**< number of blocks */
+    uint16_t used;          /**< number of blocks in use */
+    uint16_t max_used;      /**< high-water mark of used */
+    uint16_t fails;         /**< allocations that did not fit into the class */
+} _slab_t;
+
+static mutex_t _mutex = MUTEX_INIT;
+
+static void *_buf_snip[GNRC_PKTBUF_SLAB_SNIP_NUMOF *
+                       _WORDS(sizeof(gnrc_pktsnip_t))];
+static void *_buf_1[GNRC_PKTBUF_SLAB_NUMOF_1 * _WORDS(GNRC_PKTBUF_SLAB_SIZE_1)];
+static void *_buf_2[GNRC_PKTBUF_SLAB_NUMOF_2 * _WORDS(GNRC_PKTBUF_SLAB_SIZE_2)];
+static void *_buf_3[GNRC_PKTBUF_SLAB_NUMOF_3 * _WORDS(GNRC_PKTBUF_SLAB_SIZE_3)];
+static void *_buf_4[GNRC_PKTBUF_SLAB_NUMOF_4 * _WORDS(GNRC_PKTBUF_SLAB_SIZE_4)];
+static uint8_t _users_snip[GNRC_PKTBUF_SLAB_SNIP_NUMOF];
+static uint8_t _users_1[GNRC_PKTBUF_SLAB_NUMOF_1];
+static uint8_t _users_2[GNRC_PKTBUF_SLAB_NUMOF_2];
+static uint8_t _users_3[GNRC_PKTBUF_SLAB_NUMOF_3];
+static uint8_t _users_4[GNRC_PKTBUF_SLAB_NUMOF_4];
+
+static _slab_t _slabs[_CLASS_NUMOF] = {
+    { .buf = (uint8_t *)_buf_snip, .users = _users_snip,
+      .size = _BLOCK_SIZE(sizeof(gnrc_pktsnip_t)),
+      .numof = GNRC_PKTBUF_SLAB_SNIP_NUMOF },
+    { .buf = (uint8_t *)_buf_1, .users = _users_1,
+      .size = _BLOCK_SIZE(GNRC_PKTBUF_SLAB_SIZE_1),
+      .numof = GNRC_PKTBUF_SLAB_NUMOF_1 },
+    { .buf = (uint8_t *)_buf_2, .users = _users_2,
+      .size = _BLOCK_SIZE(GNRC_PKTBUF_SLAB_SIZE_2),
+      .numof = GNRC_PKTBUF_SLAB_NUMOF_2 },
+    { .buf = (uint8_t *)_buf_3, .users = _users_3,
+      .size = _BLOCK_SIZE(GNRC_PKTBUF_SLAB_SIZE_3),
+      .numof = GNRC_PKTBUF_SLAB_NUMOF_3 },
+    { .buf = (uint8_t *)_buf_4, .users = _users_4,
+      .size = _BLOCK_SIZE(GNRC_PKTBUF_SLAB_SIZE_4),
+      .numof = GNRC_PKTBUF_SLAB_NUMOF_4 },
+};
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+static void *_pktbuf_alloc(size_t size);
+static void _pktbuf_free(void *ptr);
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+/* finds the slab containing ptr and the index of the block ptr points into */
+static _slab_t *_slab_get(const void *ptr, unsigned *idx)
+{
+    for (unsigned i = 0; i < _CLASS_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+        size_t offset = (size_t)((const uint8_t *)ptr - slab->buf);
+
+        if (((const uint8_t *)ptr >= slab->buf) &&
+            (offset < ((size_t)slab->size * slab->numof))) {
+            *idx = offset / slab->size;
+            return slab;
+        }
+    }
+    return NULL;
+}
+
+static void *_slab_alloc(_slab_t *slab)
+{
+    uint8_t *block = memarray_alloc(&slab->mem);
+
+    if (block == NULL) {
+        return NULL;
+    }
+    slab->users[(block - slab->buf) / slab->size] = 1;
+    if (++slab->used > slab->max_used) {
+        slab->max_used = slab->used;
+    }
+    return block;
+}
+
+static inline size_t _max_size(void)
+{
+    return _slabs[_CLASS_NUMOF - 1].size;
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&_mutex);
+    for (unsigned i = 0; i < _CLASS_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+
+        memarray_init(&slab->mem, slab->buf, slab->size, slab->numof);
+        memset(slab->users, 0, slab->numof);
+        slab->used = 0;
+        slab->max_used = 0;
+        slab->fails = 0;
+    }
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > _max_size()) {
+        DEBUG("pktbuf: size (%u) > largest slab (%u)\n",
+              (unsigned)size, (unsigned)_max_size());
+        return NULL;
+    }
+    mutex_lock(&_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+    void *marked_data;
+
+    mutex_lock(&_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
+              "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
+              (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _slab_alloc(&_slabs[_SNIP_CLASS]);
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    marked_data = pkt->data;
+    if (pkt->size != size) {
+        unsigned idx;
+        _slab_t *slab = _slab_get(pkt->data, &idx);
+
+        /* both snips share the data block now */
+        if (slab != NULL) {
+            slab->users[idx]++;
+        }
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    else {
+        pkt->data = NULL;
+    }
+    pkt->size -= size;
+    _set_pktsnip(marked_snip, pkt->next, marked_data, size, type);
+    pkt->next = marked_snip;
+    mutex_unlock(&_mutex);
+    return marked_snip;
+}
+
+/* checks if data can grow to size without leaving its block */
+static bool _fits_in_place(void *data, size_t size)
+{
+    unsigned idx;
+    _slab_t *slab = _slab_get(data, &idx);
+
+    return (slab != NULL) && (slab->users[idx] == 1) &&
+           ((((uint8_t *)data) + size) <= (slab->buf + ((idx + 1) * slab->size)));
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL)));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&_mutex);
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        _pktbuf_free(pkt->data);
+        pkt->data = NULL;
+    }
+    /* if new size is bigger than old size and does not fit into the block */
+    else if ((size > pkt->size) &&
+             ((pkt->data == NULL) || !_fits_in_place(pkt->data, size))) {
+        void *new_data = _pktbuf_alloc(size);
+        if (new_data == NULL) {
+            DEBUG("pktbuf: error allocating new data section\n");
+            mutex_unlock(&_mutex);
+            return ENOMEM;
+        }
+        if (pkt->data != NULL) {            /* if old data exist */
+            memcpy(new_data, pkt->data, pkt->size);
+        }
+        _pktbuf_free(pkt->data);
+        pkt->data = new_data;
+    }
+    /* shrinking keeps the whole block until the snip is released */
+    pkt->size = size;
+    mutex_unlock(&_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&_mutex);
+    while (pkt) {
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&_mutex);
+}
+
+static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    while (pkt) {
+        gnrc_pktsnip_t *tmp;
+        assert(pkt->users > 0);
+        tmp = pkt->next;
+        if (pkt->users == 1) {
+            pkt->users = 0; /* not necessary but to be on the safe side */
+            _pktbuf_free(pkt->data);
+            _pktbuf_free(pkt);
+        }
+        else {
+            pkt->users--;
+        }
+        DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
+        gnrc_neterr_report(pkt, err);
+        pkt = tmp;
+    }
+}
+
+void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    mutex_lock(&_mutex);
+    _release_error_locked(pkt, err);
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&_mutex);
+        return new;
+    }
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+#ifdef DEVELHELP
+size_t gnrc_pktbuf_high_water(bool reset)
+{
+    size_t res = 0;
+
+    mutex_lock(&_mutex);
+    for (unsigned i = 0; i < _CLASS_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+
+        res += slab->max_used * slab->size;
+        if (reset) {
+            slab->max_used = slab->used;
+        }
+    }
+    mutex_unlock(&_mutex);
+    return res;
+}
+
+void gnrc_pktbuf_stats(void)
+{
+    mutex_lock(&_mutex);
+    puts("packet buffer: slab allocator");
+    puts(" class | size | numof | used | max used | fails");
+    for (unsigned i = 0; i < _CLASS_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+
+        printf(" %5u | %4u | %5u | %4u | %8u | %5u%s\n", i,
+               (unsigned)slab->size, (unsigned)slab->numof,
+               (unsigned)slab->used, (unsigned)slab->max_used,
+               (unsigned)slab->fails, (i == _SNIP_CLASS) ? " (snips)" : "");
+    }
+    mutex_unlock(&_mutex);
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned i = 0; i < _CLASS_NUMOF; i++) {
+        if (_slabs[i].used > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    /* Invariant of this implementation: the number of blocks with a usage
+     * counter > 0 equals the number of used blocks in each class */
+    for (unsigned i = 0; i < _CLASS_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+        unsigned used = 0;
+
+        for (unsigned j = 0; j < slab->numof; j++) {
+            if (slab->users[j] > 0) {
+                used++;
+            }
+        }
+        if (used != slab->used) {
+            return false;
+        }
+    }
+
+    return true;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _slab_alloc(&_slabs[_SNIP_CLASS]);
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _pktbuf_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            _pktbuf_free(pkt);
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+static void *_pktbuf_alloc(size_t size)
+{
+    /* take the smallest class that fits, fall back to larger ones if it is
+     * exhausted */
+    for (unsigned i = _SNIP_CLASS + 1; i < _CLASS_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+
+        if (size <= slab->size) {
+            void *data = _slab_alloc(slab);
+
+            if (data != NULL) {
+                return data;
+            }
+            slab->fails++;
+        }
+    }
+    DEBUG("pktbuf: no space left in packet buffer\n");
+    return NULL;
+}
+
+static void _pktbuf_free(void *ptr)
+{
+    unsigned idx;
+    _slab_t *slab;
+
+    if ((ptr == NULL) || ((slab = _slab_get(ptr, &idx)) == NULL)) {
+        return;
+    }
+    assert(slab->users[idx] > 0);
+    if (--slab->users[idx] == 0) {
+        memarray_free(&slab->mem, slab->buf + (idx * slab->size));
+        slab->used--;
+    }
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_duplicate_upto(gnrc_pktsnip_t *pkt, gnrc_nettype_t type)
+{
+    mutex_lock(&_mutex);
+
+    bool is_shared = pkt->users > 1;
+    size_t size = gnrc_pkt_len_upto(pkt, type);
+
+    DEBUG("ipv6_ext: duplicating %d octets\n", (int) size);
+
+    gnrc_pktsnip_t *tmp;
+    gnrc_pktsnip_t *target = gnrc_pktsnip_search_type(pkt, type);
+    gnrc_pktsnip_t *next = (target == NULL) ? NULL : target->next;
+    gnrc_pktsnip_t *new = _create_snip(next, NULL, size, type);
+
+    if (new == NULL) {
+        mutex_unlock(&_mutex);
+
+        return NULL;
+    }
+
+    /* copy payloads */
+    for (tmp = pkt; tmp != NULL; tmp = tmp->next) {
+        uint8_t *dest = ((uint8_t *)new->data) + (size - tmp->size);
+
+        memcpy(dest, tmp->data, tmp->size);
+
+        size -= tmp->size;
+
+        if (tmp->type == type) {
+            break;
+        }
+    }
+
+    /* decrements reference counters */
+
+    if (target != NULL) {
+        target->next = NULL;
+    }
+
+    _release_error_locked(pkt, GNRC_NETERR_SUCCESS);
+
+    if (is_shared && (target != NULL)) {
+        target->next = next;
+    }
+
+    mutex_unlock(&_mutex);
+
+    return new;
+}
+
+/** @} */
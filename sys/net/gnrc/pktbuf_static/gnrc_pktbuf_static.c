@@ -282,6 +282,19 @@ static inline void _print_unused(_unused_t *ptr)
 }
 #endif
 
+size_t gnrc_pktbuf_high_water(bool reset)
+{
+    size_t res;
+
+    mutex_lock(&_mutex);
+    res = max_byte_count;
+    if (reset) {
+        max_byte_count = 0;
+    }
+    mutex_unlock(&_mutex);
+    return res;
+}
+
 void gnrc_pktbuf_stats(void)
 {
 #ifdef MODULE_OD
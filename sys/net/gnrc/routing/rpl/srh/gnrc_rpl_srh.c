@@ -15,6 +15,7 @@
  * @author Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <errno.h>
 #include <string.h>
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/ipv6/ext/rh.h"
@@ -124,4 +125,26 @@ int gnrc_rpl_srh_process(ipv6_hdr_t *ipv6, gnrc_rpl_srh_t *rh, void **err_ptr)
     return GNRC_IPV6_EXT_RH_FORWARDED;
 }
 
+int gnrc_rpl_srh_final_dst(const ipv6_hdr_t *ipv6, const gnrc_rpl_srh_t *rh,
+                           ipv6_addr_t *dst)
+{
+    const uint8_t *addr_vec = (const uint8_t *)(rh + 1);
+    const uint8_t pref_elided = GNRC_RPL_SRH_COMPRE(rh->compr);
+    const unsigned addr_len = sizeof(ipv6_addr_t) - pref_elided;
+    const unsigned compri_addr_len = sizeof(ipv6_addr_t) -
+                                     GNRC_RPL_SRH_COMPRI(rh->compr);
+    const unsigned vec_len = (rh->len * 8) -
+                             GNRC_RPL_SRH_PADDING(rh->pad_resv);
+    unsigned num_addr;
+
+    if ((rh->len * 8) < (GNRC_RPL_SRH_PADDING(rh->pad_resv) + addr_len)) {
+        return -EINVAL;
+    }
+    num_addr = ((vec_len - addr_len) / compri_addr_len) + 1;
+    memcpy(dst, &ipv6->dst, pref_elided);
+    memcpy(&dst->u8[pref_elided], &addr_vec[(num_addr - 1) * compri_addr_len],
+           addr_len);
+    return 0;
+}
+
 /** @} */
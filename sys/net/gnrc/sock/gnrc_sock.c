@@ -27,30 +27,57 @@
 #include "sock_types.h"
 #include "gnrc_sock_internal.h"
 
-#ifdef MODULE_XTIMER
-#define _TIMEOUT_MAGIC      (0xF38A0B63U)
-#define _TIMEOUT_MSG_TYPE   (0x8474)
-
-static void _callback_put(void *arg)
+#ifdef MODULE_SOCK_ASYNC
+static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
 {
-    msg_t timeout_msg = { .sender_pid = KERNEL_PID_UNDEF,
-                          .type = _TIMEOUT_MSG_TYPE,
-                          .content = { .value = _TIMEOUT_MAGIC } };
-    gnrc_sock_reg_t *reg = arg;
+    gnrc_sock_reg_t *reg = ctx;
+    msg_t msg;
 
-    /* should be safe, because otherwise if mbox were filled this callback is
-     * senseless */
-    mbox_try_put(&reg->mbox, &timeout_msg);
+    if (cmd != GNRC_NETAPI_MSG_TYPE_RCV) {
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    msg.type = GNRC_NETAPI_MSG_TYPE_RCV;
+    msg.content.ptr = pkt;
+    if (mbox_try_put(&reg->mbox, &msg) < 1) {
+        /* mbox is full, drop packet like gnrc_netapi does for mbox entries */
+        gnrc_pktbuf_release(pkt);
+        gnrc_sock_async_notify(reg, SOCK_ASYNC_ERR);
+        return;
+    }
+    gnrc_sock_async_notify(reg, SOCK_ASYNC_MSG_RECV);
 }
 #endif
 
 void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_ctx)
 {
     mbox_init(&reg->mbox, reg->mbox_queue, SOCK_MBOX_SIZE);
+#ifdef MODULE_SOCK_ASYNC
+    reg->async_cb.generic = NULL;
+#ifdef MODULE_SOCK_ASYNC_EVENT
+    reg->async_ctx.queue = NULL;
+#endif
+    reg->netreg_cb.cb = _netapi_cb;
+    reg->netreg_cb.ctx = reg;
+    gnrc_netreg_entry_init_cb(&reg->entry, demux_ctx, &reg->netreg_cb);
+#else
     gnrc_netreg_entry_init_mbox(&reg->entry, demux_ctx, &reg->mbox);
+#endif
     gnrc_netreg_register(type, &reg->entry);
 }
 
+void gnrc_sock_close(gnrc_sock_reg_t *reg, gnrc_nettype_t type)
+{
+    gnrc_netreg_unregister(type, &reg->entry);
+#ifdef MODULE_SOCK_ASYNC_EVENT
+    if (reg->async_ctx.queue != NULL) {
+        /* the sock might be gone before the event is handled */
+        event_cancel(reg->async_ctx.queue, &reg->async_ctx.event.super);
+        reg->async_ctx.queue = NULL;
+    }
+#endif
+}
+
 ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
                        uint32_t timeout, sock_ip_ep_t *remote)
 {
@@ -60,37 +87,27 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     if (reg->mbox.cib.mask != (SOCK_MBOX_SIZE - 1)) {
         return -EINVAL;
     }
-#ifdef MODULE_XTIMER
-    xtimer_t timeout_timer;
-
-    if ((timeout != SOCK_NO_TIMEOUT) && (timeout != 0)) {
-        timeout_timer.callback = _callback_put;
-        timeout_timer.arg = reg;
-        xtimer_set(&timeout_timer, timeout);
-    }
-#endif
-    if (timeout != 0) {
-        mbox_get(&reg->mbox, &msg);
-    }
-    else {
+    if (timeout == 0) {
         if (!mbox_try_get(&reg->mbox, &msg)) {
             return -EAGAIN;
         }
     }
+    else if (timeout == SOCK_NO_TIMEOUT) {
+        mbox_get(&reg->mbox, &msg);
+    }
+    else {
 #ifdef MODULE_XTIMER
-    xtimer_remove(&timeout_timer);
+        if (xtimer_mbox_get_timeout(&reg->mbox, &msg, timeout) < 0) {
+            return -ETIMEDOUT;
+        }
+#else
+        mbox_get(&reg->mbox, &msg);
 #endif
+    }
     switch (msg.type) {
         case GNRC_NETAPI_MSG_TYPE_RCV:
             pkt = msg.content.ptr;
             break;
-#ifdef MODULE_XTIMER
-        case _TIMEOUT_MSG_TYPE:
-            if (msg.content.value == _TIMEOUT_MAGIC) {
-                return -ETIMEDOUT;
-            }
-#endif
-            /* Falls Through. */
         default:
             return -EINVAL;
     }
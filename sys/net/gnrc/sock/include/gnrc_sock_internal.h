@@ -122,6 +122,12 @@ static inline void gnrc_ep_set(sock_ip_ep_t *out, const sock_ip_ep_t *in,
  */
 void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_ctx);
 
+/**
+ * @brief   Close a sock internally
+ * @internal
+ */
+void gnrc_sock_close(gnrc_sock_reg_t *reg, gnrc_nettype_t type);
+
 /**
  * @brief   Receive a packet internally
  * @internal
@@ -135,6 +141,20 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt, uint32_t time
  */
 ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
                        const sock_ip_ep_t *remote, uint8_t nh);
+
+#if defined(MODULE_SOCK_ASYNC) || defined(DOXYGEN)
+/**
+ * @brief   Report asynchronous events to the callback of a sock
+ * @internal
+ */
+static inline void gnrc_sock_async_notify(gnrc_sock_reg_t *reg,
+                                          sock_async_flags_t flags)
+{
+    if (reg->async_cb.generic != NULL) {
+        reg->async_cb.generic(reg, flags, reg->async_cb_arg);
+    }
+}
+#endif
 /**
  * @}
  */
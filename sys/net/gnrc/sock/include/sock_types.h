@@ -31,6 +31,9 @@
 #include "net/gnrc/netreg.h"
 #include "net/sock/ip.h"
 #include "net/sock/udp.h"
+#ifdef MODULE_SOCK_ASYNC
+#include "net/sock/async/types.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -51,6 +54,20 @@ typedef struct gnrc_sock_reg {
     gnrc_netreg_entry_t entry;          /**< @ref net_gnrc_netreg entry for mbox */
     mbox_t mbox;                        /**< @ref core_mbox target for the sock */
     msg_t mbox_queue[SOCK_MBOX_SIZE];   /**< queue for gnrc_sock_reg_t::mbox */
+#if defined(MODULE_SOCK_ASYNC) || defined(DOXYGEN)
+    gnrc_netreg_entry_cbd_t netreg_cb;  /**< netreg callback putting into gnrc_sock_reg_t::mbox */
+    /**
+     * @brief   asynchronous event callback
+     *
+     * gnrc_sock_reg_t is the first member of all sock types, so the
+     * callback is called with the pointer to the registry entry.
+     */
+    sock_async_cb_t async_cb;
+    void *async_cb_arg;                 /**< argument for gnrc_sock_reg_t::async_cb */
+#endif
+#if defined(MODULE_SOCK_ASYNC_EVENT) || defined(DOXYGEN)
+    sock_async_ctx_t async_ctx;         /**< context for @ref net_sock_async_event */
+#endif
 } gnrc_sock_reg_t;
 
 /**
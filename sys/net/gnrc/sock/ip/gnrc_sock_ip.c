@@ -21,6 +21,7 @@
 #include "byteorder.h"
 #include "net/af.h"
 #include "net/protnum.h"
+#include "net/sock/async.h"
 #include "net/gnrc/ipv6.h"
 #include "net/sock/ip.h"
 #include "random.h"
@@ -63,7 +64,7 @@ int sock_ip_create(sock_ip_t *sock, const sock_ip_ep_t *local,
 void sock_ip_close(sock_ip_t *sock)
 {
     assert(sock != NULL);
-    gnrc_netreg_unregister(GNRC_NETTYPE_IPV6, &sock->reg.entry);
+    gnrc_sock_close(&sock->reg, GNRC_NETTYPE_IPV6);
 }
 
 int sock_ip_get_local(sock_ip_t *sock, sock_ip_ep_t *local)
@@ -195,7 +196,29 @@ ssize_t sock_ip_send(sock_ip_t *sock, const void *data, size_t len,
     if (res <= 0) {
         return res;
     }
+#ifdef MODULE_SOCK_ASYNC
+    if (sock != NULL) {
+        gnrc_sock_async_notify(&sock->reg, SOCK_ASYNC_MSG_SENT);
+    }
+#endif
     return res;
 }
 
+#ifdef MODULE_SOCK_ASYNC
+void sock_ip_set_cb(sock_ip_t *sock, sock_ip_cb_t cb, void *cb_arg)
+{
+    assert(sock != NULL);
+    sock->reg.async_cb_arg = cb_arg;
+    sock->reg.async_cb.ip = cb;
+}
+
+#ifdef MODULE_SOCK_ASYNC_EVENT
+sock_async_ctx_t *sock_ip_get_async_ctx(sock_ip_t *sock)
+{
+    assert(sock != NULL);
+    return &sock->reg.async_ctx;
+}
+#endif
+#endif
+
 /** @} */
@@ -30,6 +30,7 @@
 #include "internal/option.h"
 #include "internal/eventloop.h"
 #include "internal/rcvbuf.h"
+#include "internal/event.h"
 
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
@@ -98,6 +99,23 @@ static void _setup_timeout(xtimer_t *timer, const uint32_t duration, const xtime
     xtimer_set(timer, duration);
 }
 
+/**
+ * @brief Error to report on a closed connection, reports a pending abort only once.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     err   Error to report, if the connection was not aborted.
+ *
+ * @returns   -ECONNABORTED if retransmissions timed out, @p err otherwise.
+ */
+static int _closed_error(gnrc_tcp_tcb_t *tcb, const int err)
+{
+    if (tcb->status & STATUS_ABORTED) {
+        tcb->status &= ~STATUS_ABORTED;
+        return -ECONNABORTED;
+    }
+    return err;
+}
+
 /**
  * @brief   Establishes a new TCP connection
  *
@@ -132,6 +150,9 @@ static int _gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, char *target_addr, uint16_t targe
         return -EISCONN;
     }
 
+    /* Forget an abort of the previous connection */
+    tcb->status &= ~STATUS_ABORTED;
+
     /* Mark TCB as waiting for incomming messages */
     tcb->status |= STATUS_WAIT_FOR_MSG;
 
@@ -183,8 +204,18 @@ static int _gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, char *target_addr, uint16_t targe
         /* Assign port numbers, verfication happens in fsm */
         tcb->local_port = local_port;
         tcb->peer_port = target_port;
+    }
+
+    /* Non-blocking mode: The outcome is reported by events */
+    if (_event_nonblocking(tcb)) {
+        tcb->status &= ~STATUS_WAIT_FOR_MSG;
+        ret = _fsm(tcb, FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
+        mutex_unlock(&(tcb->function_lock));
+        return (ret < 0) ? ret : -EINPROGRESS;
+    }
 
-        /* Setup connection timeout: Put timeout message in TCBs mbox on expiration */
+    /* Setup connection timeout: Put timeout message in TCBs mbox on expiration */
+    if (!passive) {
         _setup_timeout(&connection_timeout, GNRC_TCP_CONNECTION_TIMEOUT_DURATION,
                        _cb_mbox_put_msg, &connection_timeout_arg);
     }
@@ -355,8 +386,16 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
 
     /* Check if connection is in a valid state */
     if (tcb->state != FSM_STATE_ESTABLISHED && tcb->state != FSM_STATE_CLOSE_WAIT) {
+        ret = _closed_error(tcb, -ENOTCONN);
         mutex_unlock(&(tcb->function_lock));
-        return -ENOTCONN;
+        return ret;
+    }
+
+    /* Non-blocking mode: Send what the window allows, errors and empty sends pass through */
+    if (_event_nonblocking(tcb)) {
+        ret = _fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+        mutex_unlock(&(tcb->function_lock));
+        return (ret == 0 && len > 0) ? -EAGAIN : ret;
     }
 
     /* Mark TCB as waiting for incomming messages */
@@ -375,11 +414,11 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         _setup_timeout(&user_timeout, timeout_duration_us, _cb_mbox_put_msg, &user_timeout_arg);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
-        /* Check if the connections state is closed. If so, a reset was received */
+    /* Loop until something was handed to the stack */
+    while (ret == 0) {
+        /* Check if the connections state is closed by a reset or a retransmission timeout */
         if (tcb->state == FSM_STATE_CLOSED) {
-            ret = -ECONNRESET;
+            ret = _closed_error(tcb, -ECONNRESET);
             break;
         }
 
@@ -395,9 +434,12 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                            &probe_timeout_arg);
         }
 
-        /* Try to send data in case there nothing has been sent and we are not probing */
-        if (ret == 0 && !probing_mode) {
+        /* Try to send data in case we are not probing */
+        if (!probing_mode) {
             ret = _fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+            if (ret > 0) {
+                break;
+            }
         }
 
         /* Wait for responses */
@@ -411,7 +453,6 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
 
             case MSG_TYPE_USER_SPEC_TIMEOUT:
                 DEBUG("gnrc_tcp.c : gnrc_tcp_send() : USER_SPEC_TIMEOUT\n");
-                _fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
                 ret = -ETIMEDOUT;
                 break;
 
@@ -477,12 +518,14 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
     /* Check if connection is in a valid state */
     if (tcb->state != FSM_STATE_ESTABLISHED && tcb->state != FSM_STATE_FIN_WAIT_1 &&
         tcb->state != FSM_STATE_FIN_WAIT_2 && tcb->state != FSM_STATE_CLOSE_WAIT) {
+        ret = _closed_error(tcb, -ENOTCONN);
         mutex_unlock(&(tcb->function_lock));
-        return -ENOTCONN;
+        return ret;
     }
 
-    /* If this call is non-blocking (timeout_duration_us == 0): Try to read data and return */
-    if (timeout_duration_us == 0) {
+    /* If this call is non-blocking (timeout_duration_us == 0 or non-blocking mode):
+     * Try to read data and return */
+    if (timeout_duration_us == 0 || _event_nonblocking(tcb)) {
         ret = _fsm(tcb, FSM_EVENT_CALL_RECV, NULL, data, max_len);
         if (ret == 0) {
             ret = -EAGAIN;
@@ -507,9 +550,9 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
 
     /* Processing loop */
     while (ret == 0) {
-        /* Check if the connections state is closed. If so, a reset was received */
+        /* Check if the connections state is closed by a reset or a retransmission timeout */
         if (tcb->state == FSM_STATE_CLOSED) {
-            ret = -ECONNRESET;
+            ret = _closed_error(tcb, -ECONNRESET);
             break;
         }
 
@@ -528,7 +571,6 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
 
                 case MSG_TYPE_USER_SPEC_TIMEOUT:
                     DEBUG("gnrc_tcp.c : gnrc_tcp_send() : USER_SPEC_TIMEOUT\n");
-                    _fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
                     ret = -ETIMEDOUT;
                     break;
 
@@ -567,6 +609,13 @@ void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb)
         return;
     }
 
+    /* Non-blocking mode: Start connection teardown sequence, completion is reported by events */
+    if (_event_nonblocking(tcb)) {
+        _fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
+        mutex_unlock(&(tcb->function_lock));
+        return;
+    }
+
     /* Mark TCB as waiting for incomming messages */
     tcb->status |= STATUS_WAIT_FOR_MSG;
 
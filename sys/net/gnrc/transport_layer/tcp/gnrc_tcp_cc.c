@@ -0,0 +1,294 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/cc.h
+ * @}
+ */
+#include <inttypes.h>
+#include "xtimer.h"
+#include "internal/common.h"
+#include "internal/pkt.h"
+#include "internal/cc.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+/**
+ * @brief Upper bound of the congestion window, there is no window scaling.
+ */
+#define CWND_MAX            (0xFFFFU)
+
+/**
+ * @brief Number of duplicate ACKs that trigger a fast retransmit.
+ *
+ * Fewer segments in flight can not produce this many duplicate ACKs, the
+ * threshold is lowered for them (RFC 5827, section 3.1).
+ */
+#define DUP_ACK_THRESHOLD   (3U)
+
+#ifdef MODULE_GNRC_TCP_CUBIC
+/**
+ * @brief CUBIC constants (RFC 8312, section 5): C = 0.4, beta = 0.7
+ * @{
+ */
+#define CUBIC_C             (4)
+#define CUBIC_C_DIV         (10)
+#define CUBIC_BETA          (7)
+#define CUBIC_BETA_DIV      (10)
+/** @} */
+
+/**
+ * @brief Maximum distance to K in milliseconds, so (t - K)^3 does not overflow.
+ */
+#define CUBIC_T_MAX         (1L << 20)
+#endif
+
+static inline uint32_t _min(const uint32_t x, const uint32_t y)
+{
+    return (x < y) ? x : y;
+}
+
+static inline uint32_t _max(const uint32_t x, const uint32_t y)
+{
+    return (x > y) ? x : y;
+}
+
+/**
+ * @brief Number of duplicate ACKs that trigger a fast retransmit right now.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Duplicate ACK threshold, zero if fast retransmit is not possible.
+ */
+static uint8_t _dup_ack_threshold(const gnrc_tcp_tcb_t *tcb)
+{
+    /* Each segment in flight after the lost one causes one duplicate ACK */
+    if (tcb->rtx_len > DUP_ACK_THRESHOLD) {
+        return DUP_ACK_THRESHOLD;
+    }
+    return (tcb->rtx_len > 1) ? (tcb->rtx_len - 1) : 0;
+}
+
+#ifdef MODULE_GNRC_TCP_CUBIC
+/**
+ * @brief Calculates the integer cube root of @p x.
+ */
+static uint32_t _cbrt(uint64_t x)
+{
+    uint64_t y = 0;
+
+    for (int s = 63; s >= 0; s -= 3) {
+        y += y;
+        uint64_t b = 3 * y * (y + 1) + 1;
+        if ((x >> s) >= b) {
+            x -= b << s;
+            y++;
+        }
+    }
+    return (uint32_t)y;
+}
+#endif
+
+/**
+ * @brief Sets the slow start threshold after a loss was detected.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _reduce(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t smss = _cc_smss(tcb);
+
+#ifdef MODULE_GNRC_TCP_CUBIC
+    /* Fast convergence: Release bandwidth for new flows (RFC 8312, section 4.6) */
+    if (tcb->cwnd < tcb->w_max) {
+        tcb->w_max = (tcb->cwnd * (CUBIC_BETA_DIV + CUBIC_BETA)) / (2 * CUBIC_BETA_DIV);
+    }
+    else {
+        tcb->w_max = tcb->cwnd;
+    }
+    tcb->epoch_start = 0;
+    tcb->ssthresh = _max((tcb->cwnd * CUBIC_BETA) / CUBIC_BETA_DIV, 2 * smss);
+#else
+    /* Half of the data in flight (RFC 5681, section 3.1) */
+    tcb->ssthresh = _max((tcb->snd_nxt - tcb->snd_una) / 2, 2 * smss);
+#endif
+    DEBUG("gnrc_tcp_cc.c : _reduce() : cwnd=%"PRIu32", ssthresh=%"PRIu32"\n",
+          tcb->cwnd, tcb->ssthresh);
+}
+
+/**
+ * @brief Increases the congestion window after an ACK in congestion avoidance.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[in]     smss   Sender maximum segment size.
+ */
+static void _avoid(gnrc_tcp_tcb_t *tcb, const uint32_t smss)
+{
+#ifdef MODULE_GNRC_TCP_CUBIC
+    uint32_t now = xtimer_now_usec() / US_PER_MS;
+    int64_t rtt = (tcb->srtt > 0) ? (tcb->srtt / (int32_t)US_PER_MS) : 0;
+    int64_t t, d, target, w_est;
+
+    /* Start a new epoch with the first ACK after a reduction */
+    if (tcb->epoch_start == 0) {
+        tcb->epoch_start = (now != 0) ? now : 1;
+        if (tcb->cwnd < tcb->w_max) {
+            /* K = cbrt((W_max - cwnd) / C) with windows in segments and K in seconds */
+            tcb->k = _cbrt(((uint64_t)(tcb->w_max - tcb->cwnd) * CUBIC_C_DIV * US_PER_SEC *
+                            MS_PER_SEC) / (CUBIC_C * smss));
+        }
+        else {
+            tcb->k = 0;
+            tcb->w_max = tcb->cwnd;
+        }
+    }
+
+    /* Window one RTT ahead: W_cubic(t + RTT) = C * (t + RTT - K)^3 + W_max */
+    t = (int64_t)(now - tcb->epoch_start);
+    d = t + rtt - tcb->k;
+    if (d > CUBIC_T_MAX) {
+        d = CUBIC_T_MAX;
+    }
+    else if (d < -CUBIC_T_MAX) {
+        d = -CUBIC_T_MAX;
+    }
+    target = (int64_t)tcb->w_max +
+             (((d * d * d) / US_PER_SEC) * CUBIC_C * smss) /
+             (CUBIC_C_DIV * MS_PER_SEC);
+
+    /* Grow at least as fast as standard TCP would (RFC 8312, section 4.2) */
+    w_est = ((int64_t)tcb->w_max * CUBIC_BETA) / CUBIC_BETA_DIV;
+    if (rtt > 0) {
+        w_est += (3 * (CUBIC_BETA_DIV - CUBIC_BETA) * t * smss) /
+                 ((CUBIC_BETA_DIV + CUBIC_BETA) * rtt);
+    }
+    if (target < w_est) {
+        target = w_est;
+    }
+
+    /* Grow by at most half of the window per RTT */
+    if (target > ((int64_t)tcb->cwnd * 3) / 2) {
+        target = ((int64_t)tcb->cwnd * 3) / 2;
+    }
+    if (target > (int64_t)tcb->cwnd) {
+        tcb->cwnd += _max(1, ((target - tcb->cwnd) * smss) / tcb->cwnd);
+    }
+    else {
+        tcb->cwnd += _max(1, (smss * smss) / (100 * tcb->cwnd));
+    }
+#else
+    /* Increase by one segment per RTT (RFC 5681, section 3.1) */
+    tcb->cwnd += _max(1, (smss * smss) / tcb->cwnd);
+#endif
+}
+
+void _cc_init(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t smss = _cc_smss(tcb);
+
+    /* Initial window (RFC 5681, section 3.1) */
+    if (smss > 2190) {
+        tcb->cwnd = 2 * smss;
+    }
+    else if (smss > 1095) {
+        tcb->cwnd = 3 * smss;
+    }
+    else {
+        tcb->cwnd = 4 * smss;
+    }
+    tcb->ssthresh = CWND_MAX;
+    tcb->recover = tcb->iss;
+    tcb->dup_acks = 0;
+    tcb->status &= ~STATUS_FAST_RECOVERY;
+#ifdef MODULE_GNRC_TCP_CUBIC
+    tcb->w_max = 0;
+    tcb->epoch_start = 0;
+    tcb->k = 0;
+#endif
+}
+
+void _cc_ack(gnrc_tcp_tcb_t *tcb, const uint32_t acked)
+{
+    uint32_t smss = _cc_smss(tcb);
+
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        /* Full acknowledgment: Leave fast recovery (RFC 6582, section 3.2, step 3) */
+        if (LEQ_32_BIT(tcb->recover, tcb->snd_una)) {
+            tcb->cwnd = _min(tcb->ssthresh, _max(tcb->snd_nxt - tcb->snd_una, smss) + smss);
+            tcb->status &= ~STATUS_FAST_RECOVERY;
+            tcb->dup_acks = 0;
+        }
+        /* Partial acknowledgment: The next segment was lost as well */
+        else {
+            _pkt_retransmit(tcb, false);
+            tcb->cwnd = (tcb->cwnd > acked) ? (tcb->cwnd - acked) : 0;
+            if (acked >= smss || tcb->cwnd < smss) {
+                tcb->cwnd += smss;
+            }
+        }
+        return;
+    }
+    tcb->dup_acks = 0;
+
+    /* Slow start: Increase by up to one segment per ACK */
+    if (tcb->cwnd < tcb->ssthresh) {
+        tcb->cwnd += _min(acked, smss);
+    }
+    else {
+        _avoid(tcb, smss);
+    }
+    if (tcb->cwnd > CWND_MAX) {
+        tcb->cwnd = CWND_MAX;
+    }
+}
+
+void _cc_dup_ack(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t smss = _cc_smss(tcb);
+    uint8_t threshold = _dup_ack_threshold(tcb);
+
+    /* Inflate window for each segment that left the network */
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        tcb->cwnd = _min(tcb->cwnd + smss, CWND_MAX);
+        return;
+    }
+    if (tcb->dup_acks < UINT8_MAX) {
+        tcb->dup_acks++;
+    }
+    if (threshold == 0 || tcb->dup_acks < threshold) {
+        return;
+    }
+    /* Enter fast retransmit only once per window (RFC 6582, section 4.1) */
+    if (!LEQ_32_BIT(tcb->recover, tcb->snd_una)) {
+        return;
+    }
+    DEBUG("gnrc_tcp_cc.c : _cc_dup_ack() : Fast retransmit\n");
+    _reduce(tcb);
+    tcb->recover = tcb->snd_nxt;
+    tcb->status |= STATUS_FAST_RECOVERY;
+    _pkt_retransmit(tcb, false);
+    tcb->cwnd = tcb->ssthresh + (threshold * smss);
+}
+
+void _cc_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    /* Reduce only once for repeated timeouts of the same segment (RFC 5681, section 3.1) */
+    if (tcb->retries == 0) {
+        _reduce(tcb);
+    }
+    /* Restart with the loss window */
+    tcb->cwnd = _cc_smss(tcb);
+    tcb->recover = tcb->snd_nxt;
+    tcb->dup_acks = 0;
+    tcb->status &= ~STATUS_FAST_RECOVERY;
+}
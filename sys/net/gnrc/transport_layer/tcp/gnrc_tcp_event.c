@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/event.h
+ * @}
+ */
+
+#ifdef MODULE_GNRC_TCP_EVENT
+
+#include "kernel_defines.h"
+#include "net/gnrc/tcp.h"
+#include "internal/common.h"
+#include "internal/event.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+/**
+ * @brief Flags for tcb->event_state
+ * @{
+ */
+#define EVENT_STATE_CONNECTED (1 << 0)  /**< GNRC_TCP_EVENT_CONNECTED was reported */
+#define EVENT_STATE_TIMER     (1 << 1)  /**< tcb->tim_event is running */
+/** @} */
+
+/**
+ * @brief Executes the callback of a TCB in the thread handling its event queue.
+ *
+ * @param[in] ev   Event embedded in the TCB.
+ */
+static void _event_handler(event_t *ev)
+{
+    gnrc_tcp_tcb_t *tcb = container_of(ev, gnrc_tcp_tcb_t, event);
+    unsigned events = 0;
+
+    /* Collect the current state of the connection */
+    mutex_lock(&(tcb->fsm_lock));
+    switch (tcb->state) {
+        case FSM_STATE_CLOSED:
+        case FSM_STATE_LISTEN:
+        case FSM_STATE_SYN_SENT:
+        case FSM_STATE_SYN_RCVD:
+            break;
+
+        default:
+            if (!(tcb->event_state & EVENT_STATE_CONNECTED)) {
+                tcb->event_state |= EVENT_STATE_CONNECTED;
+                events |= GNRC_TCP_EVENT_CONNECTED;
+            }
+            break;
+    }
+    if (tcb->rcv_buf_raw != NULL && !ringbuffer_empty(&(tcb->rcv_buf))) {
+        events |= GNRC_TCP_EVENT_READABLE;
+    }
+    if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_CLOSE_WAIT) {
+        uint32_t wnd = (tcb->snd_wnd < tcb->cwnd) ? tcb->snd_wnd : tcb->cwnd;
+
+        if (tcb->rtx_len < (GNRC_TCP_RTX_QUEUE_SIZE - 1) && (tcb->snd_nxt - tcb->snd_una) < wnd) {
+            events |= GNRC_TCP_EVENT_WRITABLE;
+        }
+    }
+    if (tcb->state == FSM_STATE_CLOSED || tcb->state == FSM_STATE_CLOSE_WAIT ||
+        tcb->state == FSM_STATE_LAST_ACK || tcb->state == FSM_STATE_CLOSING ||
+        tcb->state == FSM_STATE_TIME_WAIT) {
+        events |= GNRC_TCP_EVENT_CLOSED;
+    }
+    gnrc_tcp_event_cb_t cb = tcb->event_cb;
+    void *arg = tcb->event_arg;
+    mutex_unlock(&(tcb->fsm_lock));
+
+    /* Call without locks held, so the callback can use the TCB */
+    DEBUG("gnrc_tcp_event.c : _event_handler() : events=0x%x\n", events);
+    if (events && cb) {
+        cb(tcb, events, arg);
+    }
+}
+
+bool _event_timeout_current(const gnrc_tcp_tcb_t *tcb, fsm_event_t event)
+{
+    uint16_t type;
+
+    if (tcb->evq == NULL) {
+        return true;
+    }
+    switch (event) {
+        case FSM_EVENT_TIMEOUT_CONNECTION:
+            type = MSG_TYPE_CONNECTION_TIMEOUT;
+            break;
+
+        case FSM_EVENT_SEND_PROBE:
+            type = MSG_TYPE_PROBE_TIMEOUT;
+            break;
+
+        default:
+            return true;
+    }
+    /* A restarted timer expires after its new deadline */
+    return (tcb->event_state & EVENT_STATE_TIMER) && (tcb->msg_event.type == type) &&
+           ((int32_t)(xtimer_now_usec() - tcb->event_deadline) >= 0);
+}
+
+void _event_update(gnrc_tcp_tcb_t *tcb, fsm_event_t event)
+{
+    uint32_t duration = 0;
+    uint16_t type = MSG_TYPE_CONNECTION_TIMEOUT;
+
+    if (tcb->evq == NULL) {
+        return;
+    }
+
+    /* These events are only triggered by tcb->tim_event in non-blocking mode */
+    if (event == FSM_EVENT_TIMEOUT_CONNECTION || event == FSM_EVENT_SEND_PROBE) {
+        tcb->event_state &= ~EVENT_STATE_TIMER;
+    }
+
+    /* Time out while waiting for the peer, probe closed windows */
+    switch (tcb->state) {
+        case FSM_STATE_CLOSED:
+        case FSM_STATE_LISTEN:
+        case FSM_STATE_SYN_SENT:
+            /* Report the next connection again */
+            tcb->event_state &= ~EVENT_STATE_CONNECTED;
+            if (tcb->state == FSM_STATE_SYN_SENT) {
+                duration = GNRC_TCP_CONNECTION_TIMEOUT_DURATION;
+            }
+            break;
+
+        case FSM_STATE_TIME_WAIT:
+            break;
+
+        case FSM_STATE_ESTABLISHED:
+        case FSM_STATE_CLOSE_WAIT:
+            if (tcb->rtx_len > 0) {
+                duration = GNRC_TCP_CONNECTION_TIMEOUT_DURATION;
+            }
+            else if (tcb->snd_wnd == 0) {
+                type = MSG_TYPE_PROBE_TIMEOUT;
+                duration = (tcb->rto > 0) ? (uint32_t)tcb->rto : GNRC_TCP_PROBE_LOWER_BOUND;
+                if (duration < GNRC_TCP_PROBE_LOWER_BOUND) {
+                    duration = GNRC_TCP_PROBE_LOWER_BOUND;
+                }
+                else if (duration > GNRC_TCP_PROBE_UPPER_BOUND) {
+                    duration = GNRC_TCP_PROBE_UPPER_BOUND;
+                }
+            }
+            break;
+
+        default:
+            duration = GNRC_TCP_CONNECTION_TIMEOUT_DURATION;
+            break;
+    }
+
+    /* Restart the timer on progress, or if it is not running for the right purpose */
+    if (duration == 0) {
+        xtimer_remove(&(tcb->tim_event));
+        tcb->event_state &= ~EVENT_STATE_TIMER;
+    }
+    else if ((tcb->status & STATUS_NOTIFY_USER) || !(tcb->event_state & EVENT_STATE_TIMER) ||
+             (tcb->msg_event.type != type)) {
+        xtimer_remove(&(tcb->tim_event));
+        tcb->msg_event.type = type;
+        tcb->msg_event.content.ptr = (void *)tcb;
+        tcb->event_deadline = xtimer_now_usec() + duration;
+        xtimer_set_msg(&(tcb->tim_event), duration, &(tcb->msg_event), gnrc_tcp_pid);
+        tcb->event_state |= EVENT_STATE_TIMER;
+    }
+
+    if (tcb->status & STATUS_NOTIFY_USER) {
+        event_post(tcb->evq, &(tcb->event));
+    }
+}
+
+void gnrc_tcp_event_init(gnrc_tcp_tcb_t *tcb, event_queue_t *queue, gnrc_tcp_event_cb_t cb,
+                         void *arg)
+{
+    assert(tcb != NULL);
+
+    mutex_lock(&(tcb->fsm_lock));
+    if (tcb->evq != NULL) {
+        event_cancel(tcb->evq, &(tcb->event));
+        xtimer_remove(&(tcb->tim_event));
+    }
+    tcb->evq = queue;
+    tcb->event.handler = _event_handler;
+    tcb->event_cb = cb;
+    tcb->event_arg = arg;
+    tcb->event_state = 0;
+    mutex_unlock(&(tcb->fsm_lock));
+}
+
+#else
+typedef int dont_be_pedantic;
+#endif /* MODULE_GNRC_TCP_EVENT */
@@ -274,6 +274,20 @@ void *_event_loop(__attribute__((unused)) void *arg)
                      NULL, NULL, 0);
                 break;
 
+#ifdef MODULE_GNRC_TCP_EVENT
+            /* Timeouts of TCBs in non-blocking mode */
+            case MSG_TYPE_CONNECTION_TIMEOUT:
+                DEBUG("gnrc_tcp_eventloop.c : _event_loop() : MSG_TYPE_CONNECTION_TIMEOUT\n");
+                _fsm((gnrc_tcp_tcb_t *)msg.content.ptr, FSM_EVENT_TIMEOUT_CONNECTION,
+                     NULL, NULL, 0);
+                break;
+
+            case MSG_TYPE_PROBE_TIMEOUT:
+                DEBUG("gnrc_tcp_eventloop.c : _event_loop() : MSG_TYPE_PROBE_TIMEOUT\n");
+                _fsm((gnrc_tcp_tcb_t *)msg.content.ptr, FSM_EVENT_SEND_PROBE, NULL, NULL, 0);
+                break;
+#endif
+
             /* Timewait timer expired: Call FSM with timewait event */
             case MSG_TYPE_TIMEWAIT:
                 DEBUG("gnrc_tcp_eventloop.c : _event_loop() : MSG_TYPE_TIMEWAIT\n");
@@ -26,6 +26,8 @@
 #include "internal/pkt.h"
 #include "internal/option.h"
 #include "internal/rcvbuf.h"
+#include "internal/cc.h"
+#include "internal/event.h"
 #include "internal/fsm.h"
 
 #ifdef MODULE_GNRC_IPV6
@@ -83,10 +85,14 @@ static uint16_t _get_random_local_port(void)
  */
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
-    if (tcb->pkt_retransmit != NULL) {
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
+    if (tcb->rtx_len > 0) {
+        for (unsigned i = 0; i < tcb->rtx_len; ++i) {
+            gnrc_pktbuf_release(tcb->rtx_queue[i]);
+            tcb->rtx_queue[i] = NULL;
+        }
         xtimer_remove(&(tcb->tim_tout));
-        tcb->pkt_retransmit = NULL;
+        tcb->rtx_len = 0;
+        tcb->rtx_sacked = 0;
     }
     return 0;
 }
@@ -148,6 +154,11 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
 #endif
             tcb->peer_port = PORT_UNSPEC;
 
+            /* Forget state of a previous connection attempt */
+            _clear_retransmit(tcb);
+            tcb->status &= ~(STATUS_SACK_OK | STATUS_RTT_MEASURE | STATUS_FAST_RECOVERY);
+            tcb->sack_len = 0;
+
             /* Allocate receive buffer */
             if (_rcvbuf_get_buffer(tcb) == -ENOMEM) {
                 return -ENOMEM;
@@ -163,6 +174,10 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
             break;
 
         case FSM_STATE_SYN_SENT:
+            /* Forget state of a previous connection */
+            tcb->status &= ~(STATUS_SACK_OK | STATUS_RTT_MEASURE | STATUS_FAST_RECOVERY);
+            tcb->sack_len = 0;
+
             /* Allocate rceveive buffer */
             if (_rcvbuf_get_buffer(tcb) == -ENOMEM) {
                 return -ENOMEM;
@@ -191,14 +206,20 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
             mutex_unlock(&_list_tcb_lock);
             break;
 
-        case FSM_STATE_SYN_RCVD:
         case FSM_STATE_ESTABLISHED:
+            /* Connection is synchronized: Start with the initial congestion window */
+            _cc_init(tcb);
+            tcb->status |= STATUS_NOTIFY_USER;
+            break;
+
+        case FSM_STATE_SYN_RCVD:
         case FSM_STATE_CLOSE_WAIT:
             tcb->status |= STATUS_NOTIFY_USER;
             break;
 
         case FSM_STATE_TIME_WAIT:
             _restart_timewait_timer(tcb);
+            tcb->status |= STATUS_NOTIFY_USER;
             break;
 
         default:
@@ -261,30 +282,44 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
  * @param[in,out] buf   Buffer containing data to send.
  * @param[in]     len   Maximum Number of Bytes to send from @p buf.
  *
- * @returns   Number of successfully transmitted bytes.
+ * @returns   Number of bytes handed to the network layer.
  */
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_call_send()\n");
 
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+    uint32_t smss = _cc_smss(tcb);
+    uint32_t wnd = (tcb->snd_wnd < tcb->cwnd) ? tcb->snd_wnd : tcb->cwnd;
+
+    /* Send segments as long as the window allows, keep one queue entry for the FIN */
+    while (sent < len && tcb->rtx_len < (GNRC_TCP_RTX_QUEUE_SIZE - 1)) {
+        uint32_t flight = tcb->snd_nxt - tcb->snd_una;
+        if (flight >= wnd) {
+            break;
+        }
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
         /* Calculate segment size */
-        payload = (payload < GNRC_TCP_MSS) ? payload : GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        size_t payload = wnd - flight;
+        payload = (payload < smss) ? payload : smss;
+        payload = (payload < (len - sent)) ? payload : (len - sent);
+
+        /* Don't send small segments while data is in flight (RFC 1122, section 4.2.3.4) */
+        if (flight > 0 && payload < smss && payload < (len - sent)) {
+            break;
+        }
 
-        /* Calculate payload size for this segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        if (_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt, tcb->rcv_nxt,
+                       (uint8_t *)buf + sent, payload) < 0) {
+            break;
+        }
         _pkt_setup_retransmit(tcb, out_pkt, false);
         _pkt_send(tcb, out_pkt, seq_con, false);
-        return payload;
+        sent += payload;
     }
-    return 0;
+    return sent;
 }
 
 /**
@@ -304,11 +339,19 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
         return 0;
     }
 
-    /* Read data into 'buf' up to 'len' bytes from receive buffer */
+    /* Read data into 'buf' up to 'len' bytes from receive buffer. Out-of-order data is stored
+     * behind the readable data, so keep the write position if the buffer runs empty. */
+    unsigned end = (tcb->rcv_buf.start + tcb->rcv_buf.avail) % tcb->rcv_buf.size;
     size_t rcvd = ringbuffer_get(&(tcb->rcv_buf), buf, len);
+    if (ringbuffer_empty(&tcb->rcv_buf)) {
+        tcb->rcv_buf.start = end;
+    }
 
-    /* If receive buffer can store more than GNRC_TCP_MSS: open window to available buffer size */
-    if (ringbuffer_get_free(&tcb->rcv_buf) >= GNRC_TCP_MSS) {
+    /* Announce a window update if the window grew by at least one segment or half
+     * of the receive buffer (RFC 1122, section 4.2.3.3) */
+    size_t wnd_update = (GNRC_TCP_MSS < (GNRC_TCP_RCV_BUF_SIZE / 2)) ? GNRC_TCP_MSS
+                                                                     : (GNRC_TCP_RCV_BUF_SIZE / 2);
+    if (ringbuffer_get_free(&tcb->rcv_buf) >= tcb->rcv_wnd + wnd_update) {
         tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
 
         /* Send ACK to anounce window update */
@@ -632,8 +675,18 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                    uint32_t acked = seg_ack - tcb->snd_una;
                     tcb->snd_una = seg_ack;
                     _pkt_acknowledge(tcb, seg_ack);
+                    _cc_ack(tcb, acked);
+
+                    /* Signal user that more data can be sent */
+                    tcb->status |= STATUS_NOTIFY_USER;
+                }
+                /* Duplicate ACK: Segments after a lost one arrived (RFC 5681, section 2) */
+                else if (seg_ack == tcb->snd_una && pay_len == 0 && seg_wnd == tcb->snd_wnd &&
+                         tcb->rtx_len > 0 && !(ctl & (MSK_SYN | MSK_FIN))) {
+                    _cc_dup_ack(tcb);
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -657,25 +710,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionaly if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         return 0;
                     }
@@ -693,13 +746,8 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Search for begin of payload */
                 LL_SEARCH_SCALAR(in_pkt, snp, type, GNRC_NETTYPE_UNDEF);
 
-                /* Accept only data that is expected, to be received */
-                if (tcb->rcv_nxt == seg_seq) {
-                    /* Copy contents into receive buffer */
-                    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
-                        snp = snp->next;
-                    }
+                /* Store payload, data ahead of rcv_nxt is kept until the gap is filled */
+                if (_rcvbuf_store(tcb, seg_seq, snp) > 0) {
                     /* Shrink receive window */
                     tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
                     /* Notify owner because new data is available */
@@ -707,15 +755,15 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 }
                 /* Send ACK, if FIN processing sends ACK already */
                 /* NOTE: this is the place to add payload piggybagging in the future */
-                if (!(ctl & MSK_FIN)) {
+                if (!(ctl & MSK_FIN) || LSS_32_BIT(tcb->rcv_nxt, seg_seq + pay_len)) {
                     _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt, tcb->rcv_nxt,
                                NULL, 0);
                     _pkt_send(tcb, out_pkt, seq_con, false);
                 }
             }
         }
-        /* 7) Check FIN */
-        if (ctl & MSK_FIN) {
+        /* 7) Check FIN, ignore it until all data before it was received */
+        if ((ctl & MSK_FIN) && LEQ_32_BIT(seg_seq + pay_len, tcb->rcv_nxt)) {
             if (tcb->state == FSM_STATE_CLOSED || tcb->state == FSM_STATE_LISTEN ||
                 tcb->state == FSM_STATE_SYN_SENT) {
                 return 0;
@@ -729,7 +777,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->rtx_len == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -762,36 +810,56 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 }
 
 /**
- * @brief FSM handling function for retransmissions.
+ * @brief FSM handling function for connection timeout handling.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  *
  * @returns   Zero on success.
  */
-static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
+static int _fsm_timeout_connection(gnrc_tcp_tcb_t *tcb)
 {
-    DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit()\n");
-    if (tcb->pkt_retransmit != NULL) {
-        _pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _pkt_send(tcb, tcb->pkt_retransmit, 0, true);
-    }
-    else {
-        DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit() : Retransmit queue is empty\n");
+    DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_connection()\n");
+    /* Passive connections wait for the next connection attempt */
+    if (tcb->state == FSM_STATE_SYN_RCVD && (tcb->status & STATUS_PASSIVE)) {
+        if (_transition_to(tcb, FSM_STATE_LISTEN) == 0) {
+            return 0;
+        }
     }
+    _transition_to(tcb, FSM_STATE_CLOSED);
     return 0;
 }
 
 /**
- * @brief FSM handling function for connection timeout handling.
+ * @brief FSM handling function for retransmissions.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  *
  * @returns   Zero on success.
  */
-static int _fsm_timeout_connection(gnrc_tcp_tcb_t *tcb)
+static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
-    DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_connection()\n");
-    _transition_to(tcb, FSM_STATE_CLOSED);
+    DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit()\n");
+    if (tcb->rtx_len > 0) {
+        uint32_t now = xtimer_now_usec();
+
+        /* Give up if the oldest segment was not acknowledged for too long */
+        if (tcb->retries == 0) {
+            tcb->rtx_start = now;
+        }
+        else if ((now - tcb->rtx_start) >= GNRC_TCP_CONNECTION_TIMEOUT_DURATION) {
+            DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit() : Giving up\n");
+            _fsm_timeout_connection(tcb);
+            if (tcb->state == FSM_STATE_CLOSED) {
+                tcb->status |= STATUS_ABORTED;
+            }
+            return 0;
+        }
+        _cc_timeout(tcb);
+        _pkt_retransmit(tcb, true);
+    }
+    else {
+        DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit() : Retransmit queue is empty\n");
+    }
     return 0;
 }
 
@@ -892,6 +960,14 @@ int _fsm(gnrc_tcp_tcb_t *tcb, fsm_event_t event, gnrc_pktsnip_t *in_pkt, void *b
     /* Lock FSM */
     mutex_lock(&(tcb->fsm_lock));
 
+#ifdef MODULE_GNRC_TCP_EVENT
+    /* Drop timeouts of a timer that was stopped or restarted after it expired */
+    if (!_event_timeout_current(tcb, event)) {
+        mutex_unlock(&(tcb->fsm_lock));
+        return 0;
+    }
+#endif
+
     /* Call FSM */
     tcb->status &= ~STATUS_NOTIFY_USER;
     int32_t result = _fsm_unprotected(tcb, event, in_pkt, buf, len);
@@ -902,6 +978,10 @@ int _fsm(gnrc_tcp_tcb_t *tcb, fsm_event_t event, gnrc_pktsnip_t *in_pkt, void *b
         msg.type = MSG_TYPE_NOTIFY_USER;
         mbox_try_put(&(tcb->mbox), &msg);
     }
+#ifdef MODULE_GNRC_TCP_EVENT
+    /* Notify event queue, if the TCB is in non-blocking mode */
+    _event_update(tcb, event);
+#endif
     /* Unlock FSM */
     mutex_unlock(&(tcb->fsm_lock));
     return result;
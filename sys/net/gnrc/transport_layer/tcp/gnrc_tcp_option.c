@@ -16,8 +16,10 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  * @}
  */
+#include <string.h>
 #include "internal/common.h"
 #include "internal/option.h"
+#include "internal/pkt.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
@@ -60,6 +62,32 @@ int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                       tcb->mss);
                 break;
 
+            case TCP_OPTION_KIND_SACK_PERM:
+                if (option->length != TCP_OPTION_LENGTH_SACK_PERM) {
+                    DEBUG("gnrc_tcp_option.c : _option_parse() : invalid SACK_PERM Option length.\n");
+                    return -1;
+                }
+                /* SACK permitted is only valid within SYNs */
+                if (byteorder_ntohs(hdr->off_ctl) & MSK_SYN) {
+                    tcb->status |= STATUS_SACK_OK;
+                    DEBUG("gnrc_tcp_option.c : _option_parse() : SACK_PERM option found.\n");
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK:
+                if ((option->length < 10) || (((option->length - 2) % 8) != 0) ||
+                    (option->length > opt_left)) {
+                    DEBUG("gnrc_tcp_option.c : _option_parse() : invalid SACK Option length.\n");
+                    return -1;
+                }
+                for (uint8_t i = 0; i < (option->length - 2); i += 8) {
+                    network_uint32_t edges[2];
+
+                    memcpy(edges, &option->value[i], sizeof(edges));
+                    _pkt_sack(tcb, byteorder_ntohl(edges[0]), byteorder_ntohl(edges[1]));
+                }
+                break;
+
             default:
                 DEBUG("gnrc_tcp_option.c : _option_parse() : Unknown option found.\
                       KIND=%"PRIu8", LENGTH=%"PRIu8"\n", option->kind, option->length);
@@ -69,3 +97,20 @@ int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
     }
     return 0;
 }
+
+size_t _option_build_sack(const gnrc_tcp_tcb_t *tcb, uint8_t *opt_ptr)
+{
+    /* Pad with two NOP options to align the blocks to 32 bit */
+    opt_ptr[0] = TCP_OPTION_KIND_NOP;
+    opt_ptr[1] = TCP_OPTION_KIND_NOP;
+    opt_ptr[2] = TCP_OPTION_KIND_SACK;
+    opt_ptr[3] = 2 + (tcb->sack_len * 8);
+    for (uint8_t i = 0; i < tcb->sack_len; ++i) {
+        network_uint32_t edges[2];
+
+        edges[0] = byteorder_htonl(tcb->sack[i][0]);
+        edges[1] = byteorder_htonl(tcb->sack[i][1]);
+        memcpy(opt_ptr + 4 + (i * 8), edges, sizeof(edges));
+    }
+    return 4 + (tcb->sack_len * 8);
+}
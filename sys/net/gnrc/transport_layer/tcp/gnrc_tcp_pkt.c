@@ -171,6 +171,14 @@ int _pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt, uint16_t *seq_con,
     /* Add MSS option if SYN is sent */
     if (ctl & MSK_SYN) {
         offset += 1;
+        /* Offer SACK, answer only if the peer offered it (RFC 2018) */
+        if (!(ctl & MSK_ACK) || (tcb->status & STATUS_SACK_OK)) {
+            offset += 1;
+        }
+    }
+    /* Report out-of-order data, if SACK was negotiated */
+    else if ((ctl & MSK_ACK) && (tcb->status & STATUS_SACK_OK) && (tcb->sack_len > 0)) {
+        offset += 1 + (2 * tcb->sack_len);
     }
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(_option_build_offset_control(offset, ctl));
@@ -196,6 +204,18 @@ int _pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt, uint16_t *seq_con,
             if (ctl & MSK_SYN) {
                 network_uint32_t mss_option = byteorder_htonl(_option_build_mss(GNRC_TCP_MSS));
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
+                opt_left -= sizeof(mss_option);
+
+                /* Add SACK permitted option if there is space left for it */
+                if (opt_left > 0) {
+                    network_uint32_t sack_perm = byteorder_htonl(_option_build_sack_perm());
+                    memcpy(opt_ptr, &sack_perm, sizeof(sack_perm));
+                }
+            }
+            /* If there is space left in a non SYN: Add SACK option */
+            else {
+                _option_build_sack(tcb, opt_ptr);
             }
             /* Increase opt_ptr and decrease opt_left, if other options are added */
             /* NOTE: Add additional options here */
@@ -262,12 +282,18 @@ int _pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt, const uint16_t seq_c
 
     /* If this is no retransmission, advance sequence number and measure time */
     if (!retransmit) {
-        tcb->retries = 0;
+        /* Only one segment is timed at once */
+        if (seq_con > 0 && !(tcb->status & STATUS_RTT_MEASURE)) {
+            tcb->status |= STATUS_RTT_MEASURE;
+            tcb->rtt_start = xtimer_now().ticks32;
+            tcb->rtt_seq = tcb->snd_nxt + seq_con;
+        }
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = xtimer_now().ticks32;
     }
     else {
         tcb->retries += 1;
+        /* Karns Algorithm: Don't measure RTT on retransmitted segments */
+        tcb->status &= ~STATUS_RTT_MEASURE;
     }
 
     /* Pass packet down the network stack */
@@ -339,41 +365,17 @@ uint32_t _pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
-int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool retransmit)
+/**
+ * @brief Sets the retransmission timer.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     backoff   Flag used to indicate that the timer expired before.
+ */
+static void _set_rto_timer(gnrc_tcp_tcb_t *tcb, const bool backoff)
 {
-    gnrc_pktsnip_t *snp = NULL;
-    uint32_t ctl = 0;
-    uint32_t len = 0;
-
-    /* No packet received */
-    if (pkt == NULL) {
-        DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : pkt=NULL\n");
-        return -EINVAL;
-    }
-
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
-        DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : Nothing to do\n");
-        return -ENOMEM;
-    }
-
-    /* Extract control bits and segment length */
-    LL_SEARCH_SCALAR(pkt, snp, type, GNRC_NETTYPE_TCP);
-    ctl = byteorder_ntohs(((tcp_hdr_t *) snp->data)->off_ctl);
-    len = _pkt_get_pay_len(pkt);
-
-    /* Check if pkt contains reset or is a pure ACK, return */
-    if ((ctl & MSK_RST) || (((ctl & MSK_SYN_FIN_ACK) == MSK_ACK) && len == 0)) {
-        return 0;
-    }
-
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
-    gnrc_pktbuf_hold(pkt, 1);
-
     /* RTO adjustment */
-    if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
+    if (!backoff) {
+        /* If there is no measurement yet: rto is 1 sec (Lower Bound) */
         if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
             tcb->rto = GNRC_TCP_RTO_LOWER_BOUND;
         }
@@ -402,41 +404,94 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
     }
 
     /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    xtimer_remove(&tcb->tim_tout);
     tcb->msg_tout.type = MSG_TYPE_RETRANSMISSION;
     tcb->msg_tout.content.ptr = (void *) tcb;
     xtimer_set_msg(&tcb->tim_tout, tcb->rto, &tcb->msg_tout, gnrc_tcp_pid);
+}
+
+int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool retransmit)
+{
+    gnrc_pktsnip_t *snp = NULL;
+    uint32_t ctl = 0;
+    uint32_t len = 0;
+
+    /* No packet received */
+    if (pkt == NULL) {
+        DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : pkt=NULL\n");
+        return -EINVAL;
+    }
+
+    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
+    if (!retransmit && tcb->rtx_len >= GNRC_TCP_RTX_QUEUE_SIZE) {
+        DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : Nothing to do\n");
+        return -ENOMEM;
+    }
+
+    /* Extract control bits and segment length */
+    LL_SEARCH_SCALAR(pkt, snp, type, GNRC_NETTYPE_TCP);
+    ctl = byteorder_ntohs(((tcp_hdr_t *) snp->data)->off_ctl);
+    len = _pkt_get_pay_len(pkt);
+
+    /* Check if pkt contains reset or is a pure ACK, return */
+    if ((ctl & MSK_RST) || (((ctl & MSK_SYN_FIN_ACK) == MSK_ACK) && len == 0)) {
+        return 0;
+    }
+
+    /* Append pkt and increase users: every send attempt consumes a user */
+    if (!retransmit) {
+        tcb->rtx_queue[tcb->rtx_len++] = pkt;
+    }
+    gnrc_pktbuf_hold(pkt, 1);
+
+    /* The timer is already running if there are older packets in flight */
+    if (!retransmit && tcb->rtx_len > 1) {
+        return 0;
+    }
+    _set_rto_timer(tcb, retransmit);
     return 0;
 }
 
 int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
-    uint32_t seg = 0;
+    uint8_t acked = 0;
     gnrc_pktsnip_t *snp = NULL;
     tcp_hdr_t *hdr;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->rtx_len == 0) {
         DEBUG("gnrc_tcp_pkt.c : _pkt_acknowledge() : There is no packet to ack\n");
         return -ENODATA;
     }
 
-    LL_SEARCH_SCALAR(tcb->pkt_retransmit, snp, type, GNRC_NETTYPE_TCP);
-    hdr = (tcp_hdr_t *) snp->data;
-
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _pkt_get_seg_len(tcb->pkt_retransmit) - 1;
+    /* Release all packets that were acknowledged completely */
+    while (acked < tcb->rtx_len) {
+        gnrc_pktsnip_t *pkt = tcb->rtx_queue[acked];
 
-    /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        xtimer_remove(&(tcb->tim_tout));
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        LL_SEARCH_SCALAR(pkt, snp, type, GNRC_NETTYPE_TCP);
+        hdr = (tcp_hdr_t *) snp->data;
+        uint32_t seg = byteorder_ntohl(hdr->seq_num) + _pkt_get_seg_len(pkt) - 1;
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
+        }
+        gnrc_pktbuf_release(pkt);
+        acked++;
+    }
+    if (acked == 0) {
+        return 0;
+    }
+    tcb->rtx_len -= acked;
+    memmove(tcb->rtx_queue, &tcb->rtx_queue[acked], tcb->rtx_len * sizeof(tcb->rtx_queue[0]));
+    tcb->rtx_sacked >>= acked;
+    tcb->retries = 0;
 
-        /* Measure round trip time */
+    /* Measure round trip time, if the timed segment was acknowledged */
+    if ((tcb->status & STATUS_RTT_MEASURE) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
         int32_t rtt = xtimer_now().ticks32 - tcb->rtt_start;
 
-        /* Use time only if ther was no timer overflow and no retransmission (Karns Alogrithm) */
-        if (tcb->retries == 0 && rtt > 0) {
+        tcb->status &= ~STATUS_RTT_MEASURE;
+        /* Use time only if there was no timer overflow */
+        if (rtt > 0) {
             /* If this is the first sample taken */
             if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
                 tcb->srtt = rtt;
@@ -451,6 +506,62 @@ int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
             }
         }
     }
+
+    /* Stop timer if everything was acknowledged, restart it for the remaining packets if not */
+    if (tcb->rtx_len == 0) {
+        xtimer_remove(&(tcb->tim_tout));
+    }
+    else {
+        _set_rto_timer(tcb, false);
+    }
+    return acked;
+}
+
+void _pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right)
+{
+    gnrc_pktsnip_t *snp = NULL;
+
+    /* Ignore blocks outside of the data in flight */
+    if (!LSS_32_BIT(left, right) || LEQ_32_BIT(left, tcb->snd_una) ||
+        LSS_32_BIT(tcb->snd_nxt, right)) {
+        return;
+    }
+    for (uint8_t i = 0; i < tcb->rtx_len; ++i) {
+        LL_SEARCH_SCALAR(tcb->rtx_queue[i], snp, type, GNRC_NETTYPE_TCP);
+        uint32_t seq = byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num);
+        uint32_t end = seq + _pkt_get_seg_len(tcb->rtx_queue[i]);
+
+        if (LEQ_32_BIT(left, seq) && LEQ_32_BIT(end, right)) {
+            tcb->rtx_sacked |= (1 << i);
+        }
+    }
+}
+
+int _pkt_retransmit(gnrc_tcp_tcb_t *tcb, const bool timeout)
+{
+    uint8_t i = 0;
+
+    if (tcb->rtx_len == 0) {
+        DEBUG("gnrc_tcp_pkt.c : _pkt_retransmit() : Retransmit queue is empty\n");
+        return -ENODATA;
+    }
+    if (timeout) {
+        /* The peer may have discarded SACKed data, start over (RFC 2018, section 8) */
+        tcb->rtx_sacked = 0;
+        _pkt_setup_retransmit(tcb, tcb->rtx_queue[0], true);
+        _pkt_send(tcb, tcb->rtx_queue[0], 0, true);
+        return 0;
+    }
+    /* Fast retransmit: Send the oldest packet the peer is missing */
+    while (i < tcb->rtx_len && (tcb->rtx_sacked & (1 << i))) {
+        i++;
+    }
+    if (i == tcb->rtx_len) {
+        return -ENODATA;
+    }
+    gnrc_pktbuf_hold(tcb->rtx_queue[i], 1);
+    tcb->status &= ~STATUS_RTT_MEASURE;
+    gnrc_netapi_send(gnrc_tcp_pid, tcb->rtx_queue[i]);
     return 0;
 }
 
@@ -458,18 +569,15 @@ uint16_t _pkt_calc_csum(const gnrc_pktsnip_t *hdr, const gnrc_pktsnip_t *pseudo_
                         const gnrc_pktsnip_t *payload)
 {
     uint16_t csum = 0;
-    uint16_t len = (uint16_t) hdr->size;
+    size_t len = hdr->size;
 
     if (pseudo_hdr == NULL) {
         return 0;
     }
 
     /* Process payload */
-    while (payload && payload != hdr) {
-        csum = inet_csum(csum, (uint8_t *)payload->data, payload->size);
-        len += (uint16_t)payload->size;
-        payload = payload->next;
-    }
+    csum = inet_csum_iolist(csum, (const iolist_t *)payload,
+                            (const iolist_t *)hdr, &len);
 
     /* Process TCP header, before checksum field(Byte 16 to 18) */
     csum = inet_csum(csum, (uint8_t *) hdr->data, 16);
@@ -480,7 +588,8 @@ uint16_t _pkt_calc_csum(const gnrc_pktsnip_t *hdr, const gnrc_pktsnip_t *pseudo_
     switch (pseudo_hdr->type) {
 #ifdef MODULE_GNRC_IPV6
         case GNRC_NETTYPE_IPV6:
-            csum = ipv6_hdr_inet_csum(csum, pseudo_hdr->data, PROTNUM_TCP, len);
+            csum = ipv6_hdr_inet_csum(csum, pseudo_hdr->data, PROTNUM_TCP,
+                                      (uint16_t)len);
             break;
 #endif
         default:
@@ -16,6 +16,10 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 #include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include "internal/common.h"
 #include "internal/rcvbuf.h"
 
 #define ENABLE_DEBUG (0)
@@ -99,3 +103,110 @@ void _rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
         tcb->rcv_buf_raw = NULL;
     }
 }
+
+/**
+ * @brief Copy data into the receive buffer, behind the readable data.
+ *
+ * @param[in,out] rb     Ringbuffer to copy into.
+ * @param[in]     off    Offset from the end of the readable data.
+ * @param[in]     data   Data to copy.
+ * @param[in]     len    Number of bytes to copy.
+ */
+static void _rcvbuf_copy(ringbuffer_t *rb, uint32_t off, const uint8_t *data, uint32_t len)
+{
+    uint32_t pos = (rb->start + rb->avail + off) % rb->size;
+    uint32_t chunk = rb->size - pos;
+
+    if (chunk > len) {
+        chunk = len;
+    }
+    memcpy(rb->buf + pos, data, chunk);
+    memcpy(rb->buf, data + chunk, len - chunk);
+}
+
+/**
+ * @brief Remove a block from the list of out-of-order blocks.
+ *
+ * @param[in,out] tcb   TCB holding the list of out-of-order blocks.
+ * @param[in]     i     Index of the block to remove.
+ */
+static void _rcvbuf_remove_block(gnrc_tcp_tcb_t *tcb, unsigned i)
+{
+    tcb->sack_len--;
+    memmove(tcb->sack[i], tcb->sack[i + 1], (tcb->sack_len - i) * sizeof(tcb->sack[0]));
+}
+
+uint32_t _rcvbuf_store(gnrc_tcp_tcb_t *tcb, uint32_t seq, gnrc_pktsnip_t *snp)
+{
+    ringbuffer_t *rb = &(tcb->rcv_buf);
+    uint32_t free = ringbuffer_get_free(rb);
+    uint32_t left = tcb->rcv_nxt;
+    uint32_t right = tcb->rcv_nxt;
+    uint32_t readable = 0;
+    bool stored = false;
+
+    /* Copy payload into the receive buffer, skip already received and excess data */
+    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
+        const uint8_t *data = snp->data;
+        uint32_t len = snp->size;
+
+        if (LSS_32_BIT(seq, tcb->rcv_nxt)) {
+            uint32_t skip = tcb->rcv_nxt - seq;
+            skip = (skip < len) ? skip : len;
+            seq += skip;
+            data += skip;
+            len -= skip;
+        }
+        uint32_t off = seq - tcb->rcv_nxt;
+        if (off >= free) {
+            break;
+        }
+        len = (len < (free - off)) ? len : (free - off);
+        if (len > 0) {
+            _rcvbuf_copy(rb, off, data, len);
+            if (!stored) {
+                left = seq;
+                stored = true;
+            }
+            seq += len;
+            right = seq;
+        }
+        snp = snp->next;
+    }
+    if (!stored) {
+        return 0;
+    }
+
+    /* Merge with overlapping or adjacent out-of-order blocks */
+    for (unsigned i = 0; i < tcb->sack_len;) {
+        if (LEQ_32_BIT(tcb->sack[i][0], right) && LEQ_32_BIT(left, tcb->sack[i][1])) {
+            left = LSS_32_BIT(tcb->sack[i][0], left) ? tcb->sack[i][0] : left;
+            right = LSS_32_BIT(right, tcb->sack[i][1]) ? tcb->sack[i][1] : right;
+            _rcvbuf_remove_block(tcb, i);
+            i = 0;
+        }
+        else {
+            i++;
+        }
+    }
+
+    /* Data is in order: Make it readable */
+    if (left == tcb->rcv_nxt) {
+        readable = right - left;
+        rb->avail += readable;
+        tcb->rcv_nxt = right;
+    }
+    /* Data is out of order: Report it first, drop the oldest block if necessary */
+    else {
+        if (tcb->sack_len == GNRC_TCP_SACK_BLOCKS) {
+            tcb->sack_len--;
+        }
+        memmove(tcb->sack[1], tcb->sack[0], tcb->sack_len * sizeof(tcb->sack[0]));
+        tcb->sack[0][0] = left;
+        tcb->sack[0][1] = right;
+        tcb->sack_len++;
+    }
+    DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_store() : [%"PRIu32", %"PRIu32"), readable=%"PRIu32"\n",
+          left, right, readable);
+    return readable;
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_tcp TCP
+ * @ingroup     net_gnrc
+ * @brief       RIOT's TCP implementation for the GNRC network stack.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Congestion control and loss recovery.
+ *
+ * Implements slow start and congestion avoidance (RFC 5681) with NewReno fast
+ * recovery (RFC 6582). With module `gnrc_tcp_cubic`, the congestion window
+ * grows and shrinks according to CUBIC (RFC 8312) instead.
+ */
+
+#ifndef CC_H
+#define CC_H
+
+#include <stdint.h>
+#include "net/gnrc/tcp/config.h"
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Default MSS if the peer did not announce one (RFC 1122, section 4.2.2.6).
+ */
+#define CC_DEFAULT_MSS (536U)
+
+/**
+ * @brief Calculates the sender maximum segment size (SMSS) of a connection.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   The largest payload a segment sent on this connection may carry.
+ */
+static inline uint32_t _cc_smss(const gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t mss = (tcb->mss > 0) ? tcb->mss : CC_DEFAULT_MSS;
+    return (mss < GNRC_TCP_MSS) ? mss : GNRC_TCP_MSS;
+}
+
+/**
+ * @brief Initializes congestion control of an established connection.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _cc_init(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Handles an ACK that acknowledged new data.
+ *
+ * @note Must be called after tcb->snd_una was advanced.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     acked   Number of newly acknowledged bytes.
+ */
+void _cc_ack(gnrc_tcp_tcb_t *tcb, const uint32_t acked);
+
+/**
+ * @brief Handles a duplicate ACK. Triggers fast retransmit on the third one.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _cc_dup_ack(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Handles a retransmission timeout.
+ *
+ * @note Must be called before the retransmission is sent.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _cc_timeout(gnrc_tcp_tcb_t *tcb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CC_H */
+/** @} */
@@ -49,8 +49,24 @@ extern "C" {
 #define STATUS_ALLOW_ANY_ADDR (1 << 1)
 #define STATUS_NOTIFY_USER    (1 << 2)
 #define STATUS_WAIT_FOR_MSG   (1 << 3)
+#define STATUS_RTT_MEASURE    (1 << 4)
+#define STATUS_SACK_OK        (1 << 5)
+#define STATUS_FAST_RECOVERY  (1 << 6)
+#define STATUS_ABORTED        (1 << 7)
 /** @} */
 
+#if (GNRC_TCP_RTX_QUEUE_SIZE < 2) || (GNRC_TCP_RTX_QUEUE_SIZE > 8)
+#error "GNRC_TCP_RTX_QUEUE_SIZE must be between 2 and 8"
+#endif
+
+#if (GNRC_TCP_SACK_BLOCKS < 1) || (GNRC_TCP_SACK_BLOCKS > 4)
+#error "GNRC_TCP_SACK_BLOCKS must be between 1 and 4"
+#endif
+
+#if GNRC_TCP_DEFAULT_WINDOW > 0xFFFF
+#error "GNRC_TCP_DEFAULT_WINDOW must fit into the 16 bit window field"
+#endif
+
 /**
  * @brief Defines for "eventloop" thread settings.
  * @{
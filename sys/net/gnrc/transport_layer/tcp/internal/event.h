@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_tcp TCP
+ * @ingroup     net_gnrc
+ * @brief       RIOT's TCP implementation for the GNRC network stack.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event notifications for TCBs in non-blocking mode.
+ */
+
+#ifndef GNRC_TCP_INTERNAL_EVENT_H
+#define GNRC_TCP_INTERNAL_EVENT_H
+
+#include <stdbool.h>
+#include "net/gnrc/tcp/tcb.h"
+#include "fsm.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Checks if a TCB is in non-blocking mode.
+ *
+ * @param[in] tcb   TCB to check.
+ *
+ * @returns   true if @p tcb was bound to an event queue.
+ */
+static inline bool _event_nonblocking(const gnrc_tcp_tcb_t *tcb)
+{
+#ifdef MODULE_GNRC_TCP_EVENT
+    return (tcb->evq != NULL);
+#else
+    (void) tcb;
+    return false;
+#endif
+}
+
+/**
+ * @brief Checks if a timeout belongs to the current run of a TCB's timer.
+ *
+ * A timeout message may already be queued when the timer is stopped or
+ * restarted. Such a message must not time out the connection.
+ *
+ * @note Must be called with the FSM of @p tcb locked.
+ *
+ * @param[in] tcb     TCB holding the connection information.
+ * @param[in] event   Event the FSM is about to handle.
+ *
+ * @returns   false if @p event is a timeout of tcb->tim_event that is not
+ *            current anymore.
+ * @returns   true otherwise.
+ */
+bool _event_timeout_current(const gnrc_tcp_tcb_t *tcb, fsm_event_t event);
+
+/**
+ * @brief Notifies the owner of a TCB in non-blocking mode and maintains
+ *        its timeouts.
+ *
+ * @note Must be called with the FSM of @p tcb locked, after the FSM handled
+ *       @p event.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     event   Event the FSM handled.
+ */
+void _event_update(gnrc_tcp_tcb_t *tcb, fsm_event_t event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_TCP_INTERNAL_EVENT_H */
+/** @} */
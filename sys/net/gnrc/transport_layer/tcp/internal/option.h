@@ -44,6 +44,18 @@ static inline uint32_t _option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+/**
+ * @brief Helper function to build the SACK permitted option.
+ *
+ * @returns   SACK permitted option value, padded with two NOP options.
+ */
+static inline uint32_t _option_build_sack_perm(void)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK_PERM << 8) | TCP_OPTION_LENGTH_SACK_PERM);
+}
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
@@ -69,6 +81,16 @@ static inline uint16_t _option_build_offset_control(uint16_t nopts, uint16_t ctl
  */
 int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
 
+/**
+ * @brief Writes a SACK option with all out-of-order blocks of a given TCB.
+ *
+ * @param[in]  tcb       TCB holding the out-of-order blocks.
+ * @param[out] opt_ptr   Option field to write to. Must hold 4 + 8 * tcb->sack_len bytes.
+ *
+ * @returns   Number of bytes written to @p opt_ptr.
+ */
+size_t _option_build_sack(const gnrc_tcp_tcb_t *tcb, uint8_t *opt_ptr);
+
 #ifdef __cplusplus
 }
 #endif
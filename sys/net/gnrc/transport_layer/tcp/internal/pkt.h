@@ -126,11 +126,36 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
  *
- * @returns   Zero on success.
+ * @returns   Number of packets removed from the retransmission queue.
  *            -ENODATA if there is nothing to acknowledge.
  */
 int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
 
+/**
+ * @brief Marks packets in the retransmission queue covered by a SACK block.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     left    Left edge of the SACK block.
+ * @param[in]     right   Right edge of the SACK block.
+ */
+void _pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right);
+
+/**
+ * @brief Retransmits a packet from the retransmission queue.
+ *
+ * On a retransmission timeout, the oldest packet is sent again, the
+ * retransmission timer is backed off and all SACK information is discarded.
+ * Otherwise (fast retransmit) the oldest packet not SACKed by the peer is sent
+ * again without touching the retransmission timer.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     timeout   Flag used to indicate a retransmission timeout.
+ *
+ * @returns   Zero on success.
+ *            -ENODATA if there is nothing to retransmit.
+ */
+int _pkt_retransmit(gnrc_tcp_tcb_t *tcb, const bool timeout);
+
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
  *
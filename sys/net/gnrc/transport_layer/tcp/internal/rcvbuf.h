@@ -24,6 +24,7 @@
 
 #include <stdint.h>
 #include "mutex.h"
+#include "net/gnrc/pkt.h"
 #include "net/gnrc/tcp/config.h"
 #include "net/gnrc/tcp/tcb.h"
 
@@ -69,6 +70,21 @@ int _rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
  */
 void _rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Store received payload in the receive buffer.
+ *
+ * Data ahead of tcb->rcv_nxt is kept behind the readable part of the receive
+ * buffer and recorded in tcb->sack, until the missing data arrives.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ * @param[in]     seq   Sequence number of the first byte in @p snp.
+ * @param[in]     snp   First payload snip of the received packet.
+ *
+ * @returns   Number of bytes that became readable. tcb->rcv_nxt was advanced
+ *            by this amount.
+ */
+uint32_t _rcvbuf_store(gnrc_tcp_tcb_t *tcb, uint32_t seq, gnrc_pktsnip_t *snp);
+
 #ifdef __cplusplus
 }
 #endif
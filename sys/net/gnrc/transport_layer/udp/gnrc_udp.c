@@ -17,6 +17,7 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <errno.h>
 
@@ -29,7 +30,9 @@
 #include "net/gnrc.h"
 #include "net/gnrc/icmpv6/error.h"
 #include "net/inet_csum.h"
-
+#ifdef MODULE_GNRC_EVENT_LOOP
+#include "net/gnrc/event_loop.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -39,6 +42,7 @@
  */
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 
+#ifndef MODULE_GNRC_EVENT_LOOP
 /**
  * @brief   Allocate memory for the UDP thread's stack
  */
@@ -47,6 +51,7 @@ static char _stack[GNRC_UDP_STACK_SIZE + THREAD_EXTRA_STACKSIZE_PRINTF];
 #else
 static char _stack[GNRC_UDP_STACK_SIZE];
 #endif
+#endif
 
 /**
  * @brief   Calculate the UDP checksum dependent on the network protocol
@@ -65,21 +70,18 @@ static uint16_t _calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr,
                            gnrc_pktsnip_t *payload)
 {
     uint16_t csum = 0;
-    uint16_t len = (uint16_t)hdr->size;
+    size_t len = hdr->size;
 
     /* process the payload */
-    while (payload && payload != hdr && payload != pseudo_hdr) {
-        csum = inet_csum_slice(csum, (uint8_t *)(payload->data), payload->size, len);
-        len += (uint16_t)payload->size;
-        payload = payload->next;
-    }
+    csum = inet_csum_iolist(csum, (iolist_t *)payload, (iolist_t *)hdr, &len);
     /* process applicable UDP header bytes */
     csum = inet_csum(csum, (uint8_t *)hdr->data, sizeof(udp_hdr_t));
 
     switch (pseudo_hdr->type) {
 #ifdef MODULE_GNRC_IPV6
         case GNRC_NETTYPE_IPV6:
-            csum = ipv6_hdr_inet_csum(csum, pseudo_hdr->data, PROTNUM_UDP, len);
+            csum = ipv6_hdr_inet_csum(csum, pseudo_hdr->data, PROTNUM_UDP,
+                                      (uint16_t)len);
             break;
 #endif
         default:
@@ -220,16 +222,42 @@ static void _send(gnrc_pktsnip_t *pkt)
     }
 }
 
+static bool _handle_msg(msg_t *msg)
+{
+    switch (msg->type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV\n");
+            _receive(msg->content.ptr);
+            break;
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
+            _send(msg->content.ptr);
+            break;
+        case GNRC_NETAPI_MSG_TYPE_SET:
+        case GNRC_NETAPI_MSG_TYPE_GET: {
+            msg_t reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK,
+                            .content = { .value = (uint32_t)-ENOTSUP } };
+
+            msg_reply(msg, &reply);
+            break;
+        }
+        default:
+            DEBUG("udp: received unidentified message\n");
+            return false;
+    }
+    return true;
+}
+
+#ifdef MODULE_GNRC_EVENT_LOOP
+static gnrc_event_loop_layer_t _layer = GNRC_EVENT_LOOP_LAYER_INIT(_handle_msg);
+#else
 static void *_event_loop(void *arg)
 {
     (void)arg;
-    msg_t msg, reply;
+    msg_t msg;
     msg_t msg_queue[GNRC_UDP_MSG_QUEUE_SIZE];
     gnrc_netreg_entry_t netreg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             sched_active_pid);
-    /* preset reply message */
-    reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
-    reply.content.value = (uint32_t)-ENOTSUP;
     /* initialize message queue */
     msg_init_queue(msg_queue, GNRC_UDP_MSG_QUEUE_SIZE);
     /* register UPD at netreg */
@@ -238,28 +266,13 @@ static void *_event_loop(void *arg)
     /* dispatch NETAPI messages */
     while (1) {
         msg_receive(&msg);
-        switch (msg.type) {
-            case GNRC_NETAPI_MSG_TYPE_RCV:
-                DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV\n");
-                _receive(msg.content.ptr);
-                break;
-            case GNRC_NETAPI_MSG_TYPE_SND:
-                DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
-                _send(msg.content.ptr);
-                break;
-            case GNRC_NETAPI_MSG_TYPE_SET:
-            case GNRC_NETAPI_MSG_TYPE_GET:
-                msg_reply(&msg, &reply);
-                break;
-            default:
-                DEBUG("udp: received unidentified message\n");
-                break;
-        }
+        _handle_msg(&msg);
     }
 
     /* never reached */
     return NULL;
 }
+#endif
 
 int gnrc_udp_calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr)
 {
@@ -305,9 +318,16 @@ int gnrc_udp_init(void)
 {
     /* check if thread is already running */
     if (_pid == KERNEL_PID_UNDEF) {
+#ifdef MODULE_GNRC_EVENT_LOOP
+        _pid = gnrc_event_loop_init();
+        /* register UDP at netreg */
+        gnrc_event_loop_register(&_layer, GNRC_NETTYPE_UDP,
+                                 GNRC_NETREG_DEMUX_CTX_ALL);
+#else
         /* start UDP thread */
         _pid = thread_create(_stack, sizeof(_stack), GNRC_UDP_PRIO,
                              THREAD_CREATE_STACKTEST, _event_loop, NULL, "udp");
+#endif
     }
     return _pid;
 }
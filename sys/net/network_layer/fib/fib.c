@@ -37,6 +37,10 @@
 #include "net/fib.h"
 #include "net/fib/table.h"
 
+#ifdef MODULE_FIB_TRIE
+#include "fib_trie.h"
+#endif
+
 #ifdef MODULE_IPV6_ADDR
 #include "net/ipv6/addr.h"
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
@@ -65,6 +69,94 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
     *target = xtimer_now_usec64() + (ms * US_PER_MS);
 }
 
+#ifdef MODULE_FIB_TRIE
+/**
+ * @brief checks if lookups in the given table use the trie
+ *
+ * @param[in] table  the FIB table
+ *
+ * @return true if the trie is used
+ */
+static inline bool fib_use_trie(fib_table_t *table)
+{
+    return (table->table_type == FIB_TABLE_TYPE_SH) && (table->trie.nodes != NULL);
+}
+
+/**
+ * @brief marks the table for a sweep of expired entries on its next access
+ *
+ * @param[in] arg   the FIB table
+ */
+static void fib_expiry_cb(void *arg)
+{
+    fib_table_t *table = arg;
+
+    table->trie.sweep_due = 1;
+}
+
+/**
+ * @brief sets the expiry timer, if the given lifetime expires before the
+ *        one the timer is currently set to
+ *
+ * @param[in] table     the FIB table
+ * @param[in] lifetime  absolute lifetime of an entry in us
+ */
+static void fib_expiry_set(fib_table_t *table, uint64_t lifetime)
+{
+    if ((lifetime == FIB_LIFETIME_NO_EXPIRE) ||
+        (lifetime >= table->trie.next_expiry)) {
+        return;
+    }
+
+    uint64_t now = xtimer_now_usec64();
+
+    table->trie.next_expiry = lifetime;
+    table->trie.expiry_timer.callback = fib_expiry_cb;
+    table->trie.expiry_timer.arg = table;
+    /* an entry counts as expired once its lifetime is in the past */
+    xtimer_set64(&table->trie.expiry_timer,
+                 (lifetime >= now) ? (lifetime - now + 1) : 0);
+}
+
+static int fib_remove(fib_table_t *table, fib_entry_t *entry);
+
+/**
+ * @brief removes all expired entries, if the expiry timer fired since the
+ *        last sweep, and sets the timer to the next lifetime to expire
+ *
+ * @param[in] table     the FIB table
+ */
+static void fib_expiry_sweep(fib_table_t *table)
+{
+    if (!table->trie.sweep_due) {
+        return;
+    }
+
+    uint64_t now = xtimer_now_usec64();
+    uint64_t next = FIB_LIFETIME_NO_EXPIRE;
+
+    table->trie.sweep_due = 0;
+    table->trie.next_expiry = FIB_LIFETIME_NO_EXPIRE;
+
+    for (size_t i = 0; i < table->size; ++i) {
+        fib_entry_t *entry = &table->data.entries[i];
+
+        if ((entry->lifetime == 0) || (entry->lifetime == FIB_LIFETIME_NO_EXPIRE)) {
+            continue;
+        }
+        if (entry->lifetime < now) {
+            DEBUG("[fib_expiry_sweep] entry %p expired\n", (void *)entry);
+            fib_remove(table, entry);
+        }
+        else if (entry->lifetime < next) {
+            next = entry->lifetime;
+        }
+    }
+
+    fib_expiry_set(table, next);
+}
+#endif
+
 /**
  * @brief returns pointer to the entry for the given destination address
  *
@@ -81,6 +173,16 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
  */
 static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
                           fib_entry_t **entry_arr, size_t *entry_arr_size) {
+#ifdef MODULE_FIB_TRIE
+    if (fib_use_trie(table)) {
+        /* lifetimes are handled by the expiry timer instead of inline */
+        fib_expiry_sweep(table);
+        int res = fib_trie_find(table, dst, dst_size, &entry_arr[0]);
+
+        *entry_arr_size = (res < 0) ? 0 : 1;
+        return res;
+    }
+#endif
     uint64_t now = xtimer_now_usec64();
 
     size_t count = 0;
@@ -192,6 +294,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
 /**
  * @brief updates the next hop the lifetime and the interface id for a given entry
  *
+ * @param[in] table          the FIB table the entry belongs to
  * @param[in] entry          the entry to be updated
  * @param[in] next_hop       the next hop address to be updated
  * @param[in] next_hop_size  the next hop address size
@@ -201,7 +304,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
  * @return 0 if the entry has been updated
  *         -ENOMEM if the entry cannot be updated due to insufficient RAM
  */
-static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
+static int fib_upd_entry(fib_table_t *table, fib_entry_t *entry, uint8_t *next_hop,
                          size_t next_hop_size, uint32_t next_hop_flags,
                          uint32_t lifetime)
 {
@@ -222,6 +325,14 @@ static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
         entry->lifetime = FIB_LIFETIME_NO_EXPIRE;
     }
 
+#ifdef MODULE_FIB_TRIE
+    if (fib_use_trie(table)) {
+        fib_expiry_set(table, entry->lifetime);
+    }
+#else
+    (void)table;
+#endif
+
     return 0;
 }
 
@@ -268,6 +379,17 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                     table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
                 }
 
+#ifdef MODULE_FIB_TRIE
+                if (fib_use_trie(table)) {
+                    if (fib_trie_add(table, &table->data.entries[i]) != 0) {
+                        /* do not keep an entry lookups can't find */
+                        fib_remove(table, &table->data.entries[i]);
+                        return -ENOMEM;
+                    }
+                    fib_expiry_set(table, table->data.entries[i].lifetime);
+                }
+#endif
+
                 return 0;
             }
         }
@@ -279,12 +401,21 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
 /**
  * @brief removes the given entry
  *
+ * @param[in] table the FIB table the entry belongs to
  * @param[in] entry the entry to be removed
  *
  * @return 0 on success
  */
-static int fib_remove(fib_entry_t *entry)
+static int fib_remove(fib_table_t *table, fib_entry_t *entry)
 {
+#ifdef MODULE_FIB_TRIE
+    if (fib_use_trie(table) && (entry->lifetime != 0) && (entry->global != NULL)) {
+        fib_trie_remove(table, entry);
+    }
+#else
+    (void)table;
+#endif
+
     if (entry->global != NULL) {
         universal_address_rem(entry->global);
     }
@@ -403,7 +534,7 @@ int fib_add_entry(fib_table_t *table,
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
     }
     else {
         ret = fib_create_entry(table, iface_id, dst, dst_size, dst_flags,
@@ -433,7 +564,7 @@ int fib_update_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
     if (fib_find_entry(table, dst, dst_size, &(entry[0]), &count) == 1) {
         DEBUG("[fib_update_entry] found entry: %p\n", (void *)(entry[0]));
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -457,7 +588,7 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        fib_remove(entry[0]);
+        fib_remove(table, entry[0]);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -477,7 +608,7 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
     for (size_t i = 0; i < table->size; ++i) {
         if ((interface == KERNEL_PID_UNDEF) ||
             (interface == table->data.entries[i].iface_id)) {
-            fib_remove(&table->data.entries[i]);
+            fib_remove(table, &table->data.entries[i]);
         }
     }
 
@@ -597,6 +728,14 @@ void fib_init(fib_table_t *table)
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
     }
+#ifdef MODULE_FIB_TRIE
+    if (fib_use_trie(table)) {
+        xtimer_remove(&table->trie.expiry_timer);
+        table->trie.next_expiry = FIB_LIFETIME_NO_EXPIRE;
+        table->trie.sweep_due = 0;
+        fib_trie_reset(table);
+    }
+#endif
     universal_address_init();
     mutex_unlock(&(table->mtx_access));
 }
@@ -622,6 +761,14 @@ void fib_deinit(fib_table_t *table)
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
     }
+#ifdef MODULE_FIB_TRIE
+    if (fib_use_trie(table)) {
+        xtimer_remove(&table->trie.expiry_timer);
+        table->trie.next_expiry = FIB_LIFETIME_NO_EXPIRE;
+        table->trie.sweep_due = 0;
+        fib_trie_reset(table);
+    }
+#endif
     universal_address_reset();
     mutex_unlock(&(table->mtx_access));
 }
@@ -0,0 +1,297 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_fib
+ * @{
+ *
+ * @file
+ * @brief       Longest-prefix-match trie over FIB single hop entries
+ *
+ * @}
+ */
+
+#ifdef MODULE_FIB_TRIE
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "net/fib.h"
+#include "fib_trie.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+static inline unsigned _bit(const uint8_t *key, unsigned pos)
+{
+    return (key[pos >> 3] >> (7 - (pos & 0x7))) & 0x1;
+}
+
+/**
+ * @brief   Counts the leading bits @p a and @p b have in common
+ *
+ * @param[in] a     a key
+ * @param[in] b     another key
+ * @param[in] from  number of leading bits already known to be equal
+ * @param[in] max   maximum number of bits to compare
+ *
+ * @return  number of equal leading bits, at most @p max
+ */
+static unsigned _common_bits(const uint8_t *a, const uint8_t *b,
+                             unsigned from, unsigned max)
+{
+    for (unsigned i = from >> 3; (i << 3) < max; i++) {
+        uint8_t diff = a[i] ^ b[i];
+
+        if (diff != 0) {
+            unsigned res = i << 3;
+
+            while (!(diff & 0x80)) {
+                diff <<= 1;
+                res++;
+            }
+            return (res < max) ? res : max;
+        }
+    }
+    return max;
+}
+
+static unsigned _prefix_len(const fib_entry_t *entry)
+{
+    const universal_address_container_t *global = entry->global;
+    unsigned len = global->address_size << 3;
+    unsigned i;
+
+    for (i = 0; i < global->address_size; i++) {
+        if (global->address[i] != 0) {
+            break;
+        }
+    }
+    if (i == global->address_size) {
+        /* all-zero address: default route */
+        return 0;
+    }
+    if (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK) {
+        unsigned prefix_len = (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK)
+                              >> FIB_FLAG_NET_PREFIX_SHIFT;
+
+        if (prefix_len < len) {
+            return prefix_len;
+        }
+    }
+    return len;
+}
+
+static fib_trie_node_t *_alloc(fib_trie_t *trie, const uint8_t *key,
+                               unsigned prefix_len, fib_entry_t *entry)
+{
+    fib_trie_node_t *node = trie->free;
+
+    if (node == NULL) {
+        DEBUG("[fib_trie] node pool exhausted\n");
+        return NULL;
+    }
+    trie->free = node->child[0];
+    memset(node, 0, sizeof(fib_trie_node_t));
+    node->entry = entry;
+    node->prefix_len = prefix_len;
+    memcpy(node->key, key, (prefix_len + 7) >> 3);
+    if (prefix_len & 0x7) {
+        node->key[prefix_len >> 3] &= (uint8_t)(0xff << (8 - (prefix_len & 0x7)));
+    }
+    return node;
+}
+
+static void _free(fib_trie_t *trie, fib_trie_node_t *node)
+{
+    node->entry = NULL;
+    node->dup = NULL;
+    node->child[1] = NULL;
+    node->child[0] = trie->free;
+    trie->free = node;
+}
+
+/* removes the node at *link if it neither holds an entry nor branches */
+static void _compress(fib_trie_t *trie, fib_trie_node_t **link)
+{
+    fib_trie_node_t *node = *link;
+
+    if ((node->entry != NULL) ||
+        ((node->child[0] != NULL) && (node->child[1] != NULL))) {
+        return;
+    }
+    *link = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+    _free(trie, node);
+}
+
+void fib_trie_reset(fib_table_t *table)
+{
+    fib_trie_t *trie = &table->trie;
+
+    trie->root = NULL;
+    trie->free = NULL;
+    for (size_t i = 0; i < trie->nodes_numof; i++) {
+        _free(trie, &trie->nodes[i]);
+    }
+}
+
+int fib_trie_add(fib_table_t *table, fib_entry_t *entry)
+{
+    fib_trie_t *trie = &table->trie;
+    const uint8_t *key = entry->global->address;
+    unsigned prefix_len = _prefix_len(entry);
+    fib_trie_node_t **link = &trie->root;
+    unsigned matched = 0;
+
+    while (*link != NULL) {
+        fib_trie_node_t *node = *link;
+        unsigned max = (node->prefix_len < prefix_len) ? node->prefix_len
+                                                       : prefix_len;
+        unsigned common = _common_bits(node->key, key, matched, max);
+
+        if (common == node->prefix_len) {
+            if (node->prefix_len == prefix_len) {
+                if (node->entry == NULL) {
+                    node->entry = entry;
+                    return 0;
+                }
+                /* same prefix, but different address bits beyond it */
+                fib_trie_node_t *dup = _alloc(trie, key, prefix_len, entry);
+
+                if (dup == NULL) {
+                    return -ENOMEM;
+                }
+                dup->dup = node->dup;
+                node->dup = dup;
+                return 0;
+            }
+            matched = common;
+            link = &node->child[_bit(key, node->prefix_len)];
+            continue;
+        }
+
+        fib_trie_node_t *leaf = _alloc(trie, key, prefix_len, entry);
+
+        if (leaf == NULL) {
+            return -ENOMEM;
+        }
+        if (common == prefix_len) {
+            /* the new prefix covers the node's prefix */
+            leaf->child[_bit(node->key, prefix_len)] = node;
+            *link = leaf;
+            return 0;
+        }
+        /* the prefixes diverge at bit `common` */
+        fib_trie_node_t *branch = _alloc(trie, key, common, NULL);
+
+        if (branch == NULL) {
+            _free(trie, leaf);
+            return -ENOMEM;
+        }
+        unsigned bit = _bit(key, common);
+
+        branch->child[bit] = leaf;
+        branch->child[!bit] = node;
+        *link = branch;
+        return 0;
+    }
+    *link = _alloc(trie, key, prefix_len, entry);
+    return (*link != NULL) ? 0 : -ENOMEM;
+}
+
+void fib_trie_remove(fib_table_t *table, fib_entry_t *entry)
+{
+    fib_trie_t *trie = &table->trie;
+    const uint8_t *key = entry->global->address;
+    unsigned prefix_len = _prefix_len(entry);
+    fib_trie_node_t **parent_link = NULL;
+    fib_trie_node_t **link = &trie->root;
+    fib_trie_node_t *node;
+
+    while ((*link != NULL) && ((*link)->prefix_len < prefix_len)) {
+        parent_link = link;
+        link = &(*link)->child[_bit(key, (*link)->prefix_len)];
+    }
+    node = *link;
+    if ((node == NULL) || (node->prefix_len != prefix_len)) {
+        DEBUG("[fib_trie] entry %p not found\n", (void *)entry);
+        return;
+    }
+    for (fib_trie_node_t **dup = &node->dup; *dup != NULL;
+         dup = &(*dup)->dup) {
+        if ((*dup)->entry == entry) {
+            fib_trie_node_t *tmp = *dup;
+
+            *dup = tmp->dup;
+            _free(trie, tmp);
+            return;
+        }
+    }
+    if (node->entry != entry) {
+        DEBUG("[fib_trie] entry %p not found\n", (void *)entry);
+        return;
+    }
+    if (node->dup != NULL) {
+        fib_trie_node_t *tmp = node->dup;
+
+        node->entry = tmp->entry;
+        node->dup = tmp->dup;
+        _free(trie, tmp);
+        return;
+    }
+    node->entry = NULL;
+    _compress(trie, link);
+    if (parent_link != NULL) {
+        _compress(trie, parent_link);
+    }
+}
+
+int fib_trie_find(fib_table_t *table, const uint8_t *dst, size_t dst_size,
+                  fib_entry_t **entry)
+{
+    const unsigned dst_len = dst_size << 3;
+    fib_trie_node_t *node = table->trie.root;
+    fib_entry_t *best = NULL;
+    unsigned matched = 0;
+
+    while ((node != NULL) && (node->prefix_len <= dst_len) &&
+           (_common_bits(node->key, dst, matched,
+                         node->prefix_len) == node->prefix_len)) {
+        for (fib_trie_node_t *n = node; n != NULL; n = n->dup) {
+            fib_entry_t *e = n->entry;
+
+            if ((e == NULL) || (e->global->address_size != dst_size)) {
+                continue;
+            }
+            if (memcmp(e->global->address, dst, dst_size) == 0) {
+                *entry = e;
+                return 1;
+            }
+            /* deeper nodes have longer prefixes, so they overrule this */
+            if ((n->prefix_len == 0) ||
+                (e->global_flags & FIB_FLAG_NET_PREFIX_MASK)) {
+                best = e;
+            }
+        }
+        if (node->prefix_len == dst_len) {
+            break;
+        }
+        matched = node->prefix_len;
+        node = node->child[_bit(dst, node->prefix_len)];
+    }
+    if (best == NULL) {
+        return -EHOSTUNREACH;
+    }
+    *entry = best;
+    return 0;
+}
+
+#else
+typedef int dont_be_pedantic;
+#endif /* MODULE_FIB_TRIE */
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_fib
+ * @internal
+ * @{
+ *
+ * @file
+ * @brief       Longest-prefix-match trie over FIB single hop entries
+ *
+ * A path-compressed binary trie. Every node carries the prefix it stands for,
+ * so a lookup follows the bits of the destination address and stops at the
+ * first node whose prefix does not match. Entries of the table are hooked
+ * into the node for their prefix (the net prefix length from the entry's
+ * global flags, the full address length otherwise, 0 for the all-zero
+ * default route).
+ *
+ * All functions require fib_table_t::mtx_access to be held.
+ */
+#ifndef FIB_TRIE_H
+#define FIB_TRIE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "net/fib/table.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Empties the trie and puts all nodes into the free list
+ *
+ * @param[in] table     the FIB table
+ */
+void fib_trie_reset(fib_table_t *table);
+
+/**
+ * @brief Adds an entry to the trie
+ *
+ * @param[in] table     the FIB table
+ * @param[in] entry     an entry of @p table with fib_entry_t::global set
+ *
+ * @return 0 on success
+ *         -ENOMEM if the node pool is exhausted
+ */
+int fib_trie_add(fib_table_t *table, fib_entry_t *entry);
+
+/**
+ * @brief Removes an entry from the trie
+ *
+ * @param[in] table     the FIB table
+ * @param[in] entry     an entry of @p table, still with fib_entry_t::global set
+ */
+void fib_trie_remove(fib_table_t *table, fib_entry_t *entry);
+
+/**
+ * @brief Looks up the entry for a destination
+ *
+ * @param[in] table     the FIB table
+ * @param[in] dst       the destination address
+ * @param[in] dst_size  the destination address size
+ * @param[out] entry    the found entry
+ *
+ * @return 1 if an entry with exactly @p dst was found
+ *         0 if the entry with the longest matching prefix or a default route
+ *           was found
+ *         -EHOSTUNREACH if no entry matches
+ */
+int fib_trie_find(fib_table_t *table, const uint8_t *dst, size_t dst_size,
+                  fib_entry_t **entry);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FIB_TRIE_H */
+/** @} */
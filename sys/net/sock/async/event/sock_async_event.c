@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+
+#include "irq.h"
+#include "net/sock/async_event.h"
+
+static void _event_handler(event_t *ev)
+{
+    sock_event_t *event = (sock_event_t *)ev;
+    unsigned state = irq_disable();
+    unsigned type = event->type;
+
+    event->type = 0;
+    irq_restore(state);
+    if (type) {
+        event->cb.generic(event->sock, type, event->cb_arg);
+    }
+}
+
+static inline void _cb(sock_async_flags_t type, void *ctx_arg)
+{
+    sock_async_ctx_t *ctx = ctx_arg;
+    unsigned state = irq_disable();
+
+    /* events coalesce until the handler ran */
+    ctx->event.type |= type;
+    irq_restore(state);
+    event_post(ctx->queue, &ctx->event.super);
+}
+
+static void _set_ctx(sock_async_ctx_t *ctx, void *sock, event_queue_t *ev_queue,
+                     void *handler_arg)
+{
+    ctx->event.super.handler = _event_handler;
+    ctx->event.sock = sock;
+    ctx->event.cb_arg = handler_arg;
+    ctx->event.type = 0;
+    ctx->queue = ev_queue;
+}
+
+#ifdef MODULE_SOCK_IP
+static void _ip_cb(sock_ip_t *sock, sock_async_flags_t type, void *arg)
+{
+    (void)sock;
+    _cb(type, arg);
+}
+
+void sock_ip_event_init(sock_ip_t *sock, event_queue_t *ev_queue,
+                        sock_ip_cb_t handler, void *handler_arg)
+{
+    sock_async_ctx_t *ctx = sock_ip_get_async_ctx(sock);
+
+    assert((ev_queue != NULL) && (handler != NULL));
+    _set_ctx(ctx, sock, ev_queue, handler_arg);
+    ctx->event.cb.ip = handler;
+    sock_ip_set_cb(sock, _ip_cb, ctx);
+}
+#endif /* MODULE_SOCK_IP */
+
+#ifdef MODULE_SOCK_UDP
+static void _udp_cb(sock_udp_t *sock, sock_async_flags_t type, void *arg)
+{
+    (void)sock;
+    _cb(type, arg);
+}
+
+void sock_udp_event_init(sock_udp_t *sock, event_queue_t *ev_queue,
+                         sock_udp_cb_t handler, void *handler_arg)
+{
+    sock_async_ctx_t *ctx = sock_udp_get_async_ctx(sock);
+
+    assert((ev_queue != NULL) && (handler != NULL));
+    _set_ctx(ctx, sock, ev_queue, handler_arg);
+    ctx->event.cb.udp = handler;
+    sock_udp_set_cb(sock, _udp_cb, ctx);
+}
+#endif /* MODULE_SOCK_UDP */
+
+/** @} */
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    posix_poll POSIX poll() and select()
+ * @ingroup     posix
+ * @brief       Synchronous I/O multiplexing over VFS file descriptors
+ *
+ * To activate, use `USEMODULE += posix_poll` in your application's Makefile.
+ *
+ * Readiness is queried with vfs_poll(). Sockets of @ref posix_sockets wake
+ * the waiting thread from their sock callbacks (see @ref net_sock_async), so
+ * a single thread can wait on many sockets without polling. Only datagram
+ * and raw sockets on GNRC are supported this way, other sockets and files
+ * without a vfs_file_ops::poll operation are always reported as ready.
+ *
+ * @note    Only one thread may wait on a file descriptor at a time. poll() and
+ *          select() fail with `EBUSY` if another thread already waits on one
+ *          of the given descriptors. Calls with a timeout of 0 do not wait, so
+ *          they always succeed.
+ *
+ * @{
+ *
+ * @file
+ * @brief   POSIX compatible poll.h definitions
+ *
+ * @see http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/poll.h.html
+ */
+
+#ifndef DOXYGEN
+#ifdef CPU_NATIVE
+/* If building on native we need to use the system header instead */
+#pragma GCC system_header
+/* without the GCC pragma above #include_next will trigger a pedantic error */
+#include_next <poll.h>
+#else
+#ifndef POLL_H
+#define POLL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define POLLIN      0x0001  /* Data other than high-priority data may be read */
+#define POLLPRI     0x0002  /* High-priority data may be read */
+#define POLLOUT     0x0004  /* Normal data may be written */
+#define POLLERR     0x0008  /* An error has occurred (revents only) */
+#define POLLHUP     0x0010  /* Device has been disconnected (revents only) */
+#define POLLNVAL    0x0020  /* Invalid fd member (revents only) */
+#define POLLRDNORM  POLLIN  /* Normal data may be read */
+#define POLLWRNORM  POLLOUT /* Equivalent to POLLOUT */
+
+typedef unsigned int nfds_t;
+
+struct pollfd {
+    int fd;                 /* The following descriptor being polled */
+    short events;           /* The input event flags */
+    short revents;          /* The output event flags */
+};
+
+int poll(struct pollfd fds[], nfds_t nfds, int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POLL_H */
+
+#endif /* CPU_NATIVE */
+
+#endif /* DOXYGEN */
+/** @} */
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @file
+ * @ingroup posix_poll
+ * @brief   POSIX compatible sys/select.h definitions
+ *
+ * @see http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/sys_select.h.html
+ */
+
+#ifndef DOXYGEN
+#if defined(CPU_NATIVE) || MODULE_NEWLIB
+/* If building on native or newlib we need to use the system header instead */
+#pragma GCC system_header
+/* without the GCC pragma above #include_next will trigger a pedantic error */
+#include_next <sys/select.h>
+#else
+#ifndef SYS_SELECT_H
+#define SYS_SELECT_H
+
+#include <string.h>
+#include <sys/time.h> /* for struct timeval */
+
+#include "bitfield.h"
+#include "vfs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FD_SETSIZE  VFS_MAX_OPEN_FILES
+
+typedef struct {
+    BITFIELD(fds, FD_SETSIZE);
+} fd_set;
+
+#define FD_CLR(fd, set)     bf_unset((set)->fds, (fd))
+#define FD_ISSET(fd, set)   bf_isset((set)->fds, (fd))
+#define FD_SET(fd, set)     bf_set((set)->fds, (fd))
+#define FD_ZERO(set)        memset((set), 0, sizeof(fd_set))
+
+int select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds,
+           struct timeval *timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SYS_SELECT_H */
+
+#endif /* CPU_NATIVE || MODULE_NEWLIB */
+
+#endif /* DOXYGEN */
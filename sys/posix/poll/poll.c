@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   poll() implementation on top of vfs_poll()
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <poll.h>
+
+#include "thread.h"
+#include "thread_flags.h"
+#include "vfs.h"
+#include "xtimer.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#define _WAIT_FLAGS     (VFS_POLL_THREAD_FLAG | THREAD_FLAG_TIMEOUT)
+
+static unsigned _events_to_vfs(short events)
+{
+    unsigned res = 0;
+
+    if (events & POLLIN) {
+        res |= VFS_POLLIN;
+    }
+    if (events & POLLOUT) {
+        res |= VFS_POLLOUT;
+    }
+    return res;
+}
+
+static short _events_from_vfs(unsigned events)
+{
+    short res = 0;
+
+    if (events & VFS_POLLIN) {
+        res |= POLLIN;
+    }
+    if (events & VFS_POLLOUT) {
+        res |= POLLOUT;
+    }
+    if (events & VFS_POLLERR) {
+        res |= POLLERR;
+    }
+    if (events & VFS_POLLHUP) {
+        res |= POLLHUP;
+    }
+    return res;
+}
+
+static int _scan(struct pollfd fds[], nfds_t nfds, kernel_pid_t waiter)
+{
+    int count = 0;
+
+    for (nfds_t i = 0; i < nfds; i++) {
+        int res;
+
+        fds[i].revents = 0;
+        if (fds[i].fd < 0) {
+            continue;
+        }
+        res = vfs_poll(fds[i].fd, _events_to_vfs(fds[i].events), waiter);
+        if (res == -EBUSY) {
+            /* another thread already waits on this file */
+            return -1;
+        }
+        if (res < 0) {
+            fds[i].revents = POLLNVAL;
+        }
+        else {
+            fds[i].revents = _events_from_vfs(res);
+        }
+        if (fds[i].revents != 0) {
+            count++;
+        }
+    }
+    return count;
+}
+
+int poll(struct pollfd fds[], nfds_t nfds, int timeout)
+{
+    kernel_pid_t waiter = KERNEL_PID_UNDEF;
+    xtimer_t timer;
+    int count;
+
+    if ((fds == NULL) && (nfds > 0)) {
+        errno = EFAULT;
+        return -1;
+    }
+    if (timeout != 0) {
+        waiter = thread_getpid();
+        thread_flags_clear(_WAIT_FLAGS);
+    }
+    if (timeout > 0) {
+        uint32_t timeout_us = UINT32_MAX;
+
+        /* xtimer_set_timeout_flag() only takes 32-bit microseconds, so
+         * longer timeouts are cut to ~71 minutes */
+        if ((unsigned)timeout < (UINT32_MAX / US_PER_MS)) {
+            timeout_us = (uint32_t)timeout * US_PER_MS;
+        }
+        xtimer_set_timeout_flag(&timer, timeout_us);
+    }
+    /* the flag is set on any change of readiness after registration, so
+     * the thread is only woken up if it has to scan again */
+    while (((count = _scan(fds, nfds, waiter)) == 0) &&
+           (waiter != KERNEL_PID_UNDEF)) {
+        if (thread_flags_wait_any(_WAIT_FLAGS) & THREAD_FLAG_TIMEOUT) {
+            DEBUG("poll: timeout\n");
+            /* unregister with the final scan */
+            waiter = KERNEL_PID_UNDEF;
+        }
+    }
+    if (timeout != 0) {
+        /* also on failure: files only unregister the thread registered on them */
+        if (waiter != KERNEL_PID_UNDEF) {
+            for (nfds_t i = 0; i < nfds; i++) {
+                if (fds[i].fd >= 0) {
+                    vfs_poll(fds[i].fd, 0, KERNEL_PID_UNDEF);
+                }
+            }
+        }
+        if (timeout > 0) {
+            xtimer_remove(&timer);
+        }
+        thread_flags_clear(_WAIT_FLAGS);
+    }
+    if (count < 0) {
+        errno = EBUSY;
+    }
+    return count;
+}
+
+/** @} */
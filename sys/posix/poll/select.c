@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   select() implementation on top of poll()
+ */
+
+#include <errno.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <poll.h>
+#include <sys/select.h>
+
+#include "vfs.h"
+
+#define _READ_EVENTS    (POLLIN | POLLHUP | POLLERR)
+#define _WRITE_EVENTS   (POLLOUT | POLLERR)
+
+static inline bool _isset(int fd, fd_set *set)
+{
+    return (set != NULL) && FD_ISSET(fd, set);
+}
+
+static int _to_ms(const struct timeval *tv)
+{
+    if ((tv->tv_sec < 0) || (tv->tv_usec < 0) || (tv->tv_usec >= 1000000L)) {
+        return -1;
+    }
+    if (tv->tv_sec >= (INT_MAX / 1000) - 1) {
+        return INT_MAX;
+    }
+    /* round up, so select() does not return before the timeout expired */
+    return (int)tv->tv_sec * 1000 + (int)((tv->tv_usec + 999) / 1000);
+}
+
+int select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds,
+           struct timeval *timeout)
+{
+    struct pollfd fds[VFS_MAX_OPEN_FILES];
+    nfds_t numof = 0;
+    int poll_timeout = -1;
+    int res;
+
+    if ((nfds < 0) || (nfds > FD_SETSIZE)) {
+        errno = EINVAL;
+        return -1;
+    }
+    if (timeout != NULL) {
+        if ((poll_timeout = _to_ms(timeout)) < 0) {
+            errno = EINVAL;
+            return -1;
+        }
+    }
+    for (int fd = 0; fd < nfds; fd++) {
+        short events = 0;
+
+        if (!_isset(fd, readfds) && !_isset(fd, writefds) &&
+            !_isset(fd, errorfds)) {
+            continue;
+        }
+        if (fd >= VFS_MAX_OPEN_FILES) {
+            errno = EBADF;
+            return -1;
+        }
+        if (_isset(fd, readfds)) {
+            events |= POLLIN;
+        }
+        if (_isset(fd, writefds)) {
+            events |= POLLOUT;
+        }
+        fds[numof].fd = fd;
+        fds[numof].events = events;
+        numof++;
+    }
+    if (poll(fds, numof, poll_timeout) < 0) {
+        return -1;
+    }
+    /* the sets must be left untouched on error */
+    for (nfds_t i = 0; i < numof; i++) {
+        if (fds[i].revents & POLLNVAL) {
+            errno = EBADF;
+            return -1;
+        }
+    }
+    res = 0;
+    for (nfds_t i = 0; i < numof; i++) {
+        int fd = fds[i].fd;
+        short revents = fds[i].revents;
+
+        if (_isset(fd, readfds) && !(revents & _READ_EVENTS)) {
+            FD_CLR(fd, readfds);
+        }
+        else if (_isset(fd, readfds)) {
+            res++;
+        }
+        if (_isset(fd, writefds) && !(revents & _WRITE_EVENTS)) {
+            FD_CLR(fd, writefds);
+        }
+        else if (_isset(fd, writefds)) {
+            res++;
+        }
+        if (_isset(fd, errorfds) && !(revents & POLLERR)) {
+            FD_CLR(fd, errorfds);
+        }
+        else if (_isset(fd, errorfds)) {
+            res++;
+        }
+    }
+    return res;
+}
+
+/** @} */
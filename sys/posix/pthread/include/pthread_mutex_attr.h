@@ -58,7 +58,9 @@ extern "C" {
  * @brief           If a thread attempts to acquire a held lock,
  *                  the holding thread gets its dynamic priority increased up to
  *                  the priority of the blocked thread
- * @note            Not implemented, yet.
+ * @note            Only supported with module `core_mutex_priority_inheritance`,
+ *                  which makes all mutexes inherit priorities regardless of
+ *                  the protocol attribute.
  */
 #define PTHREAD_PRIO_NONE        0
 #define PTHREAD_PRIO_INHERIT     1
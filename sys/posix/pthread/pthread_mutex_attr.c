@@ -115,10 +115,17 @@ int pthread_mutexattr_setprotocol(pthread_mutexattr_t *attr, int protocol)
         return EINVAL;
     }
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    /* all mutexes inherit priorities with this module */
+    if (protocol == PTHREAD_PRIO_PROTECT) {
+        return EINVAL;
+    }
+#else
     if (protocol != PTHREAD_PRIO_NONE) {
-        /* priority inheritance is not supported, yet */
+        /* priority inheritance needs core_mutex_priority_inheritance */
         return EINVAL;
     }
+#endif
 
     attr->protocol = protocol;
     return 0;
@@ -28,6 +28,14 @@
 #include "net/ipv6/addr.h"
 #include "random.h"
 #include "vfs.h"
+#if defined(MODULE_POSIX_POLL) && defined(MODULE_SOCK_ASYNC)
+#include "irq.h"
+#include "thread_flags.h"
+#include "net/sock/async.h"
+
+/* datagrams are counted by sock callbacks, so poll() can wait for them */
+#define POSIX_POLL_ASYNC
+#endif
 
 #include "sys/socket.h"
 #include "netinet/in.h"
@@ -79,6 +87,10 @@ typedef struct {
     unsigned queue_array_len;
 #endif
     sock_tcp_ep_t local;        /* to store bind before connect/listen */
+#ifdef POSIX_POLL_ASYNC
+    kernel_pid_t waiter;        /* thread waiting in poll() */
+    unsigned recv_pending;      /* received datagrams not yet read */
+#endif
 } socket_t;
 
 static socket_t _socket_pool[_ACTUAL_SOCKET_POOL_SIZE];
@@ -244,6 +256,96 @@ static int _sockaddr_to_ep(const struct sockaddr *address, socklen_t address_len
     return 0;
 }
 
+#ifdef POSIX_POLL_ASYNC
+static void _async_cb(socket_t *s, sock_async_flags_t flags)
+{
+    kernel_pid_t waiter;
+
+    if (flags & SOCK_ASYNC_MSG_RECV) {
+        unsigned state = irq_disable();
+        s->recv_pending++;
+        irq_restore(state);
+    }
+    waiter = s->waiter;
+    if (waiter != KERNEL_PID_UNDEF) {
+        thread_t *thread = (thread_t *)thread_get(waiter);
+
+        if (thread != NULL) {
+            thread_flags_set(thread, VFS_POLL_THREAD_FLAG);
+        }
+    }
+}
+
+#ifdef MODULE_SOCK_IP
+static void _ip_cb(sock_ip_t *sock, sock_async_flags_t flags, void *arg)
+{
+    (void)sock;
+    _async_cb(arg, flags);
+}
+#endif
+
+#ifdef MODULE_SOCK_UDP
+static void _udp_cb(sock_udp_t *sock, sock_async_flags_t flags, void *arg)
+{
+    (void)sock;
+    _async_cb(arg, flags);
+}
+#endif
+
+#if defined(MODULE_SOCK_IP) || defined(MODULE_SOCK_UDP)
+static void _recv_done(socket_t *s, int res)
+{
+    /* these errors are returned before a datagram was taken from the sock */
+    if ((res != -EAGAIN) && (res != -ETIMEDOUT) && (res != -EADDRNOTAVAIL)) {
+        unsigned state = irq_disable();
+        if (s->recv_pending > 0) {
+            s->recv_pending--;
+        }
+        irq_restore(state);
+    }
+}
+#endif
+#endif /* POSIX_POLL_ASYNC */
+
+#ifdef MODULE_POSIX_POLL
+static int socket_poll(vfs_file_t *filp, unsigned events, kernel_pid_t waiter)
+{
+    socket_t *s = filp->private_data.ptr;
+    unsigned revents = events & VFS_POLLOUT;
+
+#ifdef POSIX_POLL_ASYNC
+    if ((s->type == SOCK_RAW) || (s->type == SOCK_DGRAM)) {
+        /* register first so no datagram received in between is missed */
+        unsigned state = irq_disable();
+        if (waiter == KERNEL_PID_UNDEF) {
+            /* only the registered thread may unregister */
+            if (s->waiter == thread_getpid()) {
+                s->waiter = KERNEL_PID_UNDEF;
+            }
+        }
+        else if ((s->waiter != KERNEL_PID_UNDEF) && (s->waiter != waiter)) {
+            irq_restore(state);
+            return -EBUSY;
+        }
+        else {
+            s->waiter = waiter;
+        }
+        irq_restore(state);
+        if ((events & VFS_POLLIN) && (s->recv_pending > 0)) {
+            revents |= VFS_POLLIN;
+        }
+        return revents;
+    }
+#else
+    (void)s;
+#endif
+    (void)waiter;
+    /* no asynchronous notification available, so the socket is reported as
+     * ready like a regular file */
+    return revents | (events & VFS_POLLIN);
+}
+#endif
+
 static int socket_close(vfs_file_t *filp)
 {
     socket_t *s = filp->private_data.ptr;
@@ -323,6 +425,9 @@ static const vfs_file_ops_t socket_ops = {
     .lseek = socket_lseek,
     .read = socket_read,
     .write = socket_write,
+#ifdef MODULE_POSIX_POLL
+    .poll = socket_poll,
+#endif
 };
 
 int socket(int domain, int type, int protocol)
@@ -361,6 +466,10 @@ int socket(int domain, int type, int protocol)
             }
             s->bound = false;
             s->sock = NULL;
+#ifdef POSIX_POLL_ASYNC
+            s->waiter = KERNEL_PID_UNDEF;
+            s->recv_pending = 0;
+#endif
 #ifdef POSIX_SETSOCKOPT
             s->recv_timeout = SOCK_NO_TIMEOUT;
 #endif
@@ -560,6 +669,11 @@ static int _bind_connect(socket_t *s, const struct sockaddr *address,
             /* TODO apply flags if possible */
             res = sock_ip_create(&sock->raw, (sock_ip_ep_t *)local,
                                  (sock_ip_ep_t *)remote, s->protocol, 0);
+#ifdef POSIX_POLL_ASYNC
+            if (res == 0) {
+                sock_ip_set_cb(&sock->raw, _ip_cb, s);
+            }
+#endif
             break;
 #endif
 #ifdef MODULE_SOCK_TCP
@@ -574,6 +688,11 @@ static int _bind_connect(socket_t *s, const struct sockaddr *address,
         case SOCK_DGRAM:
             /* TODO apply flags if possible */
             res = sock_udp_create(&sock->udp, local, remote, 0);
+#ifdef POSIX_POLL_ASYNC
+            if (res == 0) {
+                sock_udp_set_cb(&sock->udp, _udp_cb, s);
+            }
+#endif
             break;
 #endif
         default:
@@ -842,6 +961,9 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
         case SOCK_RAW:
             res = sock_ip_recv(&s->sock->raw, buffer, length, recv_timeout,
                                (sock_ip_ep_t *)&ep);
+#ifdef POSIX_POLL_ASYNC
+            _recv_done(s, res);
+#endif
             break;
 #endif
 #ifdef MODULE_SOCK_TCP
@@ -854,6 +976,9 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
         case SOCK_DGRAM:
             res = sock_udp_recv(&s->sock->udp, buffer, length, recv_timeout,
                                 &ep);
+#ifdef POSIX_POLL_ASYNC
+            _recv_done(s, res);
+#endif
             break;
 #endif
         default:
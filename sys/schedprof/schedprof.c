@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_schedprof
+ * @{
+ *
+ * @file
+ * @brief       Scheduler profiling implementation
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "fmt.h"
+#include "irq.h"
+#include "sched.h"
+#include "schedprof.h"
+
+schedprof_t schedprof_threads[KERNEL_PID_LAST + 1];
+
+static unsigned _log2(uint32_t v)
+{
+    unsigned res = 0;
+
+    /* bitarithm_msb() only works on unsigned, which may be 16 bit wide */
+    if (v >> 16) {
+        res = 16;
+        v >>= 16;
+    }
+    if (v) {
+        res += bitarithm_msb((unsigned)v);
+    }
+    return res;
+}
+
+static inline void _hist_add(uint16_t *hist, uint32_t v)
+{
+    unsigned bucket = _log2(v);
+
+    if (bucket >= SCHEDPROF_HIST_NUMOF) {
+        bucket = SCHEDPROF_HIST_NUMOF - 1;
+    }
+    if (hist[bucket] < UINT16_MAX) {
+        hist[bucket]++;
+    }
+}
+
+void schedprof_init(void)
+{
+#ifdef DWT_CTRL_CYCCNTENA_Msk
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    schedprof_reset();
+}
+
+void schedprof_reset(void)
+{
+    unsigned state = irq_disable();
+    uint32_t now = schedprof_now();
+
+    memset(schedprof_threads, 0, sizeof(schedprof_threads));
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        schedprof_threads[i].last_start = now;
+        schedprof_threads[i].ready_since = now;
+    }
+    irq_restore(state);
+}
+
+void schedprof_get(kernel_pid_t pid, schedprof_t *out)
+{
+    unsigned state = irq_disable();
+
+    *out = schedprof_threads[pid];
+    irq_restore(state);
+}
+
+void schedprof_switch(thread_t *prev, thread_t *next)
+{
+    uint32_t now = schedprof_now();
+
+    if (prev) {
+        schedprof_t *stat = &schedprof_threads[prev->pid];
+        uint32_t run = now - stat->last_start;
+
+        stat->runtime += run;
+        if (run > stat->run_max) {
+            stat->run_max = run;
+        }
+        _hist_add(stat->run_hist, run);
+        if (prev->status >= STATUS_ON_RUNQUEUE) {
+            /* switched out while still runnable, so it is waiting again */
+            stat->preemptions++;
+            stat->ready_since = now;
+        }
+    }
+
+    schedprof_t *stat = &schedprof_threads[next->pid];
+    uint32_t wait = now - stat->ready_since;
+
+    stat->last_start = now;
+    stat->switches++;
+    if (wait > stat->wait_max) {
+        stat->wait_max = wait;
+    }
+    _hist_add(stat->wait_hist, wait);
+}
+
+static void _print_u64(uint64_t val)
+{
+    char buf[21];
+
+    buf[fmt_u64_dec(buf, val)] = '\0';
+    printf("%s", buf);
+}
+
+void schedprof_print(void)
+{
+    uint64_t rt_sum = 0;
+    schedprof_t stat;
+
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        if (sched_threads[i] != NULL) {
+            schedprof_get(i, &stat);
+            rt_sum += stat.runtime;
+        }
+    }
+    if (rt_sum == 0) {
+        rt_sum = 1;
+    }
+
+    printf("clock: %lu Hz\n", (unsigned long)SCHEDPROF_CLOCK_HZ);
+    printf("\tpid | %-20s | runtime  | switches | preempt  |   run max  |"
+           "  wait max\n", "name");
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        const char *name;
+
+        if (sched_threads[i] == NULL) {
+            continue;
+        }
+        schedprof_get(i, &stat);
+        name = thread_getname(i);
+        /* multiply with 100 for percentage and to avoid floats/doubles */
+        uint64_t runtime = stat.runtime * 100;
+        unsigned runtime_major = runtime / rt_sum;
+        unsigned runtime_minor = ((runtime % rt_sum) * 1000) / rt_sum;
+
+        printf("\t%3" PRIkernel_pid " | %-20s | %2u.%03u%% | %8lu | %8lu |"
+               " %10lu | %10lu\n",
+               i, (name) ? name : "-", runtime_major, runtime_minor,
+               (unsigned long)stat.switches, (unsigned long)stat.preemptions,
+               (unsigned long)stat.run_max, (unsigned long)stat.wait_max);
+    }
+}
+
+static void _dump_hist(const char *key, const uint16_t *hist)
+{
+    printf(",\"%s\":[", key);
+    for (unsigned i = 0; i < SCHEDPROF_HIST_NUMOF; i++) {
+        printf("%s%u", (i) ? "," : "", (unsigned)hist[i]);
+    }
+    printf("]");
+}
+
+void schedprof_dump(void)
+{
+    schedprof_t stat;
+
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        const char *name;
+
+        if (sched_threads[i] == NULL) {
+            continue;
+        }
+        schedprof_get(i, &stat);
+        name = thread_getname(i);
+        printf("{\"pid\":%" PRIkernel_pid ",\"name\":\"%s\",\"hz\":%lu,"
+               "\"runtime\":", i, (name) ? name : "",
+               (unsigned long)SCHEDPROF_CLOCK_HZ);
+        _print_u64(stat.runtime);
+        printf(",\"switches\":%lu,\"preemptions\":%lu,\"run_max\":%lu,"
+               "\"wait_max\":%lu",
+               (unsigned long)stat.switches, (unsigned long)stat.preemptions,
+               (unsigned long)stat.run_max, (unsigned long)stat.wait_max);
+        _dump_hist("run_hist", stat.run_hist);
+        _dump_hist("wait_hist", stat.wait_hist);
+        puts("}");
+    }
+}
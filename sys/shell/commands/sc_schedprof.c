@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command for the scheduler profiling module
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "schedprof.h"
+
+int _schedprof_handler(int argc, char **argv)
+{
+    if (argc < 2) {
+        schedprof_print();
+    }
+    else if (strcmp(argv[1], "dump") == 0) {
+        schedprof_dump();
+    }
+    else if (strcmp(argv[1], "reset") == 0) {
+        schedprof_reset();
+    }
+    else {
+        printf("usage: %s [dump|reset]\n", argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
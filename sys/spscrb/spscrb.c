@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup sys_spscrb
+ * @{
+ * @file
+ * @brief       Single-producer single-consumer ringbuffer implementation
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "spscrb.h"
+
+static inline uint8_t *_elem(const spscrb_t *rb, unsigned cnt)
+{
+    return rb->buf + ((cnt & (rb->size - 1)) * rb->elem_size);
+}
+
+/* number of elements from cnt to the end of the buffer */
+static inline unsigned _to_end(const spscrb_t *rb, unsigned cnt)
+{
+    return rb->size - (cnt & (rb->size - 1));
+}
+
+unsigned spscrb_put(spscrb_t *rb, const void *src, unsigned n)
+{
+    unsigned writes = rb->writes;
+    unsigned space = rb->size - (writes - _spscrb_load(&rb->reads));
+    unsigned first;
+
+    if (n > space) {
+        n = space;
+    }
+    first = _to_end(rb, writes);
+    if (first > n) {
+        first = n;
+    }
+    memcpy(_elem(rb, writes), src, first * rb->elem_size);
+    memcpy(rb->buf, (const uint8_t *)src + (first * rb->elem_size),
+           (n - first) * rb->elem_size);
+    _spscrb_store(&rb->writes, writes + n);
+    return n;
+}
+
+unsigned spscrb_get(spscrb_t *rb, void *dst, unsigned n)
+{
+    unsigned reads = rb->reads;
+    unsigned avail = _spscrb_load(&rb->writes) - reads;
+    unsigned first;
+
+    if (n > avail) {
+        n = avail;
+    }
+    first = _to_end(rb, reads);
+    if (first > n) {
+        first = n;
+    }
+    memcpy(dst, _elem(rb, reads), first * rb->elem_size);
+    memcpy((uint8_t *)dst + (first * rb->elem_size), rb->buf,
+           (n - first) * rb->elem_size);
+    _spscrb_store(&rb->reads, reads + n);
+    return n;
+}
+
+unsigned spscrb_drop(spscrb_t *rb, unsigned n)
+{
+    unsigned reads = rb->reads;
+    unsigned avail = _spscrb_load(&rb->writes) - reads;
+
+    if (n > avail) {
+        n = avail;
+    }
+    _spscrb_store(&rb->reads, reads + n);
+    return n;
+}
+
+void *spscrb_peek_write(spscrb_t *rb, unsigned *n)
+{
+    unsigned writes = rb->writes;
+    unsigned space = rb->size - (writes - _spscrb_load(&rb->reads));
+    unsigned first = _to_end(rb, writes);
+
+    *n = (first < space) ? first : space;
+    return (*n) ? _elem(rb, writes) : NULL;
+}
+
+const void *spscrb_peek_read(spscrb_t *rb, unsigned *n)
+{
+    unsigned reads = rb->reads;
+    unsigned avail = _spscrb_load(&rb->writes) - reads;
+    unsigned first = _to_end(rb, reads);
+
+    *n = (first < avail) ? first : avail;
+    return (*n) ? _elem(rb, reads) : NULL;
+}
@@ -333,6 +333,21 @@ ssize_t vfs_write(int fd, const void *src, size_t count)
     return filp->f_op->write(filp, src, count);
 }
 
+int vfs_poll(int fd, unsigned events, kernel_pid_t waiter)
+{
+    DEBUG_NOT_STDOUT(fd, "vfs_poll: %d, 0x%x, %d\n", fd, events, (int)waiter);
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    vfs_file_t *filp = &_vfs_open_files[fd];
+    if (filp->f_op->poll == NULL) {
+        /* driver does not implement poll(), treat it like a regular file */
+        return events & (VFS_POLLIN | VFS_POLLOUT);
+    }
+    return filp->f_op->poll(filp, events, waiter);
+}
+
 int vfs_opendir(vfs_DIR *dirp, const char *dirname)
 {
     DEBUG("vfs_opendir: %p, \"%s\"\n", (void *)dirp, dirname);
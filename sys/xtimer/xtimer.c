@@ -191,48 +191,6 @@ void xtimer_now_timex(timex_t *out)
     out->microseconds = now - (out->seconds * US_PER_SEC);
 }
 
-/* Prepares the message to trigger the timeout.
- * Additionally, the xtimer_t struct gets initialized.
- */
-static void _setup_timer_msg(msg_t *m, xtimer_t *t)
-{
-    m->type = MSG_XTIMER;
-    m->content.ptr = m;
-
-    t->target = t->long_target = 0;
-}
-
-/* Waits for incoming message or timeout. */
-static int _msg_wait(msg_t *m, msg_t *tmsg, xtimer_t *t)
-{
-    msg_receive(m);
-    if (m->type == MSG_XTIMER && m->content.ptr == tmsg) {
-        /* we hit the timeout */
-        return -1;
-    }
-    else {
-        xtimer_remove(t);
-        return 1;
-    }
-}
-
-int _xtimer_msg_receive_timeout64(msg_t *m, uint64_t timeout_ticks) {
-    msg_t tmsg;
-    xtimer_t t;
-    _setup_timer_msg(&tmsg, &t);
-    _xtimer_set_msg64(&t, timeout_ticks, &tmsg, sched_active_pid);
-    return _msg_wait(m, &tmsg, &t);
-}
-
-int _xtimer_msg_receive_timeout(msg_t *msg, uint32_t timeout_ticks)
-{
-    msg_t tmsg;
-    xtimer_t t;
-    _setup_timer_msg(&tmsg, &t);
-    _xtimer_set_msg(&t, timeout_ticks, &tmsg, sched_active_pid);
-    return _msg_wait(msg, &tmsg, &t);
-}
-
 static void _mutex_timeout(void *arg)
 {
     mutex_thread_t *mt = (mutex_thread_t *)arg;
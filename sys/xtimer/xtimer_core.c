@@ -48,6 +48,7 @@ static xtimer_t *long_list_head = NULL;
 
 static void _add_timer_to_list(xtimer_t **list_head, xtimer_t *timer);
 static void _add_timer_to_long_list(xtimer_t **list_head, xtimer_t *timer);
+static xtimer_t *_pop_timer(xtimer_t **list_head);
 static void _shoot(xtimer_t *timer);
 static void _remove(xtimer_t *timer);
 static inline void _lltimer_set(uint32_t target);
@@ -180,8 +181,6 @@ int _xtimer_set_absolute(xtimer_t *timer, uint32_t target)
     uint32_t now = _xtimer_now();
     int res = 0;
 
-    timer->next = NULL;
-
     /* Ensure that offset is bigger than 'XTIMER_BACKOFF',
      * 'target - now' will allways be the offset no matter if target < or > now.
      *
@@ -252,6 +251,163 @@ int _xtimer_set_absolute(xtimer_t *timer, uint32_t target)
     return res;
 }
 
+#ifdef MODULE_XTIMER_PHEAP
+/*
+ * Pairing heap backend: timer_list_head, overflow_list_head and
+ * long_list_head are heap roots instead of sorted list heads.  Within a heap,
+ * timer->next points to the right sibling, timer->child to the leftmost child
+ * and timer->prev either to the left sibling or, for a leftmost child, to the
+ * parent.  Roots have timer->prev == NULL.
+ *
+ * All three heaps are ordered by the full 64 bit target.  For the current and
+ * the overflow period long_target is the same for all timers, so this equals
+ * the ordering by target used by the list backend.
+ */
+static inline int _pheap_before(const xtimer_t *a, const xtimer_t *b)
+{
+    return (a->long_target < b->long_target)
+           || ((a->long_target == b->long_target) && (a->target <= b->target));
+}
+
+/**
+ * @brief meld two heap roots, return the new root
+ */
+static xtimer_t *_pheap_meld(xtimer_t *a, xtimer_t *b)
+{
+    if (!a) {
+        return b;
+    }
+    if (!b) {
+        return a;
+    }
+    if (!_pheap_before(a, b)) {
+        xtimer_t *tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    /* b becomes the leftmost child of a */
+    b->prev = a;
+    b->next = a->child;
+    if (a->child) {
+        a->child->prev = b;
+    }
+    a->child = b;
+
+    return a;
+}
+
+/**
+ * @brief standard two-pass merge of a sibling list, return the new root
+ */
+static xtimer_t *_pheap_merge_pairs(xtimer_t *first)
+{
+    xtimer_t *pairs = NULL;
+    xtimer_t *root = NULL;
+
+    /* first pass: meld pairs from left to right, collecting the results in
+     * reverse order */
+    while (first) {
+        xtimer_t *a = first;
+        xtimer_t *b = a->next;
+
+        first = (b) ? b->next : NULL;
+        a->next = NULL;
+        a->prev = NULL;
+        if (b) {
+            b->next = NULL;
+            b->prev = NULL;
+        }
+
+        a = _pheap_meld(a, b);
+        a->next = pairs;
+        pairs = a;
+    }
+
+    /* second pass: meld the pairs from right to left */
+    while (pairs) {
+        xtimer_t *next = pairs->next;
+
+        pairs->next = NULL;
+        root = _pheap_meld(root, pairs);
+        pairs = next;
+    }
+
+    return root;
+}
+
+static void _add_timer_to_list(xtimer_t **list_head, xtimer_t *timer)
+{
+    timer->next = NULL;
+    timer->prev = NULL;
+    timer->child = NULL;
+    *list_head = _pheap_meld(*list_head, timer);
+}
+
+static void _add_timer_to_long_list(xtimer_t **list_head, xtimer_t *timer)
+{
+    _add_timer_to_list(list_head, timer);
+}
+
+static xtimer_t *_pop_timer(xtimer_t **list_head)
+{
+    xtimer_t *timer = *list_head;
+
+    *list_head = _pheap_merge_pairs(timer->child);
+    timer->child = NULL;
+
+    return timer;
+}
+
+/**
+ * @brief cut a non-root timer out of its heap
+ *
+ * The timer gets replaced by the merged heap of its children.  The root of
+ * that heap is not smaller than the removed timer, so heap order is kept
+ * without having to know which heap the timer belongs to.
+ */
+static void _pheap_unlink(xtimer_t *timer)
+{
+    xtimer_t *repl = _pheap_merge_pairs(timer->child);
+
+    if (repl) {
+        repl->next = timer->next;
+        if (repl->next) {
+            repl->next->prev = repl;
+        }
+    }
+    else {
+        repl = timer->next;
+    }
+    if (repl) {
+        repl->prev = timer->prev;
+    }
+
+    if (timer->prev->child == timer) {
+        timer->prev->child = repl;
+    }
+    else {
+        timer->prev->next = repl;
+    }
+
+    timer->next = NULL;
+    timer->prev = NULL;
+    timer->child = NULL;
+}
+
+static void _remove_other(xtimer_t *timer)
+{
+    if (timer->prev) {
+        _pheap_unlink(timer);
+    }
+    else if (overflow_list_head == timer) {
+        _pop_timer(&overflow_list_head);
+    }
+    else if (long_list_head == timer) {
+        _pop_timer(&long_list_head);
+    }
+}
+#else /* MODULE_XTIMER_PHEAP */
 static void _add_timer_to_list(xtimer_t **list_head, xtimer_t *timer)
 {
     while (*list_head && (*list_head)->target <= timer->target) {
@@ -274,6 +430,15 @@ static void _add_timer_to_long_list(xtimer_t **list_head, xtimer_t *timer)
     *list_head = timer;
 }
 
+static xtimer_t *_pop_timer(xtimer_t **list_head)
+{
+    xtimer_t *timer = *list_head;
+
+    *list_head = timer->next;
+
+    return timer;
+}
+
 static int _remove_timer_from_list(xtimer_t **list_head, xtimer_t *timer)
 {
     while (*list_head) {
@@ -287,11 +452,21 @@ static int _remove_timer_from_list(xtimer_t **list_head, xtimer_t *timer)
     return 0;
 }
 
+static void _remove_other(xtimer_t *timer)
+{
+    if (!_remove_timer_from_list(&timer_list_head, timer)) {
+        if (!_remove_timer_from_list(&overflow_list_head, timer)) {
+            _remove_timer_from_list(&long_list_head, timer);
+        }
+    }
+}
+#endif /* MODULE_XTIMER_PHEAP */
+
 static void _remove(xtimer_t *timer)
 {
     if (timer_list_head == timer) {
         uint32_t next;
-        timer_list_head = timer->next;
+        _pop_timer(&timer_list_head);
         if (timer_list_head) {
             /* schedule callback on next timer target time */
             next = timer_list_head->target - XTIMER_OVERHEAD;
@@ -302,11 +477,7 @@ static void _remove(xtimer_t *timer)
         _lltimer_set(next);
     }
     else {
-        if (!_remove_timer_from_list(&timer_list_head, timer)) {
-            if (!_remove_timer_from_list(&overflow_list_head, timer)) {
-                _remove_timer_from_list(&long_list_head, timer);
-            }
-        }
+        _remove_other(timer);
     }
 }
 
@@ -346,6 +517,7 @@ static inline int _this_high_period(uint32_t target)
 #endif
 }
 
+#ifndef MODULE_XTIMER_PHEAP
 /**
  * @brief compare two timers' target values, return the one with lower value.
  *
@@ -435,6 +607,20 @@ static void _select_long_timers(void)
         }
     }
 }
+#else /* MODULE_XTIMER_PHEAP */
+/**
+ * @brief move long timers that will expire in the current short timer period
+ *        to the current timer heap
+ */
+static void _select_long_timers(void)
+{
+    while (long_list_head && (long_list_head->long_target <= _long_cnt)
+           && _this_high_period(long_list_head->target)) {
+        xtimer_t *timer = _pop_timer(&long_list_head);
+        _add_timer_to_list(&timer_list_head, timer);
+    }
+}
+#endif /* MODULE_XTIMER_PHEAP */
 
 /**
  * @brief handle low-level timer overflow, advance to next short timer period
@@ -503,11 +689,8 @@ overflow:
         /* make sure we don't fire too early */
         while (_time_left(_xtimer_lltimer_mask(timer_list_head->target), reference)) {}
 
-        /* pick first timer in list */
-        xtimer_t *timer = timer_list_head;
-
-        /* advance list */
-        timer_list_head = timer->next;
+        /* pick first timer in list and advance list */
+        xtimer_t *timer = _pop_timer(&timer_list_head);
 
         /* make sure timer is recognized as being already fired */
         timer->target = 0;
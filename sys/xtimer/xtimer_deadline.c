@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup sys_xtimer
+ *
+ * @{
+ * @file
+ * @brief   Deadline queue for blocking receive operations with timeout
+ *
+ * Threads blocking in @ref xtimer_msg_receive_timeout() or
+ * @ref xtimer_mbox_get_timeout() enqueue a deadline entry (living on their
+ * own stack) into a list sorted by expiry. A single xtimer is armed for the
+ * earliest deadline. When it fires, all due entries are handled in one pass
+ * and the blocked threads are put back on the run queue directly, so no
+ * per-call timer has to be set and removed in the common case of a message
+ * arriving before the timeout.
+ *
+ * Entries that are removed before they expire do not touch the timer. If the
+ * timer then fires for a deadline that no longer exists, it is simply
+ * re-armed for the new head of the queue.
+ *
+ * If a thread is not blocked when its deadline expires, it either was
+ * preempted before it blocked or it already got a message but did not remove
+ * its entry yet. Its entry is then handled again after
+ * @ref XTIMER_DEADLINE_RETRY ticks. No timeout message is ever sent, so there
+ * is nothing left in a message queue or mailbox once the call returned.
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "irq.h"
+#include "list.h"
+#include "mbox.h"
+#include "msg.h"
+#include "sched.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+/**
+ * @brief   States of a deadline entry
+ */
+enum {
+    _DEADLINE_WAITING = 0,  /**< deadline not reached yet */
+    _DEADLINE_WOKEN,        /**< thread was unblocked by the deadline */
+};
+
+/**
+ * @brief   Deadline entry of a blocked thread
+ */
+typedef struct _deadline {
+    struct _deadline *next;     /**< next entry in deadline queue */
+    uint64_t target;            /**< absolute expiry time in ticks */
+    thread_t *thread;           /**< the waiting thread */
+    mbox_t *mbox;               /**< mbox waited on, NULL for thread msg queue */
+    volatile uint8_t state;     /**< state of the entry */
+} _deadline_t;
+
+static void _deadline_cb(void *arg);
+
+static _deadline_t *_deadlines = NULL;
+static uint64_t _armed = 0;     /**< target the timer is armed for, 0 if idle */
+static xtimer_t _deadline_timer = { .callback = _deadline_cb };
+
+/* requires interrupts to be disabled */
+static void _arm(uint64_t now, uint64_t target)
+{
+    uint64_t offset = (target > now) ? (target - now) : 0;
+
+    _armed = target;
+    _xtimer_set64(&_deadline_timer, (uint32_t)offset, (uint32_t)(offset >> 32));
+}
+
+/* requires interrupts to be disabled */
+static void _insert(_deadline_t *d)
+{
+    _deadline_t **ptr = &_deadlines;
+
+    /* keep insertion order among equal deadlines */
+    while ((*ptr != NULL) && ((*ptr)->target <= d->target)) {
+        ptr = &(*ptr)->next;
+    }
+    d->next = *ptr;
+    *ptr = d;
+}
+
+/* returns 0 if the thread was not blocked and the deadline needs a retry */
+static int _expire(_deadline_t *d)
+{
+    thread_t *thread = d->thread;
+    int blocked;
+
+#ifdef MODULE_CORE_MBOX
+    if (d->mbox != NULL) {
+        blocked = (thread->status == STATUS_MBOX_BLOCKED) &&
+                  (list_remove(&d->mbox->readers,
+                               (list_node_t *)&thread->rq_entry) != NULL);
+    }
+    else {
+        blocked = (thread->status == STATUS_RECEIVE_BLOCKED);
+    }
+#else
+    blocked = (thread->status == STATUS_RECEIVE_BLOCKED);
+#endif
+    if (!blocked) {
+        return 0;
+    }
+    d->state = _DEADLINE_WOKEN;
+    sched_set_status(thread, STATUS_PENDING);
+    return 1;
+}
+
+static void _deadline_cb(void *arg)
+{
+    (void)arg;
+    /* handle deadlines that are due within the timer backoff as well, so the
+     * re-armed timer does not need to spin */
+    uint64_t now = _xtimer_now64();
+    uint64_t due = now + XTIMER_BACKOFF;
+
+    _armed = 0;
+    while ((_deadlines != NULL) && (_deadlines->target <= due)) {
+        _deadline_t *d = _deadlines;
+
+        _deadlines = d->next;
+        if (!_expire(d)) {
+            DEBUG("xtimer_deadline: thread %" PRIkernel_pid " not blocked, "
+                  "retrying\n", d->thread->pid);
+            /* lands behind all due entries, so the loop terminates */
+            d->target = due + XTIMER_DEADLINE_RETRY;
+            _insert(d);
+        }
+        else {
+            DEBUG("xtimer_deadline: expired for thread %" PRIkernel_pid "\n",
+                  d->thread->pid);
+        }
+    }
+    if (_deadlines != NULL) {
+        _arm(now, _deadlines->target);
+    }
+    thread_yield_higher();
+}
+
+static void _deadline_add(_deadline_t *d, mbox_t *mbox, uint64_t timeout_ticks)
+{
+    d->thread = (thread_t *)sched_active_thread;
+    d->mbox = mbox;
+    d->state = _DEADLINE_WAITING;
+
+    unsigned state = irq_disable();
+    uint64_t now = _xtimer_now64();
+
+    d->target = now + timeout_ticks;
+    _insert(d);
+    /* a stale timer armed for an earlier, already removed deadline is kept:
+     * it re-arms itself for the head when it fires */
+    if ((_armed == 0) || (d->target < _armed)) {
+        _arm(now, d->target);
+    }
+    irq_restore(state);
+}
+
+static int _deadline_del(_deadline_t *d)
+{
+    unsigned state = irq_disable();
+
+    if (d->state == _DEADLINE_WAITING) {
+        for (_deadline_t **ptr = &_deadlines; *ptr != NULL;
+             ptr = &(*ptr)->next) {
+            if (*ptr == d) {
+                *ptr = d->next;
+                break;
+            }
+        }
+    }
+    irq_restore(state);
+    return (d->state == _DEADLINE_WOKEN) ? -1 : 1;
+}
+
+int _xtimer_msg_receive_timeout64(msg_t *msg, uint64_t timeout_ticks)
+{
+    _deadline_t d;
+
+    if (timeout_ticks < XTIMER_BACKOFF) {
+        return (msg_try_receive(msg) < 0) ? -1 : 1;
+    }
+    _deadline_add(&d, NULL, timeout_ticks);
+    msg_receive(msg);
+    return _deadline_del(&d);
+}
+
+int _xtimer_msg_receive_timeout(msg_t *msg, uint32_t timeout_ticks)
+{
+    return _xtimer_msg_receive_timeout64(msg, timeout_ticks);
+}
+
+#ifdef MODULE_CORE_MBOX
+int _xtimer_mbox_get_timeout64(mbox_t *mbox, msg_t *msg, uint64_t timeout_ticks)
+{
+    _deadline_t d;
+
+    if (timeout_ticks < XTIMER_BACKOFF) {
+        return mbox_try_get(mbox, msg) ? 1 : -1;
+    }
+    _deadline_add(&d, mbox, timeout_ticks);
+    mbox_get(mbox, msg);
+    return _deadline_del(&d);
+}
+#endif /* MODULE_CORE_MBOX */
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compare FIB lookups with linear search and with `fib_trie`
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/fib.h"
+#include "net/fib/table.h"
+#include "net/ipv6/addr.h"
+#include "xtimer.h"
+
+#ifndef TEST_MAX_ENTRIES
+#define TEST_MAX_ENTRIES    (256U)
+#endif
+
+#ifndef TEST_LOOKUPS
+#define TEST_LOOKUPS        (2000U)
+#endif
+
+#define TEST_NEXT_HOPS      (4U)
+#define TEST_IFACE          (6)
+
+static const unsigned _sizes[] = { 16, 64, 256 };
+
+static fib_entry_t _linear_entries[TEST_MAX_ENTRIES];
+static fib_entry_t _trie_entries[TEST_MAX_ENTRIES];
+static fib_trie_node_t _trie_nodes[FIB_TRIE_NODES_NUMOF(TEST_MAX_ENTRIES)];
+
+static fib_table_t _linear = { .data.entries = _linear_entries,
+                               .table_type = FIB_TABLE_TYPE_SH,
+                               .mtx_access = MUTEX_INIT };
+static fib_table_t _trie = { .data.entries = _trie_entries,
+                             .table_type = FIB_TABLE_TYPE_SH,
+                             .mtx_access = MUTEX_INIT,
+                             .trie = { .nodes = _trie_nodes,
+                                       .nodes_numof = FIB_TRIE_NODES_NUMOF(TEST_MAX_ENTRIES) } };
+
+static uint32_t _seed = 1;
+
+static uint32_t _rand(void)
+{
+    _seed = (_seed * 1103515245U) + 12345U;
+    return _seed >> 8;
+}
+
+/* 2001:db8:<hash of idx>::/<plen> with plen in {32, 40, ..., 64}, so both
+ * tables get the same routes and lookups can aim at them. The prefix lengths
+ * are byte aligned, for those both search modes return the same entry (see
+ * fib.h) */
+static unsigned _prefix(ipv6_addr_t *addr, unsigned idx)
+{
+    unsigned plen = 32 + (8 * (idx % 5));
+    ipv6_addr_t prefix = IPV6_ADDR_UNSPECIFIED;
+
+    prefix.u16[0] = byteorder_htons(0x2001);
+    prefix.u16[1] = byteorder_htons(0x0db8);
+    prefix.u32[1].u32 = idx * 2654435761U;
+    /* no bits beyond the prefix length */
+    memset(addr, 0, sizeof(ipv6_addr_t));
+    ipv6_addr_init_prefix(addr, &prefix, plen);
+    return plen;
+}
+
+static void _fill(fib_table_t *table, unsigned size)
+{
+    ipv6_addr_t dst = IPV6_ADDR_UNSPECIFIED, next_hop = IPV6_ADDR_UNSPECIFIED;
+
+    next_hop.u8[0] = 0xfe;
+    next_hop.u8[1] = 0x80;
+    /* default route */
+    fib_add_entry(table, TEST_IFACE, dst.u8, sizeof(dst), 0,
+                  next_hop.u8, sizeof(next_hop), 0,
+                  (uint32_t)FIB_LIFETIME_NO_EXPIRE);
+    for (unsigned i = 1; i < size; i++) {
+        unsigned plen = _prefix(&dst, i);
+
+        next_hop.u8[15] = i % TEST_NEXT_HOPS;
+        fib_add_entry(table, TEST_IFACE, dst.u8, sizeof(dst),
+                      (uint32_t)plen << FIB_FLAG_NET_PREFIX_SHIFT,
+                      next_hop.u8, sizeof(next_hop), 0,
+                      (uint32_t)FIB_LIFETIME_NO_EXPIRE);
+    }
+}
+
+/* the i-th destination to look up, every other one within a prefix */
+static void _dst(ipv6_addr_t *dst, unsigned i, unsigned size)
+{
+    if ((i & 0x1) && (i % size)) {
+        _prefix(dst, i % size);
+    }
+    else {
+        dst->u32[0].u32 = _rand();
+        dst->u32[1].u32 = _rand();
+    }
+    dst->u32[2].u32 = _rand();
+    dst->u32[3].u32 = _rand();
+}
+
+static int _lookup(fib_table_t *table, const ipv6_addr_t *dst,
+                   kernel_pid_t *iface, uint8_t *next_hop)
+{
+    size_t next_hop_size = sizeof(ipv6_addr_t);
+    uint32_t next_hop_flags;
+
+    memset(next_hop, 0, sizeof(ipv6_addr_t));
+    *iface = KERNEL_PID_UNDEF;
+    return fib_get_next_hop(table, iface, next_hop, &next_hop_size,
+                            &next_hop_flags, (uint8_t *)dst->u8, sizeof(ipv6_addr_t),
+                            0);
+}
+
+static uint32_t _run(fib_table_t *table, unsigned size)
+{
+    uint8_t next_hop[sizeof(ipv6_addr_t)];
+    ipv6_addr_t dst;
+    uint32_t start = xtimer_now_usec();
+
+    _seed = size;
+    for (unsigned i = 0; i < TEST_LOOKUPS; i++) {
+        kernel_pid_t iface;
+
+        _dst(&dst, i, size);
+        _lookup(table, &dst, &iface, next_hop);
+    }
+    return xtimer_now_usec() - start;
+}
+
+static int _bench(unsigned size, uint32_t *linear_time, uint32_t *trie_time)
+{
+    uint8_t linear_hop[sizeof(ipv6_addr_t)], trie_hop[sizeof(ipv6_addr_t)];
+    ipv6_addr_t dst;
+
+    *linear_time = _run(&_linear, size);
+    *trie_time = _run(&_trie, size);
+
+    /* both tables must return the same next hop for every lookup */
+    _seed = size;
+    for (unsigned i = 0; i < TEST_LOOKUPS; i++) {
+        kernel_pid_t linear_iface, trie_iface;
+        int linear_res, trie_res;
+
+        _dst(&dst, i, size);
+        linear_res = _lookup(&_linear, &dst, &linear_iface, linear_hop);
+        trie_res = _lookup(&_trie, &dst, &trie_iface, trie_hop);
+        if ((linear_res != trie_res) || (linear_iface != trie_iface) ||
+            (memcmp(linear_hop, trie_hop, sizeof(ipv6_addr_t)) != 0)) {
+            char addr_str[IPV6_ADDR_MAX_STR_LEN];
+
+            printf("lookup of %s differs: linear %d, trie %d\n",
+                   ipv6_addr_to_str(addr_str, &dst, sizeof(addr_str)),
+                   linear_res, trie_res);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_sizes) / sizeof(_sizes[0]); i++) {
+        unsigned size = _sizes[i];
+        uint32_t linear_time, trie_time;
+
+        if (size > TEST_MAX_ENTRIES) {
+            break;
+        }
+        _linear.size = size;
+        _trie.size = size;
+        /* both tables share the universal address pool, which fib_init()
+         * resets, so initialize both before filling either */
+        fib_init(&_linear);
+        fib_init(&_trie);
+        _fill(&_linear, size);
+        _fill(&_trie, size);
+        if (_bench(size, &linear_time, &trie_time) < 0) {
+            puts("[FAILED]");
+            return 1;
+        }
+        printf("{ \"entries\" : %u, \"linear\" : %" PRIu32
+               ", \"trie\" : %" PRIu32 " }\n", size, linear_time, trie_time);
+        fib_deinit(&_trie);
+        fib_deinit(&_linear);
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
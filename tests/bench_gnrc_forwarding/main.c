@@ -0,0 +1,368 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for IPv6 forwarding with GNRC
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "msg.h"
+#include "net/ethernet.h"
+#include "net/ethertype.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifndef TEST_PKTS
+#define TEST_PKTS               (1000U)
+#endif
+/* number of packets in flight, must be smaller than the message queues of
+ * the network interfaces and the IPv6 thread */
+#ifndef TEST_WINDOW
+#define TEST_WINDOW             (4U)
+#endif
+#define TEST_TIMEOUT            (100U * US_PER_MS)
+/* offset of the sequence number in the frames sent by the generator */
+#define TEST_SEQ_OFFSET         (sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t))
+/* offset of the 16-bit word of the destination address that selects the
+ * route */
+#define TEST_ROUTE_OFFSET       (sizeof(ethernet_hdr_t) + \
+                                 offsetof(ipv6_hdr_t, dst) + 6U)
+
+enum {
+    DEV_IN = 0,                 /**< device the generator sends on */
+    DEV_OUT,                    /**< device the packets are forwarded to */
+    DEV_NUMOF,
+};
+
+/* sizes of the IPv6 packets sent */
+static const uint16_t _sizes[] = { 64U, 256U, 1280U };
+/* number of routes in the forwarding table */
+static const uint16_t _routes[] = { 1U, 8U, 32U };
+
+static const uint8_t _dev_l2addr[DEV_NUMOF][ETHERNET_ADDR_LEN] = {
+    { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 },
+    { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 },
+};
+static const uint8_t _gen_l2addr[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0xaa };
+static const uint8_t _next_hop_l2addr[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0xbb };
+static const ipv6_addr_t _gen_addr = { .u8 = {
+        0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    } };
+static const ipv6_addr_t _next_hop = { .u8 = {
+        0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    } };
+/* the routes are fd00:0:0:<i>::/64 */
+static const ipv6_addr_t _route_prefix = { .u8 = {
+        0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    } };
+
+static char _netif_stacks[DEV_NUMOF][THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _devs[DEV_NUMOF];
+static gnrc_netif_t *_netifs[DEV_NUMOF];
+static msg_t _msg_queue[TEST_WINDOW * 2];
+static kernel_pid_t _main_pid;
+
+/* frame template of the current run */
+static uint8_t _frame[ETHERNET_FRAME_LEN];
+static uint16_t _frame_len;
+static uint16_t _route_numof;
+/* sequence number of the next frame received by DEV_IN */
+static uint32_t _recv_seq;
+/* time the frames in flight were handed to DEV_IN */
+static uint32_t _sent_at[TEST_WINDOW];
+static uint32_t _latency[TEST_PKTS];
+static volatile unsigned _forwarded;
+
+static inline unsigned _dev_idx(netdev_t *dev)
+{
+    return (unsigned)(intptr_t)((netdev_test_t *)dev)->state;
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    assert(max_len == sizeof(uint16_t));
+    (void)dev;
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    assert(max_len == sizeof(uint16_t));
+    (void)dev;
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    assert(max_len >= ETHERNET_ADDR_LEN);
+    memcpy(value, _dev_l2addr[_dev_idx(dev)], ETHERNET_ADDR_LEN);
+    return ETHERNET_ADDR_LEN;
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+/* every reception of DEV_IN gets the next frame of the generator */
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    uint32_t seq;
+    uint16_t route;
+
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        if (len > 0) {
+            /* frame is dropped */
+            _recv_seq++;
+        }
+        return _frame_len;
+    }
+    if (len < _frame_len) {
+        return -ENOBUFS;
+    }
+    seq = _recv_seq++;
+    route = seq % _route_numof;
+    memcpy(buf, _frame, _frame_len);
+    buf[TEST_ROUTE_OFFSET] = route >> 8;
+    buf[TEST_ROUTE_OFFSET + 1] = route & 0xff;
+    memcpy(&buf[TEST_SEQ_OFFSET], &seq, sizeof(seq));
+    return _frame_len;
+}
+
+static size_t _copy_hdr(const iolist_t *iolist, uint8_t *buf, size_t len)
+{
+    size_t res = 0;
+
+    for (; (iolist != NULL) && (res < len); iolist = iolist->iol_next) {
+        size_t cpy = iolist->iol_len;
+
+        if (cpy > (len - res)) {
+            cpy = len - res;
+        }
+        memcpy(&buf[res], iolist->iol_base, cpy);
+        res += cpy;
+    }
+    return res;
+}
+
+/* DEV_OUT measures the latency of all frames forwarded from the generator */
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    uint8_t hdr[TEST_SEQ_OFFSET + sizeof(uint32_t)];
+    ethernet_hdr_t *eth_hdr = (ethernet_hdr_t *)hdr;
+    ipv6_hdr_t ipv6_hdr;
+    uint32_t now = xtimer_now_usec();
+    uint32_t seq;
+    msg_t msg = { .type = 0U };
+
+    if ((_dev_idx(dev) != DEV_OUT) ||
+        (_copy_hdr(iolist, hdr, sizeof(hdr)) < sizeof(hdr)) ||
+        (byteorder_ntohs(eth_hdr->type) != ETHERTYPE_IPV6)) {
+        return iolist_size(iolist);
+    }
+    memcpy(&ipv6_hdr, &hdr[sizeof(ethernet_hdr_t)], sizeof(ipv6_hdr));
+    if ((ipv6_hdr.nh != PROTNUM_IPV6_NONXT) ||
+        !ipv6_addr_equal(&ipv6_hdr.src, &_gen_addr)) {
+        return iolist_size(iolist);
+    }
+    memcpy(&seq, &hdr[TEST_SEQ_OFFSET], sizeof(seq));
+    if (_forwarded < TEST_PKTS) {
+        _latency[_forwarded++] = now - _sent_at[seq % TEST_WINDOW];
+    }
+    msg_try_send(&msg, _main_pid);
+    return iolist_size(iolist);
+}
+
+static void _init_interfaces(void)
+{
+    for (unsigned i = 0; i < DEV_NUMOF; i++) {
+        netdev_test_t *dev = &_devs[i];
+
+        netdev_test_setup(dev, (void *)(intptr_t)i);
+        netdev_test_set_get_cb(dev, NETOPT_DEVICE_TYPE, _get_device_type);
+        netdev_test_set_get_cb(dev, NETOPT_MAX_PDU_SIZE,
+                               _get_max_packet_size);
+        netdev_test_set_get_cb(dev, NETOPT_ADDRESS, _get_address);
+        netdev_test_set_send_cb(dev, _send);
+        netdev_test_set_recv_cb(dev, _recv);
+        netdev_test_set_isr_cb(dev, _isr);
+        _netifs[i] = gnrc_netif_ethernet_create(_netif_stacks[i],
+                                                THREAD_STACKSIZE_DEFAULT,
+                                                GNRC_NETIF_PRIO, "bench",
+                                                (netdev_t *)dev);
+    }
+    gnrc_ipv6_nib_nc_set(&_next_hop, _netifs[DEV_OUT]->pid,
+                         _next_hop_l2addr, sizeof(_next_hop_l2addr));
+}
+
+static ipv6_addr_t _route(unsigned i)
+{
+    ipv6_addr_t prefix = _route_prefix;
+
+    prefix.u16[3] = byteorder_htons(i);
+    return prefix;
+}
+
+static int _set_routes(unsigned numof)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        ipv6_addr_t prefix = _route(i);
+
+        if (gnrc_ipv6_nib_ft_add(&prefix, 64U, &_next_hop,
+                                 _netifs[DEV_OUT]->pid, 0) < 0) {
+            return -1;
+        }
+    }
+    _route_numof = numof;
+    return 0;
+}
+
+static void _del_routes(void)
+{
+    for (unsigned i = 0; i < _route_numof; i++) {
+        ipv6_addr_t prefix = _route(i);
+
+        gnrc_ipv6_nib_ft_del(&prefix, 64U);
+    }
+}
+
+static void _build_frame(uint16_t size)
+{
+    ethernet_hdr_t *eth_hdr = (ethernet_hdr_t *)_frame;
+    ipv6_hdr_t ipv6_hdr;
+
+    memset(_frame, 0, sizeof(_frame));
+    memcpy(eth_hdr->dst, _dev_l2addr[DEV_IN], ETHERNET_ADDR_LEN);
+    memcpy(eth_hdr->src, _gen_l2addr, ETHERNET_ADDR_LEN);
+    eth_hdr->type = byteorder_htons(ETHERTYPE_IPV6);
+    memset(&ipv6_hdr, 0, sizeof(ipv6_hdr));
+    ipv6_hdr_set_version(&ipv6_hdr);
+    ipv6_hdr.len = byteorder_htons(size - sizeof(ipv6_hdr_t));
+    ipv6_hdr.nh = PROTNUM_IPV6_NONXT;
+    ipv6_hdr.hl = 64U;
+    ipv6_hdr.src = _gen_addr;
+    ipv6_hdr.dst = _route_prefix;
+    memcpy(&_frame[sizeof(ethernet_hdr_t)], &ipv6_hdr, sizeof(ipv6_hdr));
+    _frame_len = sizeof(ethernet_hdr_t) + size;
+}
+
+static void _inject(netdev_t *dev, unsigned seq)
+{
+    _sent_at[seq % TEST_WINDOW] = xtimer_now_usec();
+    dev->event_callback(dev, NETDEV_EVENT_ISR);
+}
+
+static int _cmp_latency(const void *a, const void *b)
+{
+    uint32_t la = *((const uint32_t *)a), lb = *((const uint32_t *)b);
+
+    return (la > lb) - (la < lb);
+}
+
+static inline unsigned long _percentile(unsigned numof, unsigned p)
+{
+    return (numof > 0) ? _latency[((numof - 1) * p) / 100U] : 0;
+}
+
+/* returns the number of packets lost */
+static unsigned _run(uint16_t size, uint16_t routes)
+{
+    netdev_t *dev = (netdev_t *)&_devs[DEV_IN];
+    unsigned sent = 0, forwarded;
+    uint32_t start, duration;
+    uint64_t pps = 0;
+    msg_t msg;
+
+    if (_set_routes(routes) < 0) {
+        printf("Unable to add %u routes\n", routes);
+        _del_routes();
+        return TEST_PKTS;
+    }
+    _build_frame(size);
+    _recv_seq = 0;
+    _forwarded = 0;
+    gnrc_pktbuf_high_water(true);
+    start = xtimer_now_usec();
+    while (_forwarded < TEST_PKTS) {
+        while ((sent < TEST_PKTS) && ((sent - _forwarded) < TEST_WINDOW)) {
+            _inject(dev, sent++);
+        }
+        if (xtimer_msg_receive_timeout(&msg, TEST_TIMEOUT) < 0) {
+            break;
+        }
+    }
+    duration = xtimer_now_usec() - start;
+    /* a lost packet stalls the generator, so the loop above gives up on the
+     * rest of the run */
+    forwarded = _forwarded;
+    _del_routes();
+    if (forwarded > 0) {
+        qsort(_latency, forwarded, sizeof(_latency[0]), _cmp_latency);
+        pps = ((uint64_t)forwarded * US_PER_SEC) / duration;
+    }
+    printf("{ \"size\" : %u, \"routes\" : %u, \"pkts\" : %u, \"pps\" : %lu, "
+           "\"p50\" : %lu, \"p90\" : %lu, \"p99\" : %lu, \"max\" : %lu, "
+           "\"pktbuf\" : %u }\n", size, routes, forwarded,
+           (unsigned long)pps, _percentile(forwarded, 50),
+           _percentile(forwarded, 90), _percentile(forwarded, 99),
+           _percentile(forwarded, 100),
+           (unsigned)gnrc_pktbuf_high_water(false));
+    return TEST_PKTS - forwarded;
+}
+
+int main(void)
+{
+    unsigned lost = 0;
+
+    _main_pid = thread_getpid();
+    msg_init_queue(_msg_queue, sizeof(_msg_queue) / sizeof(_msg_queue[0]));
+    _init_interfaces();
+    /* let the interfaces and the NIB settle */
+    xtimer_usleep(100U * US_PER_MS);
+    printf("Forwarding %u packets per run, %u in flight\n", TEST_PKTS,
+           TEST_WINDOW);
+    for (unsigned i = 0; i < (sizeof(_sizes) / sizeof(_sizes[0])); i++) {
+        for (unsigned j = 0; j < (sizeof(_routes) / sizeof(_routes[0])); j++) {
+            lost += _run(_sizes[i], _routes[j]);
+        }
+    }
+    if (lost > 0) {
+        printf("%u packets were lost\n", lost);
+        puts("[FAILED]");
+    }
+    else {
+        puts("[SUCCESS]");
+    }
+    return 0;
+}
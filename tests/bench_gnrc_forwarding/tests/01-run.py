@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for size in (64, 256, 1280):
+        for routes in (1, 8, 32):
+            child.expect(r"{{ \"size\" : {}, \"routes\" : {}, "
+                         r"\"pkts\" : \d+, \"pps\" : \d+, \"p50\" : \d+, "
+                         r"\"p90\" : \d+, \"p99\" : \d+, \"max\" : \d+, "
+                         r"\"pktbuf\" : \d+ }}".format(size, routes))
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC TCP throughput benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <errno.h>
+#include "net/af.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/tcp.h"
+#include "xtimer.h"
+
+/* Size of the application buffer */
+#ifndef BUF_SIZE
+#define BUF_SIZE (4096)
+#endif
+
+static uint8_t _buf[BUF_SIZE];
+static gnrc_tcp_tcb_t _tcb;
+
+static void _report(const char *dir, uint32_t bytes, uint32_t usec)
+{
+    uint32_t kbits = (usec > 0) ? (uint32_t)(((uint64_t)bytes * 8 * 1000) / usec) : 0;
+
+    printf("{ \"dir\" : \"%s\", \"bytes\" : %lu, \"usec\" : %lu, \"kbit/s\" : %lu }\n", dir,
+           (unsigned long)bytes, (unsigned long)usec, (unsigned long)kbits);
+}
+
+static int _recv_all(void)
+{
+    uint32_t start = 0;
+    uint32_t rcvd = 0;
+
+    while (rcvd < TEST_BYTES) {
+        ssize_t ret = gnrc_tcp_recv(&_tcb, _buf, sizeof(_buf),
+                                    GNRC_TCP_CONNECTION_TIMEOUT_DURATION);
+        if (ret < 0) {
+            printf("gnrc_tcp_recv() : %d\n", (int)ret);
+            return ret;
+        }
+        /* Start the clock with the first data */
+        if (rcvd == 0) {
+            start = xtimer_now_usec();
+        }
+        rcvd += ret;
+    }
+    _report("rx", rcvd, xtimer_now_usec() - start);
+    return 0;
+}
+
+static int _send_all(void)
+{
+    uint32_t start = xtimer_now_usec();
+    uint32_t sent = 0;
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = (uint8_t)i;
+    }
+    while (sent < TEST_BYTES) {
+        size_t len = TEST_BYTES - sent;
+        ssize_t ret = gnrc_tcp_send(&_tcb, _buf, (len < sizeof(_buf)) ? len : sizeof(_buf), 0);
+        if (ret < 0) {
+            printf("gnrc_tcp_send() : %d\n", (int)ret);
+            return ret;
+        }
+        sent += ret;
+    }
+    /* The connection is closed once the peer acknowledged all data */
+    gnrc_tcp_close(&_tcb);
+    _report("tx", sent, xtimer_now_usec() - start);
+    return 0;
+}
+
+int main(void)
+{
+    gnrc_netif_t *netif;
+    ipv6_addr_t addr;
+
+    if (!(netif = gnrc_netif_iter(NULL))) {
+        puts("No valid network interface found");
+        return -1;
+    }
+    if (ipv6_addr_from_str(&addr, SERVER_ADDR) == NULL) {
+        puts("Can't convert given string to IPv6 Address");
+        return -1;
+    }
+    if (gnrc_netif_ipv6_addr_add(netif, &addr, 64, GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) < 0) {
+        puts("Can't assign given IPv6 Address");
+        return -1;
+    }
+
+    printf("Benchmark: SERVER_ADDR=%s, SERVER_PORT=%d, TEST_BYTES=%lu, MSS=%u, WINDOW=%u, "
+           "RTX_QUEUE_SIZE=%u\n", SERVER_ADDR, SERVER_PORT, (unsigned long)TEST_BYTES,
+           GNRC_TCP_MSS, GNRC_TCP_DEFAULT_WINDOW, GNRC_TCP_RTX_QUEUE_SIZE);
+
+    while (1) {
+        gnrc_tcp_tcb_init(&_tcb);
+        int ret = gnrc_tcp_open_passive(&_tcb, AF_INET6, NULL, SERVER_PORT);
+        if (ret < 0) {
+            printf("gnrc_tcp_open_passive() : %d\n", ret);
+            return -1;
+        }
+        /* The peer sends TEST_BYTES first, then receives TEST_BYTES */
+        if (_recv_all() < 0 || _send_all() < 0) {
+            gnrc_tcp_abort(&_tcb);
+        }
+    }
+    return 0;
+}
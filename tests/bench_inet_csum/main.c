@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compare the word-at-a-time Internet Checksum with a byte-wise
+ *              implementation
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/inet_csum.h"
+#include "xtimer.h"
+
+#ifndef TEST_BYTES
+#define TEST_BYTES          (256UL * 1024UL)
+#endif
+
+#define TEST_BUFSIZE        (1280U)
+#define TEST_SNIPS          (3U)
+
+static const unsigned _sizes[] = { 8, 40, 127, 1280 };
+
+static uint8_t _buf[TEST_BUFSIZE + 1];
+
+/* the byte-wise implementation inet_csum_slice() used previously */
+static uint16_t _csum_slice_bytewise(uint16_t sum, const uint8_t *buf,
+                                     uint16_t len, size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    if (len == 0) {
+        return csum;
+    }
+    if (accum_len & 1) {
+        csum += *buf;
+        buf++;
+        len--;
+        accum_len++;
+    }
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if ((accum_len + len) & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        uint16_t carry = csum >> 16;
+        csum = (csum & 0xffff) + carry;
+    }
+    return csum;
+}
+
+static uint32_t _bench_bytewise(const uint8_t *buf, unsigned size,
+                                uint16_t *sum)
+{
+    uint32_t start = xtimer_now_usec();
+
+    for (unsigned long i = 0; i < TEST_BYTES; i += size) {
+        *sum = _csum_slice_bytewise(*sum, buf, size, 0);
+    }
+    return xtimer_now_usec() - start;
+}
+
+static uint32_t _bench_slice(const uint8_t *buf, unsigned size, uint16_t *sum)
+{
+    uint32_t start = xtimer_now_usec();
+
+    for (unsigned long i = 0; i < TEST_BYTES; i += size) {
+        *sum = inet_csum_slice(*sum, buf, size, 0);
+    }
+    return xtimer_now_usec() - start;
+}
+
+/* splits buf into TEST_SNIPS odd-sized snips to sum up in one pass */
+static uint32_t _bench_iolist(const uint8_t *buf, unsigned size, uint16_t *sum)
+{
+    iolist_t snips[TEST_SNIPS];
+    unsigned snip_size = (size / TEST_SNIPS) | 1;
+    uint32_t start;
+
+    for (unsigned i = 0; i < TEST_SNIPS; i++) {
+        snips[i].iol_next = (i < (TEST_SNIPS - 1)) ? &snips[i + 1] : NULL;
+        snips[i].iol_base = (uint8_t *)buf + (i * snip_size);
+        snips[i].iol_len = (i < (TEST_SNIPS - 1)) ? snip_size
+                         : size - (i * snip_size);
+    }
+    start = xtimer_now_usec();
+    for (unsigned long i = 0; i < TEST_BYTES; i += size) {
+        size_t accum_len = 0;
+
+        *sum = inet_csum_iolist(*sum, snips, NULL, &accum_len);
+    }
+    return xtimer_now_usec() - start;
+}
+
+int main(void)
+{
+    unsigned errors = 0;
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = 0xff - (i * 7);
+    }
+    puts("Internet Checksum benchmark");
+    printf("summing up %lu bytes per run, times in us\n", TEST_BYTES);
+
+    for (unsigned i = 0; i < (sizeof(_sizes) / sizeof(_sizes[0])); i++) {
+        /* also run on an odd address to exercise the unaligned path */
+        for (unsigned offset = 0; offset < 2; offset++) {
+            unsigned size = _sizes[i];
+            /* every run continues with the sum of its previous iteration,
+             * so the compiler can't move the calls out of the loop */
+            uint16_t ref = 0, slice = 0, iolist = 0;
+            uint32_t t_ref, t_slice, t_iolist;
+
+            t_ref = _bench_bytewise(&_buf[offset], size, &ref);
+            t_slice = _bench_slice(&_buf[offset], size, &slice);
+            t_iolist = _bench_iolist(&_buf[offset], size, &iolist);
+            if ((ref != slice) || (ref != iolist)) {
+                printf("checksum mismatch: 0x%04x 0x%04x 0x%04x\n",
+                       ref, slice, iolist);
+                errors++;
+            }
+            printf("{ \"size\" : %u, \"offset\" : %u, \"bytewise\" : %" PRIu32
+                   ", \"slice\" : %" PRIu32 ", \"iolist\" : %" PRIu32 " }\n",
+                   size, offset, t_ref, t_slice, t_iolist);
+        }
+    }
+    puts((errors) ? "[FAILED]" : "[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for size in (8, 40, 127, 1280):
+        for offset in (0, 1):
+            child.expect(r"{{ \"size\" : {}, \"offset\" : {}, "
+                         r"\"bytewise\" : \d+, \"slice\" : \d+, "
+                         r"\"iolist\" : \d+ }}".format(size, offset))
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -28,8 +28,13 @@
 #define TEST_DURATION       (1000000U)
 #endif
 
+#ifndef TEST_BURST
+#define TEST_BURST          (8U)
+#endif
+
 volatile unsigned _flag = 0;
 static char _stack[THREAD_STACKSIZE_MAIN];
+static char _burst_stack[THREAD_STACKSIZE_MAIN];
 
 static void _timer_callback(void*arg)
 {
@@ -50,6 +55,21 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+static void *_burst_thread(void *arg)
+{
+    (void)arg;
+    msg_t queue[TEST_BURST];
+    msg_t batch[TEST_BURST];
+
+    msg_init_queue(queue, TEST_BURST);
+
+    while(1) {
+        msg_receive_batch(batch, TEST_BURST);
+    }
+
+    return NULL;
+}
+
 int main(void)
 {
     printf("main starting\n");
@@ -77,5 +97,26 @@ int main(void)
 
     printf("{ \"result\" : %"PRIu32" }\n", n);
 
+    /* same again, but in bursts of TEST_BURST messages */
+    other = thread_create(_burst_stack,
+                          sizeof(_burst_stack),
+                          (THREAD_PRIORITY_MAIN - 1),
+                          THREAD_CREATE_STACKTEST,
+                          _burst_thread,
+                          NULL,
+                          "burst_thread");
+
+    msg_t burst[TEST_BURST];
+
+    n = 0;
+    _flag = 0;
+
+    xtimer_set(&timer, TEST_DURATION);
+    while(!_flag) {
+        n += msg_send_batch(burst, TEST_BURST, other);
+    }
+
+    printf("{ \"burst\" : %u, \"result\" : %"PRIu32" }\n", TEST_BURST, n);
+
     return 0;
 }
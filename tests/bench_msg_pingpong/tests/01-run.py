@@ -13,6 +13,7 @@ from testrunner import run
 
 def testfunc(child):
     child.expect(r"{ \"result\" : \d+ }")
+    child.expect(r"{ \"burst\" : \d+, \"result\" : \d+ }")
 
 
 if __name__ == "__main__":
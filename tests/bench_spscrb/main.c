@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compare the throughput of tsrb and spscrb
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "spscrb.h"
+#include "tsrb.h"
+#include "xtimer.h"
+
+#ifndef TEST_BUFSIZE
+#define TEST_BUFSIZE        (256U)
+#endif
+
+#ifndef TEST_BYTES
+#define TEST_BYTES          (64UL * 1024UL)
+#endif
+
+static const unsigned _chunks[] = { 1, 4, 16, 64 };
+
+static char _tsrb_mem[TEST_BUFSIZE];
+static uint8_t _spscrb_mem[TEST_BUFSIZE];
+static char _in[64];
+static char _out[64];
+
+static uint32_t _bench_tsrb(unsigned chunk)
+{
+    tsrb_t rb;
+    uint32_t start;
+
+    tsrb_init(&rb, _tsrb_mem, sizeof(_tsrb_mem));
+    start = xtimer_now_usec();
+    for (unsigned long i = 0; i < TEST_BYTES; i += chunk) {
+        tsrb_add(&rb, _in, chunk);
+        tsrb_get(&rb, _out, chunk);
+    }
+    return xtimer_now_usec() - start;
+}
+
+static uint32_t _bench_spscrb(unsigned chunk)
+{
+    spscrb_t rb;
+    uint32_t start;
+
+    spscrb_init(&rb, _spscrb_mem, 1, sizeof(_spscrb_mem));
+    start = xtimer_now_usec();
+    for (unsigned long i = 0; i < TEST_BYTES; i += chunk) {
+        spscrb_put(&rb, _in, chunk);
+        spscrb_get(&rb, _out, chunk);
+    }
+    return xtimer_now_usec() - start;
+}
+
+static uint32_t _bench_spscrb_peek(unsigned chunk)
+{
+    spscrb_t rb;
+    uint32_t start;
+
+    spscrb_init(&rb, _spscrb_mem, 1, sizeof(_spscrb_mem));
+    start = xtimer_now_usec();
+    for (unsigned long i = 0; i < TEST_BYTES; i += chunk) {
+        unsigned n;
+        uint8_t *dst = spscrb_peek_write(&rb, &n);
+        const uint8_t *src;
+
+        /* chunk sizes divide the buffer size, so a chunk never wraps */
+        for (unsigned j = 0; j < chunk; j++) {
+            dst[j] = _in[j];
+        }
+        spscrb_commit_write(&rb, chunk);
+        src = spscrb_peek_read(&rb, &n);
+        for (unsigned j = 0; j < chunk; j++) {
+            _out[j] = src[j];
+        }
+        spscrb_commit_read(&rb, chunk);
+    }
+    return xtimer_now_usec() - start;
+}
+
+int main(void)
+{
+    puts("Ringbuffer throughput benchmark");
+    printf("moving %lu bytes per run, times in us\n", TEST_BYTES);
+
+    for (unsigned i = 0; i < (sizeof(_chunks) / sizeof(_chunks[0])); i++) {
+        unsigned chunk = _chunks[i];
+
+        printf("{ \"chunk\" : %u, \"tsrb\" : %" PRIu32 ", \"spscrb\" : %"
+               PRIu32 ", \"peek\" : %" PRIu32 " }\n", chunk,
+               _bench_tsrb(chunk), _bench_spscrb(chunk),
+               _bench_spscrb_peek(chunk));
+    }
+    puts("[SUCCESS]");
+
+    return 0;
+}
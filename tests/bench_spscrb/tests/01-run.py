@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for chunk in (1, 4, 16, 64):
+        child.expect(r"{{ \"chunk\" : {}, \"tsrb\" : \d+, \"spscrb\" : \d+, "
+                     r"\"peek\" : \d+ }}".format(chunk))
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure xtimer set/remove cost against the number of
+ *              active timers
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "random.h"
+#include "xtimer.h"
+
+#ifndef TEST_TIMERS_MAX
+#define TEST_TIMERS_MAX     (1000U)
+#endif
+
+#ifndef TEST_REPEAT
+#define TEST_REPEAT         (256U)
+#endif
+
+/* keep all targets far enough in the future so nothing fires during a run */
+#define TEST_OFFSET_MIN     (60U * US_PER_SEC)
+#define TEST_OFFSET_MAX     (120U * US_PER_SEC)
+
+static const unsigned _steps[] = { 10, 20, 50, 100, 200, 500, 1000 };
+
+static xtimer_t _timers[TEST_TIMERS_MAX];
+static uint16_t _idx[TEST_REPEAT];
+static uint32_t _offset[TEST_REPEAT];
+
+static void _cb(void *arg)
+{
+    (void)arg;
+    puts("timer fired unexpectedly");
+}
+
+static void _run(unsigned numof)
+{
+    uint32_t start, set, remove;
+
+    for (unsigned i = 0; i < TEST_REPEAT; i++) {
+        _idx[i] = random_uint32_range(0, numof);
+        _offset[i] = random_uint32_range(TEST_OFFSET_MIN, TEST_OFFSET_MAX);
+    }
+    for (unsigned i = 0; i < numof; i++) {
+        _timers[i].callback = _cb;
+        xtimer_set(&_timers[i],
+                   random_uint32_range(TEST_OFFSET_MIN, TEST_OFFSET_MAX));
+    }
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < TEST_REPEAT; i++) {
+        xtimer_set(&_timers[_idx[i]], _offset[i]);
+    }
+    set = xtimer_now_usec() - start;
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < numof; i++) {
+        xtimer_remove(&_timers[i]);
+    }
+    remove = xtimer_now_usec() - start;
+    /* normalize to TEST_REPEAT removals */
+    remove = (uint32_t)(((uint64_t)remove * TEST_REPEAT) / numof);
+
+    printf("{ \"timers\" : %u, \"set\" : %" PRIu32 ", \"remove\" : %" PRIu32 " }\n",
+           numof, set, remove);
+}
+
+int main(void)
+{
+    puts("xtimer set/remove benchmark");
+    printf("times in us per %u operations\n", TEST_REPEAT);
+
+    for (unsigned i = 0; i < (sizeof(_steps) / sizeof(_steps[0])); i++) {
+        if (_steps[i] > TEST_TIMERS_MAX) {
+            break;
+        }
+        _run(_steps[i]);
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
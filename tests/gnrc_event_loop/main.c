@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the single-thread stack mode
+ *              (gnrc_event_loop)
+ *
+ * Checks that IPv6 and UDP share one thread, that packets dispatched to a
+ * layer are handled in that thread in order of dispatch, that messages and
+ * events reach the shared thread and that a UDP packet sent to the loopback
+ * address passes UDP and IPv6 in both directions.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "event.h"
+#include "msg.h"
+#include "thread.h"
+#include "net/ipv6/addr.h"
+#include "net/gnrc/event_loop.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/udp.h"
+
+#define TEST_DEMUX_CTX      (0x4242)
+#define TEST_MSG_TYPE       (0x4243)
+#define TEST_EVENT_MSG_TYPE (0x4244)
+#define TEST_LAYER_MSG_TYPE (0x4245)
+#define TEST_PORT           (8000U)
+#define TEST_PKTS           (4U)
+#define QUEUE_SIZE          (8U)
+
+static msg_t _main_queue[QUEUE_SIZE];
+static kernel_pid_t _main_pid;
+static unsigned _failed = 0;
+
+static bool _layer_handle(msg_t *msg);
+static void _event_handler(event_t *event);
+
+static gnrc_event_loop_layer_t _layer = GNRC_EVENT_LOOP_LAYER_INIT(_layer_handle);
+static event_t _event = { .handler = _event_handler };
+
+/* reports back to main, with the shared thread as sender */
+static void _report(uint16_t type, uint32_t value)
+{
+    msg_t m = { .type = type, .content = { .value = value } };
+
+    msg_send(&m, _main_pid);
+}
+
+static bool _layer_handle(msg_t *msg)
+{
+    switch (msg->type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV: {
+            gnrc_pktsnip_t *pkt = msg->content.ptr;
+
+            _report(TEST_LAYER_MSG_TYPE, *((uint8_t *)pkt->data));
+            gnrc_pktbuf_release(pkt);
+            return true;
+        }
+        case TEST_MSG_TYPE:
+            _report(TEST_MSG_TYPE, msg->content.value);
+            return true;
+        default:
+            return false;
+    }
+}
+
+static void _event_handler(event_t *event)
+{
+    (void)event;
+    _report(TEST_EVENT_MSG_TYPE, 0);
+}
+
+static void _check(const char *name, int ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    if (!ok) {
+        _failed++;
+    }
+}
+
+static void _test_shared_thread(void)
+{
+    kernel_pid_t pid = gnrc_event_loop_init();
+
+    _check("shared thread", (pid > KERNEL_PID_UNDEF) &&
+                            (gnrc_ipv6_pid == pid) &&
+                            (gnrc_udp_init() == pid));
+}
+
+static void _test_layer_order(void)
+{
+    int ok = 1;
+
+    for (unsigned i = 0; i < TEST_PKTS; i++) {
+        uint8_t seq = i;
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, &seq, sizeof(seq),
+                                              GNRC_NETTYPE_UNDEF);
+
+        if ((pkt == NULL) ||
+            (gnrc_netapi_dispatch_receive(GNRC_NETTYPE_UNDEF, TEST_DEMUX_CTX,
+                                          pkt) != 1)) {
+            ok = 0;
+        }
+    }
+    for (unsigned i = 0; ok && (i < TEST_PKTS); i++) {
+        msg_t m;
+
+        msg_receive(&m);
+        ok = (m.type == TEST_LAYER_MSG_TYPE) &&
+             (m.sender_pid == gnrc_ipv6_pid) && (m.content.value == i);
+    }
+    _check("layer order", ok);
+}
+
+static void _test_messages(void)
+{
+    /* IPv6 and UDP do not know the type, so it is offered to the test layer
+     * registered after them */
+    msg_t m = { .type = TEST_MSG_TYPE, .content = { .value = 0xabcd } };
+
+    msg_send(&m, gnrc_ipv6_pid);
+    msg_receive(&m);
+    _check("messages", (m.type == TEST_MSG_TYPE) &&
+                       (m.sender_pid == gnrc_ipv6_pid) &&
+                       (m.content.value == 0xabcd));
+}
+
+static void _test_events(void)
+{
+    msg_t m;
+
+    event_post(&gnrc_event_loop_queue, &_event);
+    msg_receive(&m);
+    _check("events", (m.type == TEST_EVENT_MSG_TYPE) &&
+                     (m.sender_pid == gnrc_ipv6_pid));
+}
+
+static void _test_udp_loopback(void)
+{
+    static const char data[] = "event loop";
+    gnrc_netreg_entry_t entry = GNRC_NETREG_ENTRY_INIT_PID(TEST_PORT,
+                                                           _main_pid);
+    ipv6_addr_t dst = IPV6_ADDR_LOOPBACK;
+    gnrc_pktsnip_t *pkt;
+    msg_t m;
+    int ok = 0;
+
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &entry);
+    pkt = gnrc_pktbuf_add(NULL, data, sizeof(data), GNRC_NETTYPE_UNDEF);
+    pkt = (pkt != NULL) ? gnrc_udp_hdr_build(pkt, TEST_PORT, TEST_PORT) : NULL;
+    pkt = (pkt != NULL) ? gnrc_ipv6_hdr_build(pkt, NULL, &dst) : NULL;
+    if ((pkt != NULL) &&
+        (gnrc_netapi_dispatch_send(GNRC_NETTYPE_UDP,
+                                   GNRC_NETREG_DEMUX_CTX_ALL, pkt) == 1)) {
+        msg_receive(&m);
+        pkt = m.content.ptr;
+        ok = (m.type == GNRC_NETAPI_MSG_TYPE_RCV) &&
+             (m.sender_pid == gnrc_ipv6_pid) &&
+             (pkt->type == GNRC_NETTYPE_UNDEF) &&
+             (pkt->size == sizeof(data)) &&
+             (memcmp(pkt->data, data, sizeof(data)) == 0);
+        gnrc_pktbuf_release(pkt);
+    }
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &entry);
+    _check("udp loopback", ok);
+}
+
+int main(void)
+{
+    puts("START");
+    _main_pid = thread_getpid();
+    msg_init_queue(_main_queue, QUEUE_SIZE);
+    /* IPv6 and UDP were registered by auto_init before */
+    gnrc_event_loop_register(&_layer, GNRC_NETTYPE_UNDEF, TEST_DEMUX_CTX);
+
+    _test_shared_thread();
+    _test_layer_order();
+    _test_messages();
+    _test_events();
+    _test_udp_loopback();
+    puts(_failed ? "[FAILED]" : "[SUCCESS]");
+    return 0;
+}
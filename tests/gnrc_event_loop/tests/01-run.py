@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("START")
+    child.expect_exact("shared thread: OK")
+    child.expect_exact("layer order: OK")
+    child.expect_exact("messages: OK")
+    child.expect_exact("events: OK")
+    child.expect_exact("udp loopback: OK")
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
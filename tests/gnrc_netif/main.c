@@ -28,6 +28,7 @@
 #include "net/ipv6.h"
 #include "net/gnrc.h"
 #include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/ipv6/route_cache.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/netif.h"
 #include "net/gnrc/netif/ethernet.h"
@@ -303,6 +304,31 @@ static void test_ipv6_addr_remove__success(void)
     TEST_ASSERT_EQUAL_INT(-1, gnrc_netif_ipv6_addr_idx(netifs[0], &addr));
 }
 
+static void test_ipv6_addr_add__route_cache(void)
+{
+    static const ipv6_addr_t addr = { .u8 = NETIF0_IPV6_G };
+    unsigned gen = gnrc_ipv6_route_cache_gen;
+
+    TEST_ASSERT(0 <= gnrc_netif_ipv6_addr_add_internal(netifs[0], &addr, 64U,
+                                              GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID));
+    TEST_ASSERT(gen != gnrc_ipv6_route_cache_gen);
+}
+
+static void test_ipv6_addr_remove__route_cache(void)
+{
+    static const ipv6_addr_t addr1 = { .u8 = NETIF0_IPV6_LL };
+    static const ipv6_addr_t addr2 = { .u8 = NETIF0_IPV6_G };
+    unsigned gen;
+
+    test_ipv6_addr_add__success();
+    gen = gnrc_ipv6_route_cache_gen;
+    /* removing an address that is not assigned changes nothing */
+    gnrc_netif_ipv6_addr_remove_internal(netifs[0], &addr2);
+    TEST_ASSERT_EQUAL_INT(gen, gnrc_ipv6_route_cache_gen);
+    gnrc_netif_ipv6_addr_remove_internal(netifs[0], &addr1);
+    TEST_ASSERT(gen != gnrc_ipv6_route_cache_gen);
+}
+
 static void test_ipv6_addr_idx__empty(void)
 {
     static const ipv6_addr_t addr = { .u8 = NETIF0_IPV6_LL };
@@ -1479,6 +1505,8 @@ static Test *embunit_tests_gnrc_netif(void)
         new_TestFixture(test_ipv6_addr_add__readd_with_free_entry),
         new_TestFixture(test_ipv6_addr_remove__not_allocated),
         new_TestFixture(test_ipv6_addr_remove__success),
+        new_TestFixture(test_ipv6_addr_add__route_cache),
+        new_TestFixture(test_ipv6_addr_remove__route_cache),
         new_TestFixture(test_ipv6_addr_idx__empty),
         new_TestFixture(test_ipv6_addr_idx__unspecified_addr),
         new_TestFixture(test_ipv6_addr_idx__wrong_netif),
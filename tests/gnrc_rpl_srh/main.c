@@ -19,6 +19,7 @@
  * @}
  */
 
+#include <errno.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -28,6 +29,7 @@
 #include "net/ipv6/addr.h"
 #include "net/ipv6/ext.h"
 #include "net/ipv6/hdr.h"
+#include "net/gnrc/icmpv6.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/pktdump.h"
 #include "net/gnrc/netreg.h"
@@ -199,6 +201,78 @@ static void test_rpl_srh_nexthop_prefix_elided(void)
     TEST_ASSERT(ipv6_addr_equal(&hdr.dst, &expected2));
 }
 
+static void test_rpl_srh_final_dst_prefix_elided(void)
+{
+    static const ipv6_addr_t dst = IPV6_DST;
+    static const ipv6_addr_t expected = IPV6_ADDR2;
+    static const uint8_t a1[3] = IPV6_ADDR1_ELIDED;
+    static const uint8_t a2[3] = IPV6_ADDR2_ELIDED;
+    ipv6_addr_t final_dst;
+    gnrc_rpl_srh_t *srh;
+    uint8_t *vec;
+
+    _init_hdrs(&srh, &vec, &dst);
+    srh->len = (sizeof(a1) + sizeof(a2) + 2) / 8;
+    srh->seg_left = SRH_SEG_LEFT;
+    srh->compr = (IPV6_ELIDED_PREFIX << 4) | IPV6_ELIDED_PREFIX;
+    srh->pad_resv = 2 << 4;
+    memcpy(vec, &a1, sizeof(a1));
+    memcpy(vec + sizeof(a1), &a2, sizeof(a2));
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_rpl_srh_final_dst(&hdr, srh, &final_dst));
+    TEST_ASSERT(ipv6_addr_equal(&final_dst, &expected));
+}
+
+static void test_rpl_srh_final_dst_empty(void)
+{
+    static const ipv6_addr_t dst = IPV6_DST;
+    ipv6_addr_t final_dst;
+    gnrc_rpl_srh_t *srh;
+    uint8_t *vec;
+
+    _init_hdrs(&srh, &vec, &dst);
+    srh->len = 0;
+    srh->seg_left = SRH_SEG_LEFT;
+    TEST_ASSERT_EQUAL_INT(-EINVAL, gnrc_rpl_srh_final_dst(&hdr, srh,
+                                                          &final_dst));
+}
+
+static void test_rpl_srh_update_csum(void)
+{
+    static const ipv6_addr_t a1 = IPV6_ADDR1, a2 = IPV6_ADDR2, dst = IPV6_DST;
+    gnrc_pktsnip_t *ipv6, *icmpv6;
+    gnrc_rpl_srh_t *srh;
+    uint8_t *vec;
+    uint16_t expected;
+
+    _init_hdrs(&srh, &vec, &dst);
+    srh->len = (2 * sizeof(ipv6_addr_t)) / 8;
+    srh->seg_left = SRH_SEG_LEFT;
+    memcpy(vec, &a1, sizeof(a1));
+    memcpy(vec + sizeof(a1), &a2, sizeof(a2));
+
+    icmpv6 = gnrc_icmpv6_build(NULL, ICMPV6_ECHO_REQ, 0,
+                               sizeof(icmpv6_echo_t));
+    TEST_ASSERT_NOT_NULL(icmpv6);
+    ipv6 = gnrc_pktbuf_add(icmpv6, &hdr, sizeof(hdr), GNRC_NETTYPE_IPV6);
+    TEST_ASSERT_NOT_NULL(ipv6);
+    /* checksum with the final destination in the pseudo-header */
+    memcpy(&((ipv6_hdr_t *)ipv6->data)->dst, &a2, sizeof(a2));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_icmpv6_calc_csum(icmpv6, ipv6));
+    expected = byteorder_ntohs(((icmpv6_hdr_t *)icmpv6->data)->csum);
+
+    /* checksum with the next hop in the pseudo-header */
+    memcpy(&((ipv6_hdr_t *)ipv6->data)->dst, &dst, sizeof(dst));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_icmpv6_calc_csum(icmpv6, ipv6));
+    TEST_ASSERT(expected !=
+                byteorder_ntohs(((icmpv6_hdr_t *)icmpv6->data)->csum));
+
+    gnrc_ipv6_ext_rh_update_csum(icmpv6, ipv6->data, (ipv6_ext_rh_t *)srh);
+    TEST_ASSERT_EQUAL_INT(expected,
+                          byteorder_ntohs(((icmpv6_hdr_t *)icmpv6->data)->csum));
+    gnrc_pktbuf_release(ipv6);
+}
+
 /* tools for external interaction */
 static inline void _ipreg_usage(char *cmd)
 {
@@ -247,6 +321,9 @@ static void run_unittests(void)
         new_TestFixture(test_rpl_srh_too_many_seg_left),
         new_TestFixture(test_rpl_srh_nexthop_no_prefix_elided),
         new_TestFixture(test_rpl_srh_nexthop_prefix_elided),
+        new_TestFixture(test_rpl_srh_final_dst_prefix_elided),
+        new_TestFixture(test_rpl_srh_final_dst_empty),
+        new_TestFixture(test_rpl_srh_update_csum),
     };
 
     EMB_UNIT_TESTCALLER(rpl_srh_tests, set_up_tests, NULL, fixtures);
@@ -220,6 +220,8 @@ static void _test_entry(const gnrc_sixlowpan_rbuf_t *entry,
                         unsigned exp_current_size,
                         unsigned exp_int_start, unsigned exp_int_end)
 {
+    gnrc_sixlowpan_rbuf_int_t interval;
+
     TEST_ASSERT_NOT_NULL(entry);
     TEST_ASSERT_NOT_NULL(entry->pkt);
     TEST_ASSERT_EQUAL_INT(TEST_DATAGRAM_SIZE, entry->pkt->size);
@@ -235,10 +237,11 @@ static void _test_entry(const gnrc_sixlowpan_rbuf_t *entry,
                         "entry->super.dst != TEST_NETIF_HDR_DST");
     TEST_ASSERT_EQUAL_INT(TEST_TAG, entry->super.tag);
     TEST_ASSERT_EQUAL_INT(exp_current_size, entry->super.current_size);
-    TEST_ASSERT_NOT_NULL(entry->super.ints);
-    TEST_ASSERT_NULL(entry->super.ints->next);
-    TEST_ASSERT_EQUAL_INT(exp_int_start, entry->super.ints->start);
-    TEST_ASSERT_EQUAL_INT(exp_int_end, entry->super.ints->end);
+    TEST_ASSERT(rbuf_int_get(entry, 0, &interval));
+    TEST_ASSERT_EQUAL_INT(exp_int_start, interval.start);
+    TEST_ASSERT_EQUAL_INT(exp_int_end, interval.end);
+    /* only one fragment was received */
+    TEST_ASSERT(!rbuf_int_get(entry, interval.end + 1, &interval));
 }
 
 static void _check_pktbuf(const gnrc_sixlowpan_rbuf_t *entry)
@@ -503,6 +506,24 @@ static void test_rbuf_rm(void)
     _check_pktbuf(NULL);
 }
 
+static void test_rbuf_rm__twice(void)
+{
+    const gnrc_sixlowpan_rbuf_t *entry;
+
+    test_rbuf_add__success_first_fragment();
+    entry = _first_non_empty_rbuf();
+    TEST_ASSERT_NOT_NULL(entry);
+    gnrc_pktbuf_release(entry->pkt);
+    /* intentionally discarding const qualifier since we enter rbuf's internal
+     * context again */
+    rbuf_rm((gnrc_sixlowpan_rbuf_t *)entry);
+    rbuf_rm((gnrc_sixlowpan_rbuf_t *)entry);
+    TEST_ASSERT_NULL(_first_non_empty_rbuf());
+    /* the entry was only freed once, so the reassembly buffer can be filled
+     * completely again */
+    test_rbuf_add__full_rbuf();
+}
+
 static void test_rbuf_gc__manually(void)
 {
     gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _fragment1, sizeof(_fragment1),
@@ -557,6 +578,7 @@ static void run_unittests(void)
         new_TestFixture(test_rbuf_add__overlap_lhs),
         new_TestFixture(test_rbuf_add__overlap_rhs),
         new_TestFixture(test_rbuf_rm),
+        new_TestFixture(test_rbuf_rm__twice),
         new_TestFixture(test_rbuf_gc__manually),
         new_TestFixture(test_rbuf_gc__timed),
     };
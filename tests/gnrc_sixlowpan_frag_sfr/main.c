@@ -0,0 +1,391 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests selective fragment recovery of 6LoWPAN fragmentation
+ *
+ * This thread takes the role of both the 6LoWPAN thread and the network
+ * interface: fragments are sent to it and it handles the timer messages of
+ * selective fragment recovery.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/frag.h"
+#include "net/gnrc/sixlowpan/frag/sfr.h"
+#include "net/sixlowpan/sfr.h"
+#include "rbuf.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define TEST_NETIF_HDR_SRC      { 0xb3, 0x47, 0x60, 0x49, \
+                                  0x78, 0xfe, 0x95, 0x48 }
+#define TEST_NETIF_HDR_DST      { 0xa4, 0xf2, 0xd2, 0xc9, \
+                                  0x13, 0xb9, 0xbb, 0x25 }
+#define TEST_TAG                (0x69)
+#define TEST_PAGE               (0)
+#define TEST_DATAGRAM_SIZE      (100U)
+/* RFRAG header + 32 bytes of payload, so the datagram is sent in 4 fragments
+ * of 32, 32, 32, and 4 bytes */
+#define TEST_MAX_FRAG_SIZE      (sizeof(sixlowpan_sfr_rfrag_t) + 32U)
+#define TEST_FRAG_SIZE          (32U)
+#define TEST_FRAGS              (4U)
+#define TEST_ALL_FRAGS          (0xf0000000UL)
+/* waits for fragments that are sent right after each other */
+#define TEST_RECEIVE_TIMEOUT    (10U * US_PER_MS)
+/* waits for fragments that are sent after a missing acknowledgment */
+#define TEST_ARQ_TIMEOUT        (GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_US + \
+                                 TEST_RECEIVE_TIMEOUT)
+
+static const uint8_t _test_netif_hdr_src[] = TEST_NETIF_HDR_SRC;
+static const uint8_t _test_netif_hdr_dst[] = TEST_NETIF_HDR_DST;
+
+static gnrc_netif_t _netif;
+static msg_t _msg_queue[8];
+
+static void _set_up(void)
+{
+    msg_t msg;
+
+    while (msg_try_receive(&msg) > 0) {}
+    rbuf_reset();
+    gnrc_sixlowpan_frag_sfr_reset();
+    gnrc_pktbuf_init();
+    /* fragments are sent to this thread */
+    _netif.pid = thread_getpid();
+    _netif.sixlo.max_frag_size = TEST_MAX_FRAG_SIZE;
+}
+
+static gnrc_pktsnip_t *_netif_hdr(const uint8_t *src, const uint8_t *dst)
+{
+    gnrc_pktsnip_t *netif = gnrc_netif_hdr_build(src,
+                                                 sizeof(_test_netif_hdr_src),
+                                                 dst,
+                                                 sizeof(_test_netif_hdr_dst));
+
+    if (netif != NULL) {
+        ((gnrc_netif_hdr_t *)netif->data)->if_pid = _netif.pid;
+    }
+    return netif;
+}
+
+/* starts sending a datagram with selective fragment recovery */
+static gnrc_sixlowpan_msg_frag_t *_send_datagram(void)
+{
+    gnrc_sixlowpan_msg_frag_t *fragment_msg;
+    gnrc_pktsnip_t *pkt;
+
+    pkt = gnrc_pktbuf_add(NULL, NULL, TEST_DATAGRAM_SIZE,
+                          GNRC_NETTYPE_SIXLOWPAN);
+    if (pkt == NULL) {
+        return NULL;
+    }
+    memset(pkt->data, 0x54, pkt->size);
+    fragment_msg = gnrc_sixlowpan_msg_frag_get();
+    if (fragment_msg == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    fragment_msg->pkt = _netif_hdr(_test_netif_hdr_src, _test_netif_hdr_dst);
+    if (fragment_msg->pkt == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    fragment_msg->pkt->next = pkt;
+    fragment_msg->datagram_size = TEST_DATAGRAM_SIZE;
+    fragment_msg->tag = TEST_TAG;
+    fragment_msg->offset = 0;
+    if (!gnrc_sixlowpan_frag_sfr_send(&_netif, fragment_msg,
+                                      TEST_DATAGRAM_SIZE)) {
+        gnrc_pktbuf_release(fragment_msg->pkt);
+        fragment_msg->pkt = NULL;
+        return NULL;
+    }
+    return fragment_msg;
+}
+
+/* receives the next packet sent over the interface and handles the timer
+ * messages of selective fragment recovery in the meantime, like the 6LoWPAN
+ * thread would */
+static gnrc_pktsnip_t *_recv_sent(uint32_t timeout)
+{
+    msg_t msg;
+
+    while (xtimer_msg_receive_timeout(&msg, timeout) >= 0) {
+        switch (msg.type) {
+            case GNRC_NETAPI_MSG_TYPE_SND:
+                return msg.content.ptr;
+            case GNRC_SIXLOWPAN_MSG_FRAG_SND:
+                gnrc_sixlowpan_frag_send(NULL, msg.content.ptr, TEST_PAGE);
+                break;
+            case GNRC_SIXLOWPAN_MSG_FRAG_SFR_ARQ_TIMEOUT:
+                gnrc_sixlowpan_frag_sfr_arq_timeout(msg.content.ptr);
+                break;
+            default:
+                break;
+        }
+    }
+    return NULL;
+}
+
+/* receives the next fragment sent to the destination and checks that it is
+ * the fragment with sequence seq */
+static void _recv_rfrag(uint32_t timeout, unsigned seq, bool ack_req)
+{
+    gnrc_pktsnip_t *pkt = _recv_sent(timeout);
+    gnrc_netif_hdr_t *netif_hdr;
+    sixlowpan_sfr_rfrag_t *hdr;
+    unsigned frag_size = (seq < (TEST_FRAGS - 1))
+                       ? TEST_FRAG_SIZE
+                       : (TEST_DATAGRAM_SIZE % TEST_FRAG_SIZE);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETTYPE_NETIF, pkt->type);
+    netif_hdr = pkt->data;
+    TEST_ASSERT_EQUAL_INT(sizeof(_test_netif_hdr_dst),
+                          netif_hdr->dst_l2addr_len);
+    TEST_ASSERT_MESSAGE(memcmp(gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                               _test_netif_hdr_dst,
+                               sizeof(_test_netif_hdr_dst)) == 0,
+                        "Fragment not sent to destination");
+    TEST_ASSERT_NOT_NULL(pkt->next);
+    hdr = pkt->next->data;
+    TEST_ASSERT(sixlowpan_sfr_rfrag_is(&hdr->base));
+    TEST_ASSERT_EQUAL_INT(TEST_TAG, hdr->base.tag);
+    TEST_ASSERT_EQUAL_INT(seq, sixlowpan_sfr_rfrag_get_seq(hdr));
+    TEST_ASSERT(ack_req == sixlowpan_sfr_rfrag_ack_req(hdr));
+    TEST_ASSERT_EQUAL_INT(frag_size, sixlowpan_sfr_rfrag_get_frag_size(hdr));
+    TEST_ASSERT_EQUAL_INT((seq == 0) ? TEST_DATAGRAM_SIZE
+                                     : (seq * TEST_FRAG_SIZE),
+                          sixlowpan_sfr_rfrag_get_offset(hdr));
+    gnrc_pktbuf_release(pkt);
+}
+
+/* acknowledges fragments of the test datagram from its destination */
+static void _recv_ack(uint32_t bitmap)
+{
+    gnrc_pktsnip_t *pkt, *netif;
+
+    netif = _netif_hdr(_test_netif_hdr_dst, _test_netif_hdr_src);
+    TEST_ASSERT_NOT_NULL(netif);
+    pkt = gnrc_pktbuf_add(netif, NULL, sizeof(sixlowpan_sfr_ack_t),
+                          GNRC_NETTYPE_SIXLOWPAN);
+    TEST_ASSERT_NOT_NULL(pkt);
+    sixlowpan_sfr_ack_init(pkt->data, TEST_TAG, bitmap);
+    gnrc_sixlowpan_frag_sfr_recv(pkt, NULL, TEST_PAGE);
+}
+
+/* receives all fragments of the datagram, in order, with only the last one
+ * requesting an acknowledgment */
+static void _recv_all(void)
+{
+    for (unsigned i = 0; i < TEST_FRAGS; i++) {
+        _recv_rfrag(TEST_RECEIVE_TIMEOUT, i, (i == (TEST_FRAGS - 1)));
+    }
+}
+
+static void _test_released(const gnrc_sixlowpan_msg_frag_t *fragment_msg)
+{
+    /* nothing is sent anymore */
+    TEST_ASSERT_NULL(_recv_sent(TEST_ARQ_TIMEOUT));
+    TEST_ASSERT_NULL(fragment_msg->pkt);
+    TEST_ASSERT_NULL(gnrc_sixlowpan_msg_frag_get_sfr(TEST_TAG));
+    TEST_ASSERT_MESSAGE(gnrc_pktbuf_is_empty(), "Packet buffer is not empty");
+}
+
+static void test_sfr_send__ack_all(void)
+{
+    gnrc_sixlowpan_msg_frag_t *fragment_msg;
+
+    TEST_ASSERT_NOT_NULL((fragment_msg = _send_datagram()));
+    _recv_all();
+    _recv_ack(TEST_ALL_FRAGS);
+    _test_released(fragment_msg);
+}
+
+static void test_sfr_send__ack_missing(void)
+{
+    gnrc_sixlowpan_msg_frag_t *fragment_msg;
+
+    TEST_ASSERT_NOT_NULL((fragment_msg = _send_datagram()));
+    _recv_all();
+    /* only the missing fragments are sent again, the last one requesting an
+     * acknowledgment */
+    _recv_ack(TEST_ALL_FRAGS & ~(sixlowpan_sfr_ack_bit(1) |
+                                 sixlowpan_sfr_ack_bit(3)));
+    _recv_rfrag(TEST_RECEIVE_TIMEOUT, 1, false);
+    _recv_rfrag(TEST_RECEIVE_TIMEOUT, 3, true);
+    TEST_ASSERT_NULL(_recv_sent(TEST_RECEIVE_TIMEOUT));
+    /* bitmaps are cumulative, so all fragments set here */
+    _recv_ack(TEST_ALL_FRAGS);
+    _test_released(fragment_msg);
+}
+
+static void test_sfr_send__ack_unsolicited(void)
+{
+    gnrc_sixlowpan_msg_frag_t *fragment_msg;
+
+    TEST_ASSERT_NOT_NULL((fragment_msg = _send_datagram()));
+    _recv_rfrag(TEST_RECEIVE_TIMEOUT, 0, false);
+    /* an acknowledgment for the whole datagram, before it was requested, is
+     * ignored */
+    _recv_ack(TEST_ALL_FRAGS);
+    TEST_ASSERT_NOT_NULL(fragment_msg->pkt);
+    for (unsigned i = 1; i < TEST_FRAGS; i++) {
+        _recv_rfrag(TEST_RECEIVE_TIMEOUT, i, (i == (TEST_FRAGS - 1)));
+    }
+    _recv_ack(TEST_ALL_FRAGS);
+    _test_released(fragment_msg);
+}
+
+static void test_sfr_send__arq_timeout(void)
+{
+    gnrc_sixlowpan_msg_frag_t *fragment_msg;
+
+    TEST_ASSERT_NOT_NULL((fragment_msg = _send_datagram()));
+    _recv_all();
+    _recv_ack(sixlowpan_sfr_ack_bit(0) | sixlowpan_sfr_ack_bit(1));
+    _recv_rfrag(TEST_RECEIVE_TIMEOUT, 2, false);
+    _recv_rfrag(TEST_RECEIVE_TIMEOUT, 3, true);
+    /* without an acknowledgment, all unacknowledged fragments are sent
+     * again */
+    _recv_rfrag(TEST_ARQ_TIMEOUT, 2, false);
+    _recv_rfrag(TEST_RECEIVE_TIMEOUT, 3, true);
+    _recv_ack(TEST_ALL_FRAGS);
+    _test_released(fragment_msg);
+}
+
+static void test_sfr_send__arq_timeout_stale(void)
+{
+    gnrc_sixlowpan_msg_frag_t *fragment_msg;
+
+    TEST_ASSERT_NOT_NULL((fragment_msg = _send_datagram()));
+    _recv_all();
+    _recv_ack(TEST_ALL_FRAGS & ~sixlowpan_sfr_ack_bit(2));
+    _recv_rfrag(TEST_RECEIVE_TIMEOUT, 2, true);
+    /* timeout of the first acknowledgment request that was already queued
+     * when the acknowledgment arrived */
+    gnrc_sixlowpan_frag_sfr_arq_timeout(fragment_msg);
+    TEST_ASSERT_NULL(_recv_sent(TEST_RECEIVE_TIMEOUT));
+    /* the timeout of the current request still resends the fragment */
+    _recv_rfrag(TEST_ARQ_TIMEOUT, 2, true);
+    _recv_ack(TEST_ALL_FRAGS);
+    _test_released(fragment_msg);
+}
+
+static void test_sfr_send__arq_timeout_give_up(void)
+{
+    gnrc_sixlowpan_msg_frag_t *fragment_msg;
+
+    TEST_ASSERT_NOT_NULL((fragment_msg = _send_datagram()));
+    _recv_all();
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_SFR_FRAG_RETRIES; i++) {
+        /* all fragments are sent again after each timeout */
+        _recv_rfrag(TEST_ARQ_TIMEOUT, 0, false);
+        for (unsigned j = 1; j < TEST_FRAGS; j++) {
+            _recv_rfrag(TEST_RECEIVE_TIMEOUT, j, (j == (TEST_FRAGS - 1)));
+        }
+    }
+    /* the datagram is released after the last retry timed out */
+    _test_released(fragment_msg);
+}
+
+static void test_sfr_send__abort(void)
+{
+    gnrc_sixlowpan_msg_frag_t *fragment_msg;
+
+    TEST_ASSERT_NOT_NULL((fragment_msg = _send_datagram()));
+    _recv_all();
+    /* an empty bitmap aborts the datagram */
+    _recv_ack(0);
+    _test_released(fragment_msg);
+}
+
+static void test_sfr_recv__ack_bitmap(void)
+{
+    gnrc_pktsnip_t *pkt, *netif;
+    gnrc_netif_hdr_t *netif_hdr;
+    sixlowpan_sfr_ack_t *ack;
+
+    /* first and third fragment, the latter requesting an acknowledgment */
+    for (unsigned seq = 0; seq < 3; seq += 2) {
+        sixlowpan_sfr_rfrag_t *hdr;
+
+        netif = _netif_hdr(_test_netif_hdr_dst, _test_netif_hdr_src);
+        TEST_ASSERT_NOT_NULL(netif);
+        pkt = gnrc_pktbuf_add(netif, NULL,
+                              sizeof(sixlowpan_sfr_rfrag_t) + TEST_FRAG_SIZE,
+                              GNRC_NETTYPE_SIXLOWPAN);
+        TEST_ASSERT_NOT_NULL(pkt);
+        hdr = pkt->data;
+        sixlowpan_sfr_rfrag_init(hdr, TEST_TAG, seq, TEST_FRAG_SIZE,
+                                 (seq == 0) ? TEST_DATAGRAM_SIZE
+                                            : (seq * TEST_FRAG_SIZE));
+        if (seq > 0) {
+            sixlowpan_sfr_rfrag_set_ack_req(hdr);
+        }
+        memset(hdr + 1, 0x54, TEST_FRAG_SIZE);
+        gnrc_sixlowpan_frag_sfr_recv(pkt, NULL, TEST_PAGE);
+    }
+    /* the acknowledgment reports both received fragments to the sender */
+    pkt = _recv_sent(TEST_RECEIVE_TIMEOUT);
+    TEST_ASSERT_NOT_NULL(pkt);
+    netif_hdr = pkt->data;
+    TEST_ASSERT_MESSAGE(memcmp(gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                               _test_netif_hdr_dst,
+                               sizeof(_test_netif_hdr_dst)) == 0,
+                        "Acknowledgment not sent to sender");
+    TEST_ASSERT_NOT_NULL(pkt->next);
+    TEST_ASSERT_EQUAL_INT(sizeof(sixlowpan_sfr_ack_t), pkt->next->size);
+    ack = pkt->next->data;
+    TEST_ASSERT(sixlowpan_sfr_ack_is(&ack->base));
+    TEST_ASSERT_EQUAL_INT(TEST_TAG, ack->base.tag);
+    TEST_ASSERT(byteorder_ntohl(ack->bitmap) ==
+                (sixlowpan_sfr_ack_bit(0) | sixlowpan_sfr_ack_bit(2)));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_NULL(_recv_sent(TEST_RECEIVE_TIMEOUT));
+}
+
+static void run_unittests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_sfr_send__ack_all),
+        new_TestFixture(test_sfr_send__ack_missing),
+        new_TestFixture(test_sfr_send__ack_unsolicited),
+        new_TestFixture(test_sfr_send__arq_timeout),
+        new_TestFixture(test_sfr_send__arq_timeout_stale),
+        new_TestFixture(test_sfr_send__arq_timeout_give_up),
+        new_TestFixture(test_sfr_send__abort),
+        new_TestFixture(test_sfr_recv__ack_bitmap),
+    };
+
+    EMB_UNIT_TESTCALLER(sixlo_frag_sfr_tests, _set_up, NULL, fixtures);
+    TESTS_START();
+    TESTS_RUN((Test *)&sixlo_frag_sfr_tests);
+    TESTS_END();
+}
+
+int main(void)
+{
+    /* no auto-init, so xtimer needs to be initialized manually*/
+    xtimer_init();
+    msg_init_queue(_msg_queue, sizeof(_msg_queue) / sizeof(_msg_queue[0]));
+    run_unittests();
+    return 0;
+}
@@ -0,0 +1,308 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Stress test for the 6LoWPAN reassembly buffer with many
+ *              interleaved senders
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/netreg.h"
+#include "net/sixlowpan.h"
+#include "rbuf.h"
+#include "xtimer.h"
+
+#define TEST_SENDERS            (RBUF_SIZE)
+#define TEST_NETIF_IFACE        (9)
+#define TEST_TAG                (0x690e)
+#define TEST_PAGE               (0)
+#define TEST_RECEIVE_TIMEOUT    (100U)
+#define TEST_FRAG_SIZE          (48U)
+#define TEST_FRAGS              (4U)
+#define TEST_DATAGRAM_SIZE      (TEST_FRAGS * TEST_FRAG_SIZE)
+#define TEST_MSG_QUEUE_SIZE     (64U)   /* power of 2 >= TEST_SENDERS */
+
+static struct {
+    gnrc_netif_hdr_t hdr;
+    uint8_t src[IEEE802154_LONG_ADDRESS_LEN];
+    uint8_t dst[IEEE802154_LONG_ADDRESS_LEN];
+} _netif_hdrs[TEST_SENDERS + 1];
+
+static const uint8_t _test_dst[] = { 0xa4, 0xf2, 0xd2, 0xc9,
+                                     0x13, 0xb9, 0xbb, 0x25 };
+static msg_t _msg_queue[TEST_MSG_QUEUE_SIZE];
+static gnrc_netreg_entry_t _reg = GNRC_NETREG_ENTRY_INIT_PID(
+        GNRC_NETREG_DEMUX_CTX_ALL, KERNEL_PID_UNDEF
+    );
+
+/* two senders share a source address, but use different tags */
+static inline uint8_t _src_id(unsigned sender)
+{
+    return sender / 2;
+}
+
+static inline uint16_t _tag(unsigned sender)
+{
+    return TEST_TAG + (sender % 2);
+}
+
+static inline uint8_t _byte(unsigned sender, unsigned offset)
+{
+    return (uint8_t)((sender * 7) + offset);
+}
+
+static void _set_up(void)
+{
+    rbuf_reset();
+    gnrc_pktbuf_init();
+    for (unsigned i = 0; i <= TEST_SENDERS; i++) {
+        uint8_t src[] = { 0xb3, 0x47, 0x60, 0x49, 0x78, 0xfe, 0x95,
+                          _src_id(i) };
+
+        gnrc_netif_hdr_init(&_netif_hdrs[i].hdr, sizeof(src),
+                            sizeof(_test_dst));
+        _netif_hdrs[i].hdr.if_pid = TEST_NETIF_IFACE;
+        gnrc_netif_hdr_set_src_addr(&_netif_hdrs[i].hdr, src, sizeof(src));
+        gnrc_netif_hdr_set_dst_addr(&_netif_hdrs[i].hdr, (uint8_t *)_test_dst,
+                                    sizeof(_test_dst));
+    }
+    _reg.target.pid = sched_active_pid;
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &_reg);
+}
+
+static void _tear_down(void)
+{
+    gnrc_netreg_unregister(GNRC_NETTYPE_UNDEF, &_reg);
+}
+
+static gnrc_pktsnip_t *_fragment(unsigned sender, unsigned idx)
+{
+    size_t hdr_len = (idx == 0) ? (sizeof(sixlowpan_frag_t) + 1)
+                                : sizeof(sixlowpan_frag_n_t);
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, hdr_len + TEST_FRAG_SIZE,
+                                          GNRC_NETTYPE_SIXLOWPAN);
+    sixlowpan_frag_n_t *hdr;
+    uint8_t *data;
+
+    if (pkt == NULL) {
+        return NULL;
+    }
+    hdr = pkt->data;
+    hdr->disp_size = byteorder_htons(TEST_DATAGRAM_SIZE);
+    hdr->tag = byteorder_htons(_tag(sender));
+    if (idx == 0) {
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+        data = ((uint8_t *)pkt->data) + sizeof(sixlowpan_frag_t);
+        *(data++) = SIXLOWPAN_UNCOMP;
+    }
+    else {
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+        hdr->offset = (idx * TEST_FRAG_SIZE) / 8;
+        data = (uint8_t *)(hdr + 1);
+    }
+    for (unsigned i = 0; i < TEST_FRAG_SIZE; i++) {
+        data[i] = _byte(sender, (idx * TEST_FRAG_SIZE) + i);
+    }
+    return pkt;
+}
+
+static void _add_fragment(unsigned sender, unsigned idx)
+{
+    gnrc_pktsnip_t *pkt = _fragment(sender, idx);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    rbuf_add(&_netif_hdrs[sender].hdr, pkt, idx * TEST_FRAG_SIZE, TEST_PAGE);
+}
+
+static const gnrc_sixlowpan_rbuf_t *_find_entry(unsigned sender)
+{
+    const gnrc_sixlowpan_rbuf_t *rbuf = rbuf_array();
+
+    for (unsigned i = 0; i < RBUF_SIZE; i++) {
+        if (!rbuf_entry_empty(&rbuf[i]) &&
+            (rbuf[i].super.tag == _tag(sender)) &&
+            (rbuf[i].super.src[IEEE802154_LONG_ADDRESS_LEN - 1] ==
+             _src_id(sender))) {
+            return &rbuf[i];
+        }
+    }
+    return NULL;
+}
+
+static void _release_entries(void)
+{
+    const gnrc_sixlowpan_rbuf_t *rbuf = rbuf_array();
+
+    for (unsigned i = 0; i < RBUF_SIZE; i++) {
+        if (!rbuf_entry_empty(&rbuf[i])) {
+            gnrc_pktbuf_release(rbuf[i].pkt);
+        }
+    }
+}
+
+/* returns the sender of a reassembled datagram, TEST_SENDERS if unknown */
+static unsigned _sender(gnrc_pktsnip_t *datagram)
+{
+    gnrc_netif_hdr_t *netif_hdr;
+    const uint8_t *src;
+
+    if ((datagram->next == NULL) ||
+        (datagram->next->type != GNRC_NETTYPE_NETIF)) {
+        return TEST_SENDERS;
+    }
+    netif_hdr = datagram->next->data;
+    src = gnrc_netif_hdr_get_src_addr(netif_hdr);
+    for (unsigned i = 0; i < TEST_SENDERS; i++) {
+        if ((src[netif_hdr->src_l2addr_len - 1] == _src_id(i)) &&
+            (_byte(i, 0) == ((uint8_t *)datagram->data)[0])) {
+            return i;
+        }
+    }
+    return TEST_SENDERS;
+}
+
+static void _test_datagram(gnrc_pktsnip_t *datagram, unsigned sender)
+{
+    const uint8_t *data = datagram->data;
+
+    TEST_ASSERT_EQUAL_INT(TEST_DATAGRAM_SIZE, datagram->size);
+    for (unsigned i = 0; i < TEST_DATAGRAM_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(_byte(sender, i), data[i]);
+    }
+}
+
+static void _test_all_received(void)
+{
+    bool received[TEST_SENDERS] = { false };
+
+    for (unsigned i = 0; i < TEST_SENDERS; i++) {
+        msg_t msg = { .type = 0U };
+        gnrc_pktsnip_t *datagram;
+        unsigned sender;
+
+        TEST_ASSERT_MESSAGE(
+                xtimer_msg_receive_timeout(&msg, TEST_RECEIVE_TIMEOUT) >= 0,
+                "Receiving reassembled datagram timed out"
+            );
+        TEST_ASSERT_EQUAL_INT(GNRC_NETAPI_MSG_TYPE_RCV, msg.type);
+        datagram = msg.content.ptr;
+        TEST_ASSERT_NOT_NULL(datagram);
+        sender = _sender(datagram);
+        TEST_ASSERT(sender < TEST_SENDERS);
+        TEST_ASSERT_MESSAGE(!received[sender], "Datagram received twice");
+        received[sender] = true;
+        _test_datagram(datagram, sender);
+        gnrc_pktbuf_release(datagram);
+    }
+    TEST_ASSERT_NULL(_find_entry(0));
+    TEST_ASSERT_MESSAGE(gnrc_pktbuf_is_empty(), "Packet buffer is not empty");
+}
+
+static void test_rbuf_add__interleaved(void)
+{
+    /* every sender sends its fragments in a different order */
+    for (unsigned round = 0; round < TEST_FRAGS; round++) {
+        for (unsigned sender = 0; sender < TEST_SENDERS; sender++) {
+            _add_fragment(sender, (sender + round) % TEST_FRAGS);
+        }
+    }
+    _test_all_received();
+}
+
+static void test_rbuf_add__interleaved_duplicates(void)
+{
+    for (unsigned round = 0; round < TEST_FRAGS; round++) {
+        for (unsigned sender = 0; sender < TEST_SENDERS; sender++) {
+            unsigned idx = (TEST_FRAGS - 1) - ((sender + round) % TEST_FRAGS);
+
+            _add_fragment(sender, idx);
+            if (round < (TEST_FRAGS - 1)) {
+                /* duplicates must not complete or discard the datagram */
+                _add_fragment(sender, idx);
+            }
+        }
+    }
+    _test_all_received();
+}
+
+static void test_rbuf_add__full_evicts_oldest(void)
+{
+    for (unsigned sender = 0; sender < TEST_SENDERS; sender++) {
+        _add_fragment(sender, 1);
+    }
+    /* refresh the entry of sender 0, so sender 1 is now the oldest */
+    _add_fragment(0, 2);
+    /* datagram of a new sender does not fit anymore */
+    _add_fragment(TEST_SENDERS, 1);
+    TEST_ASSERT_NOT_NULL(_find_entry(0));
+    TEST_ASSERT_NULL(_find_entry(1));
+    for (unsigned sender = 2; sender <= TEST_SENDERS; sender++) {
+        TEST_ASSERT_NOT_NULL(_find_entry(sender));
+    }
+    _release_entries();
+    TEST_ASSERT_MESSAGE(gnrc_pktbuf_is_empty(), "Packet buffer is not empty");
+}
+
+static void test_rbuf_gc__oldest_first(void)
+{
+    gnrc_sixlowpan_rbuf_t *entry;
+
+    for (unsigned sender = 0; sender < TEST_SENDERS; sender++) {
+        _add_fragment(sender, 1);
+    }
+    /* discarding const qualifier intentionally to override `arrival` */
+    entry = (gnrc_sixlowpan_rbuf_t *)_find_entry(0);
+    TEST_ASSERT_NOT_NULL(entry);
+    entry->super.arrival -= RBUF_TIMEOUT;
+    rbuf_gc();
+    TEST_ASSERT_NULL(_find_entry(0));
+    for (unsigned sender = 1; sender < TEST_SENDERS; sender++) {
+        TEST_ASSERT_NOT_NULL(_find_entry(sender));
+    }
+    /* the freed entry can be reused */
+    _add_fragment(TEST_SENDERS, 1);
+    TEST_ASSERT_NOT_NULL(_find_entry(TEST_SENDERS));
+    TEST_ASSERT_NOT_NULL(_find_entry(1));
+    _release_entries();
+    TEST_ASSERT_MESSAGE(gnrc_pktbuf_is_empty(), "Packet buffer is not empty");
+}
+
+static void run_unittests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_rbuf_add__interleaved),
+        new_TestFixture(test_rbuf_add__interleaved_duplicates),
+        new_TestFixture(test_rbuf_add__full_evicts_oldest),
+        new_TestFixture(test_rbuf_gc__oldest_first),
+    };
+
+    EMB_UNIT_TESTCALLER(sixlo_frag_stress_tests, _set_up, _tear_down,
+                        fixtures);
+    TESTS_START();
+    TESTS_RUN((Test *)&sixlo_frag_stress_tests);
+    TESTS_END();
+}
+
+int main(void)
+{
+    /* no auto-init, so xtimer needs to be initialized manually*/
+    xtimer_init();
+    /* every sender's datagram is dispatched to this thread */
+    msg_init_queue(_msg_queue, TEST_MSG_QUEUE_SIZE);
+    run_unittests();
+    return 0;
+}
@@ -0,0 +1,635 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the virtual reassembly buffer of 6LoWPAN fragmentation
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#include "net/netdev_test.h"
+#include "net/sixlowpan.h"
+#include "rbuf.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define TEST_NETIF_HDR_SRC      { 0xb3, 0x47, 0x60, 0x49, \
+                                  0x78, 0xfe, 0x95, 0x48 }
+#define TEST_NETIF_HDR_DST      { 0xa4, 0xf2, 0xd2, 0xc9, \
+                                  0x13, 0xb9, 0xbb, 0x25 }
+#define TEST_NEXT_HOP           { 0x36, 0x11, 0x7e, 0x4d, \
+                                  0xc2, 0x08, 0xf0, 0x9a }
+#define TEST_NETIF_IFACE        (9)
+#define TEST_TAG                (0x690e)
+#define TEST_PAGE               (0)
+#define TEST_RECEIVE_TIMEOUT    (100U)
+#define TEST_DATAGRAM_SIZE      (348U)
+#define TEST_FRAGMENT2_OFFSET   (96U)
+#define TEST_FRAGMENT2_SIZE     (96U)
+#define TEST_MAX_FRAG_SIZE      (102U)
+#define TEST_IPV6_SRC           { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, \
+                                  0, 0, 0, 0, 0, 0, 0, 0x01 }
+#define TEST_IPV6_DST           { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, \
+                                  0, 0, 0, 0, 0, 0, 0, 0x02 }
+#define TEST_IPV6_NH            (PROTNUM_IPV6_NONXT)
+#define TEST_IPV6_HL            (64U)
+/* IPHC with traffic class and flow label elided, next header and hop limit
+ * inline and both addresses carried inline */
+#define TEST_IPHC_LEN           (SIXLOWPAN_IPHC_HDR_LEN + 2U + \
+                                 (2U * sizeof(ipv6_addr_t)))
+/* the uncompressed first fragment ends where the second fragment starts */
+#define TEST_FRAGMENT1_PAYLOAD  (TEST_FRAGMENT2_OFFSET - sizeof(ipv6_hdr_t))
+
+static const uint8_t _test_netif_hdr_src[] = TEST_NETIF_HDR_SRC;
+static const uint8_t _test_netif_hdr_dst[] = TEST_NETIF_HDR_DST;
+static const uint8_t _test_next_hop[] = TEST_NEXT_HOP;
+static struct {
+    gnrc_netif_hdr_t hdr;
+    uint8_t src[GNRC_NETIF_HDR_L2ADDR_MAX_LEN];
+    uint8_t dst[GNRC_NETIF_HDR_L2ADDR_MAX_LEN];
+} _test_netif_hdr;
+
+static const ipv6_addr_t _test_ipv6_src = { .u8 = TEST_IPV6_SRC };
+static const ipv6_addr_t _test_ipv6_dst = { .u8 = TEST_IPV6_DST };
+
+static gnrc_sixlowpan_rbuf_base_t _base;
+static gnrc_netif_t _out_netif;
+static msg_t _msg_queue[4];
+static kernel_pid_t _main_pid;
+
+/* forwarding via IPHC needs an actual router interface */
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _netdev;
+static gnrc_netif_t *_netif;
+
+static void _set_up(void)
+{
+    rbuf_reset();
+    gnrc_sixlowpan_frag_vrb_reset();
+    gnrc_pktbuf_init();
+    gnrc_netif_hdr_init(&_test_netif_hdr.hdr,
+                        GNRC_NETIF_HDR_L2ADDR_MAX_LEN,
+                        GNRC_NETIF_HDR_L2ADDR_MAX_LEN);
+    _test_netif_hdr.hdr.if_pid = TEST_NETIF_IFACE;
+    gnrc_netif_hdr_set_src_addr(&_test_netif_hdr.hdr,
+                                (uint8_t *)_test_netif_hdr_src,
+                                sizeof(_test_netif_hdr_src));
+    gnrc_netif_hdr_set_dst_addr(&_test_netif_hdr.hdr,
+                                (uint8_t *)_test_netif_hdr_dst,
+                                sizeof(_test_netif_hdr_dst));
+    memset(&_base, 0, sizeof(_base));
+    memcpy(_base.src, _test_netif_hdr_src, sizeof(_test_netif_hdr_src));
+    memcpy(_base.dst, _test_netif_hdr_dst, sizeof(_test_netif_hdr_dst));
+    _base.src_len = sizeof(_test_netif_hdr_src);
+    _base.dst_len = sizeof(_test_netif_hdr_dst);
+    _base.tag = TEST_TAG;
+    _base.datagram_size = TEST_DATAGRAM_SIZE;
+    /* fragments for the next hop are sent to this thread */
+    _out_netif.pid = thread_getpid();
+}
+
+static gnrc_sixlowpan_frag_vrb_t *_get(void)
+{
+    return gnrc_sixlowpan_frag_vrb_get(_base.src, _base.src_len,
+                                       _base.dst, _base.dst_len,
+                                       _base.datagram_size, _base.tag);
+}
+
+static gnrc_pktsnip_t *_fragment_n(uint16_t offset, size_t size)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL,
+                                          sizeof(sixlowpan_frag_n_t) + size,
+                                          GNRC_NETTYPE_SIXLOWPAN);
+    sixlowpan_frag_n_t *hdr;
+
+    if (pkt == NULL) {
+        return NULL;
+    }
+    hdr = pkt->data;
+    hdr->disp_size = byteorder_htons(TEST_DATAGRAM_SIZE);
+    hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+    hdr->tag = byteorder_htons(TEST_TAG);
+    hdr->offset = offset / 8;
+    memset(hdr + 1, 0x54, size);
+    return pkt;
+}
+
+/* receives a fragment sent to the next hop */
+static gnrc_pktsnip_t *_recv_forwarded(void)
+{
+    msg_t msg;
+
+    if ((xtimer_msg_receive_timeout(&msg, TEST_RECEIVE_TIMEOUT) < 0) ||
+        (msg.type != GNRC_NETAPI_MSG_TYPE_SND)) {
+        return NULL;
+    }
+    return msg.content.ptr;
+}
+
+static void _test_forwarded(gnrc_pktsnip_t *pkt, uint16_t out_tag,
+                            uint16_t offset)
+{
+    gnrc_netif_hdr_t *netif_hdr;
+    sixlowpan_frag_n_t *hdr;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETTYPE_NETIF, pkt->type);
+    netif_hdr = pkt->data;
+    TEST_ASSERT_EQUAL_INT(_out_netif.pid, netif_hdr->if_pid);
+    TEST_ASSERT_EQUAL_INT(sizeof(_test_next_hop), netif_hdr->dst_l2addr_len);
+    TEST_ASSERT_MESSAGE(memcmp(gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                               _test_next_hop, sizeof(_test_next_hop)) == 0,
+                        "Fragment not sent to next hop");
+    TEST_ASSERT_NOT_NULL(pkt->next);
+    hdr = pkt->next->data;
+    TEST_ASSERT(sixlowpan_frag_is((sixlowpan_frag_t *)hdr));
+    TEST_ASSERT_EQUAL_INT(out_tag, byteorder_ntohs(hdr->tag));
+    TEST_ASSERT_EQUAL_INT(TEST_DATAGRAM_SIZE,
+                          byteorder_ntohs(hdr->disp_size) &
+                          SIXLOWPAN_FRAG_SIZE_MASK);
+    TEST_ASSERT_EQUAL_INT(offset / 8, hdr->offset);
+}
+
+static void _netif_init(gnrc_netif_t *netif)
+{
+    /* 6LoWPAN router interface */
+    netif->flags |= GNRC_NETIF_FLAGS_6LO_HC | GNRC_NETIF_FLAGS_IPV6_FORWARDING;
+    netif->sixlo.max_frag_size = TEST_MAX_FRAG_SIZE;
+}
+
+static int _netif_send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    (void)netif;
+    /* hand fragments over to the test, drop everything else the stack sends
+     * (e.g. router advertisements) */
+    if ((pkt->next != NULL) && (pkt->next->type == GNRC_NETTYPE_SIXLOWPAN) &&
+        sixlowpan_frag_is(pkt->next->data)) {
+        msg_t msg = { .type = GNRC_NETAPI_MSG_TYPE_SND,
+                      .content = { .ptr = pkt } };
+
+        msg_send(&msg, _main_pid);
+        return 0;
+    }
+    gnrc_pktbuf_release(pkt);
+    return 0;
+}
+
+static gnrc_pktsnip_t *_netif_recv(gnrc_netif_t *netif)
+{
+    (void)netif;
+    return NULL;
+}
+
+static int _netdev_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_TEST;
+    return sizeof(uint16_t);
+}
+
+static const gnrc_netif_ops_t _netif_ops = {
+    .init = _netif_init,
+    .send = _netif_send,
+    .recv = _netif_recv,
+    .get = gnrc_netif_get_from_netdev,
+    .set = gnrc_netif_set_from_netdev,
+};
+
+/* builds a first fragment with an IPHC compressed IPv6 header as received by
+ * _netif */
+static gnrc_pktsnip_t *_fragment_1_iphc(gnrc_netif_hdr_t **netif_hdr)
+{
+    gnrc_pktsnip_t *pkt, *netif;
+    sixlowpan_frag_t *hdr;
+    uint8_t *iphc;
+
+    netif = gnrc_netif_hdr_build(_test_netif_hdr_src,
+                                 sizeof(_test_netif_hdr_src),
+                                 _test_netif_hdr_dst,
+                                 sizeof(_test_netif_hdr_dst));
+    if (netif == NULL) {
+        return NULL;
+    }
+    *netif_hdr = netif->data;
+    (*netif_hdr)->if_pid = _netif->pid;
+    pkt = gnrc_pktbuf_add(netif, NULL,
+                          sizeof(sixlowpan_frag_t) + TEST_IPHC_LEN +
+                          TEST_FRAGMENT1_PAYLOAD, GNRC_NETTYPE_SIXLOWPAN);
+    if (pkt == NULL) {
+        gnrc_pktbuf_release(netif);
+        return NULL;
+    }
+    hdr = pkt->data;
+    hdr->disp_size = byteorder_htons(TEST_DATAGRAM_SIZE);
+    hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+    hdr->tag = byteorder_htons(TEST_TAG);
+    iphc = (uint8_t *)(hdr + 1);
+    iphc[0] = SIXLOWPAN_IPHC1_DISP | SIXLOWPAN_IPHC1_TF;
+    iphc[1] = 0;
+    iphc[2] = TEST_IPV6_NH;
+    iphc[3] = TEST_IPV6_HL;
+    memcpy(&iphc[4], &_test_ipv6_src, sizeof(_test_ipv6_src));
+    memcpy(&iphc[4 + sizeof(ipv6_addr_t)], &_test_ipv6_dst,
+           sizeof(_test_ipv6_dst));
+    memset(&iphc[TEST_IPHC_LEN], 0x54, TEST_FRAGMENT1_PAYLOAD);
+    return pkt;
+}
+
+/* checks a first fragment forwarded with a newly compressed IPv6 header */
+static void _test_forwarded_iphc(gnrc_pktsnip_t *pkt, uint16_t out_tag)
+{
+    gnrc_netif_hdr_t *netif_hdr;
+    sixlowpan_frag_t *hdr;
+    gnrc_pktsnip_t *iphc, *payload;
+    uint8_t *data;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETTYPE_NETIF, pkt->type);
+    netif_hdr = pkt->data;
+    TEST_ASSERT_EQUAL_INT(_out_netif.pid, netif_hdr->if_pid);
+    TEST_ASSERT_EQUAL_INT(sizeof(_test_next_hop), netif_hdr->dst_l2addr_len);
+    TEST_ASSERT_MESSAGE(memcmp(gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                               _test_next_hop, sizeof(_test_next_hop)) == 0,
+                        "Fragment not sent to next hop");
+    TEST_ASSERT_NOT_NULL(pkt->next);
+    TEST_ASSERT_EQUAL_INT(sizeof(sixlowpan_frag_t), pkt->next->size);
+    hdr = pkt->next->data;
+    TEST_ASSERT_EQUAL_INT(SIXLOWPAN_FRAG_1_DISP,
+                          hdr->disp_size.u8[0] & SIXLOWPAN_FRAG_DISP_MASK);
+    TEST_ASSERT_EQUAL_INT(out_tag, byteorder_ntohs(hdr->tag));
+    TEST_ASSERT_EQUAL_INT(TEST_DATAGRAM_SIZE,
+                          byteorder_ntohs(hdr->disp_size) &
+                          SIXLOWPAN_FRAG_SIZE_MASK);
+    iphc = pkt->next->next;
+    TEST_ASSERT_NOT_NULL(iphc);
+    data = iphc->data;
+    TEST_ASSERT(sixlowpan_iphc_is(data));
+    /* nothing to elide, so the fields follow the IPHC header inline, with
+     * the hop limit decremented */
+    TEST_ASSERT_EQUAL_INT(TEST_IPHC_LEN, iphc->size);
+    TEST_ASSERT_EQUAL_INT(TEST_IPV6_NH, data[2]);
+    TEST_ASSERT_EQUAL_INT(TEST_IPV6_HL - 1, data[3]);
+    TEST_ASSERT_MESSAGE(memcmp(&data[4 + sizeof(ipv6_addr_t)], &_test_ipv6_dst,
+                               sizeof(_test_ipv6_dst)) == 0,
+                        "Destination address changed");
+    payload = iphc->next;
+    TEST_ASSERT_NOT_NULL(payload);
+    TEST_ASSERT_NULL(payload->next);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAGMENT1_PAYLOAD, payload->size);
+    data = payload->data;
+    for (unsigned i = 0; i < TEST_FRAGMENT1_PAYLOAD; i++) {
+        TEST_ASSERT_EQUAL_INT(0x54, data[i]);
+    }
+}
+
+static void test_vrb_add__success(void)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrb;
+
+    TEST_ASSERT_NULL(_get());
+    vrb = gnrc_sixlowpan_frag_vrb_add(&_base, &_out_netif, _test_next_hop,
+                                      sizeof(_test_next_hop));
+    TEST_ASSERT_NOT_NULL(vrb);
+    TEST_ASSERT(vrb == _get());
+    TEST_ASSERT(&_out_netif == vrb->out_netif);
+    TEST_ASSERT_EQUAL_INT(sizeof(_test_next_hop), vrb->out_dst_len);
+    TEST_ASSERT_MESSAGE(memcmp(vrb->out_dst, _test_next_hop,
+                               sizeof(_test_next_hop)) == 0,
+                        "vrb->out_dst != TEST_NEXT_HOP");
+    TEST_ASSERT_EQUAL_INT(0, vrb->super.current_size);
+}
+
+static void test_vrb_add__new_tags(void)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrb1, *vrb2;
+
+    vrb1 = gnrc_sixlowpan_frag_vrb_add(&_base, &_out_netif, _test_next_hop,
+                                       sizeof(_test_next_hop));
+    _base.tag++;
+    vrb2 = gnrc_sixlowpan_frag_vrb_add(&_base, &_out_netif, _test_next_hop,
+                                       sizeof(_test_next_hop));
+    TEST_ASSERT_NOT_NULL(vrb1);
+    TEST_ASSERT_NOT_NULL(vrb2);
+    TEST_ASSERT(vrb1 != vrb2);
+    TEST_ASSERT(vrb1->out_tag != vrb2->out_tag);
+}
+
+static void test_vrb_add__full(void)
+{
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        _base.tag = TEST_TAG + i;
+        TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_vrb_add(&_base, &_out_netif,
+                                                         _test_next_hop,
+                                                         sizeof(_test_next_hop)));
+    }
+    _base.tag = TEST_TAG + GNRC_SIXLOWPAN_FRAG_VRB_SIZE;
+    TEST_ASSERT_NULL(gnrc_sixlowpan_frag_vrb_add(&_base, &_out_netif,
+                                                 _test_next_hop,
+                                                 sizeof(_test_next_hop)));
+}
+
+static void test_vrb_add__next_hop_too_long(void)
+{
+    static const uint8_t next_hop[IEEE802154_LONG_ADDRESS_LEN + 1] = { 0 };
+
+    TEST_ASSERT_NULL(gnrc_sixlowpan_frag_vrb_add(&_base, &_out_netif,
+                                                 next_hop, sizeof(next_hop)));
+}
+
+static void test_vrb_get__other_datagram(void)
+{
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_vrb_add(&_base, &_out_netif,
+                                                     _test_next_hop,
+                                                     sizeof(_test_next_hop)));
+    TEST_ASSERT_NULL(gnrc_sixlowpan_frag_vrb_get(_base.src, _base.src_len,
+                                                 _base.dst, _base.dst_len,
+                                                 _base.datagram_size,
+                                                 _base.tag + 1));
+    TEST_ASSERT_NULL(gnrc_sixlowpan_frag_vrb_get(_base.src, _base.src_len,
+                                                 _base.dst, _base.dst_len,
+                                                 _base.datagram_size - 1,
+                                                 _base.tag));
+    TEST_ASSERT_NULL(gnrc_sixlowpan_frag_vrb_get(_base.dst, _base.dst_len,
+                                                 _base.src, _base.src_len,
+                                                 _base.datagram_size,
+                                                 _base.tag));
+}
+
+static void test_vrb_rm(void)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrb;
+
+    vrb = gnrc_sixlowpan_frag_vrb_add(&_base, &_out_netif, _test_next_hop,
+                                      sizeof(_test_next_hop));
+    TEST_ASSERT_NOT_NULL(vrb);
+    gnrc_sixlowpan_frag_vrb_rm(vrb);
+    TEST_ASSERT_NULL(_get());
+}
+
+static void test_vrb_gc(void)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrb;
+
+    vrb = gnrc_sixlowpan_frag_vrb_add(&_base, &_out_netif, _test_next_hop,
+                                      sizeof(_test_next_hop));
+    TEST_ASSERT_NOT_NULL(vrb);
+    gnrc_sixlowpan_frag_vrb_gc();
+    TEST_ASSERT(vrb == _get());
+    /* set arrival GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US into the past */
+    vrb->super.arrival -= GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US + 1;
+    gnrc_sixlowpan_frag_vrb_gc();
+    TEST_ASSERT_NULL(_get());
+}
+
+static void test_vrb_send(void)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrb;
+    gnrc_pktsnip_t *pkt;
+    uint16_t out_tag;
+
+    vrb = gnrc_sixlowpan_frag_vrb_add(&_base, &_out_netif, _test_next_hop,
+                                      sizeof(_test_next_hop));
+    TEST_ASSERT_NOT_NULL(vrb);
+    out_tag = vrb->out_tag;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_sixlowpan_frag_vrb_send(
+            vrb, _fragment_n(TEST_FRAGMENT2_OFFSET, TEST_FRAGMENT2_SIZE),
+            TEST_FRAGMENT2_SIZE));
+    pkt = _recv_forwarded();
+    _test_forwarded(pkt, out_tag, TEST_FRAGMENT2_OFFSET);
+    TEST_ASSERT(((gnrc_netif_hdr_t *)pkt->data)->flags &
+                GNRC_NETIF_HDR_FLAGS_MORE_DATA);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAGMENT2_SIZE, vrb->super.current_size);
+    TEST_ASSERT(vrb == _get());
+    TEST_ASSERT_MESSAGE(gnrc_pktbuf_is_empty(), "Packet buffer is not empty");
+}
+
+static void test_vrb_send__complete(void)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrb;
+    gnrc_pktsnip_t *pkt;
+    uint16_t out_tag;
+
+    vrb = gnrc_sixlowpan_frag_vrb_add(&_base, &_out_netif, _test_next_hop,
+                                      sizeof(_test_next_hop));
+    TEST_ASSERT_NOT_NULL(vrb);
+    out_tag = vrb->out_tag;
+    vrb->super.current_size = TEST_DATAGRAM_SIZE - TEST_FRAGMENT2_SIZE;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_sixlowpan_frag_vrb_send(
+            vrb, _fragment_n(TEST_FRAGMENT2_OFFSET, TEST_FRAGMENT2_SIZE),
+            TEST_FRAGMENT2_SIZE));
+    pkt = _recv_forwarded();
+    _test_forwarded(pkt, out_tag, TEST_FRAGMENT2_OFFSET);
+    TEST_ASSERT(!(((gnrc_netif_hdr_t *)pkt->data)->flags &
+                  GNRC_NETIF_HDR_FLAGS_MORE_DATA));
+    gnrc_pktbuf_release(pkt);
+    /* all fragments forwarded => entry was removed */
+    TEST_ASSERT_NULL(_get());
+    TEST_ASSERT_MESSAGE(gnrc_pktbuf_is_empty(), "Packet buffer is not empty");
+}
+
+static void test_rbuf_add__forward(void)
+{
+    const gnrc_sixlowpan_rbuf_t *rbuf = rbuf_array();
+    gnrc_sixlowpan_frag_vrb_t *vrb;
+    gnrc_pktsnip_t *pkt;
+    uint16_t out_tag;
+
+    vrb = gnrc_sixlowpan_frag_vrb_add(&_base, &_out_netif, _test_next_hop,
+                                      sizeof(_test_next_hop));
+    TEST_ASSERT_NOT_NULL(vrb);
+    out_tag = vrb->out_tag;
+    rbuf_add(&_test_netif_hdr.hdr,
+             _fragment_n(TEST_FRAGMENT2_OFFSET, TEST_FRAGMENT2_SIZE),
+             TEST_FRAGMENT2_OFFSET, TEST_PAGE);
+    /* the fragment was not put into the reassembly buffer ... */
+    for (unsigned i = 0; i < RBUF_SIZE; i++) {
+        TEST_ASSERT(rbuf_entry_empty(&rbuf[i]));
+    }
+    /* ... but forwarded */
+    pkt = _recv_forwarded();
+    _test_forwarded(pkt, out_tag, TEST_FRAGMENT2_OFFSET);
+    TEST_ASSERT_EQUAL_INT(sizeof(sixlowpan_frag_n_t) + TEST_FRAGMENT2_SIZE,
+                          pkt->next->size);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAGMENT2_SIZE, vrb->super.current_size);
+    TEST_ASSERT_MESSAGE(gnrc_pktbuf_is_empty(), "Packet buffer is not empty");
+}
+
+static void test_rbuf_add__other_datagram(void)
+{
+    const gnrc_sixlowpan_rbuf_t *rbuf = rbuf_array();
+    unsigned used = 0;
+
+    _base.tag = TEST_TAG + 1;
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_vrb_add(&_base, &_out_netif,
+                                                     _test_next_hop,
+                                                     sizeof(_test_next_hop)));
+    rbuf_add(&_test_netif_hdr.hdr,
+             _fragment_n(TEST_FRAGMENT2_OFFSET, TEST_FRAGMENT2_SIZE),
+             TEST_FRAGMENT2_OFFSET, TEST_PAGE);
+    /* the fragment is reassembled ... */
+    for (unsigned i = 0; i < RBUF_SIZE; i++) {
+        if (!rbuf_entry_empty(&rbuf[i])) {
+            used++;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(1, used);
+    /* ... and not forwarded */
+    TEST_ASSERT_NULL(_recv_forwarded());
+}
+
+static void test_iphc_recv__forward_frag1(void)
+{
+    const gnrc_sixlowpan_rbuf_t *rbuf = rbuf_array();
+    gnrc_sixlowpan_frag_vrb_t *vrb;
+    gnrc_netif_hdr_t *netif_hdr;
+    gnrc_pktsnip_t *pkt;
+
+    /* fragments are forwarded via the router interface */
+    _out_netif.pid = _netif->pid;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_nc_set(&_test_ipv6_dst, _netif->pid,
+                                                  _test_next_hop,
+                                                  sizeof(_test_next_hop)));
+    TEST_ASSERT_NOT_NULL((pkt = _fragment_1_iphc(&netif_hdr)));
+    rbuf_add(netif_hdr, pkt, 0, TEST_PAGE);
+    /* the datagram is not reassembled ... */
+    for (unsigned i = 0; i < RBUF_SIZE; i++) {
+        TEST_ASSERT(rbuf_entry_empty(&rbuf[i]));
+    }
+    /* ... but the subsequent fragments are forwarded via the VRB ... */
+    vrb = _get();
+    TEST_ASSERT_NOT_NULL(vrb);
+    TEST_ASSERT(_netif == vrb->out_netif);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAGMENT2_OFFSET, vrb->super.current_size);
+    /* ... and the first fragment was sent to the next hop */
+    pkt = _recv_forwarded();
+    _test_forwarded_iphc(pkt, vrb->out_tag);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_NULL(_recv_forwarded());
+    TEST_ASSERT_MESSAGE(gnrc_pktbuf_is_empty(), "Packet buffer is not empty");
+}
+
+static void test_iphc_recv__forward_frag1_after_fragn(void)
+{
+    const gnrc_sixlowpan_rbuf_t *rbuf = rbuf_array();
+    gnrc_sixlowpan_frag_vrb_t *vrb;
+    gnrc_netif_hdr_t *netif_hdr;
+    gnrc_pktsnip_t *pkt;
+
+    /* fragments are forwarded via the router interface */
+    _out_netif.pid = _netif->pid;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_nc_set(&_test_ipv6_dst, _netif->pid,
+                                                  _test_next_hop,
+                                                  sizeof(_test_next_hop)));
+    TEST_ASSERT_NOT_NULL((pkt = _fragment_1_iphc(&netif_hdr)));
+    /* a subsequent fragment arrives first and is reassembled */
+    rbuf_add(netif_hdr,
+             _fragment_n(TEST_FRAGMENT2_OFFSET, TEST_FRAGMENT2_SIZE),
+             TEST_FRAGMENT2_OFFSET, TEST_PAGE);
+    TEST_ASSERT_NULL(_recv_forwarded());
+    rbuf_add(netif_hdr, pkt, 0, TEST_PAGE);
+    for (unsigned i = 0; i < RBUF_SIZE; i++) {
+        TEST_ASSERT(rbuf_entry_empty(&rbuf[i]));
+    }
+    vrb = _get();
+    TEST_ASSERT_NOT_NULL(vrb);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAGMENT2_OFFSET + TEST_FRAGMENT2_SIZE,
+                          vrb->super.current_size);
+    /* first fragment is sent first, followed by the one that arrived early */
+    pkt = _recv_forwarded();
+    _test_forwarded_iphc(pkt, vrb->out_tag);
+    gnrc_pktbuf_release(pkt);
+    pkt = _recv_forwarded();
+    _test_forwarded(pkt, vrb->out_tag, TEST_FRAGMENT2_OFFSET);
+    TEST_ASSERT_EQUAL_INT(sizeof(sixlowpan_frag_n_t) + TEST_FRAGMENT2_SIZE,
+                          pkt->next->size);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_MESSAGE(gnrc_pktbuf_is_empty(), "Packet buffer is not empty");
+}
+
+static void test_iphc_recv__no_route(void)
+{
+    const gnrc_sixlowpan_rbuf_t *rbuf = rbuf_array();
+    gnrc_netif_hdr_t *netif_hdr;
+    gnrc_pktsnip_t *pkt;
+    unsigned used = 0;
+
+    gnrc_ipv6_nib_nc_del(&_test_ipv6_dst, _netif->pid);
+    TEST_ASSERT_NOT_NULL((pkt = _fragment_1_iphc(&netif_hdr)));
+    rbuf_add(netif_hdr, pkt, 0, TEST_PAGE);
+    /* without a next hop the datagram is reassembled ... */
+    for (unsigned i = 0; i < RBUF_SIZE; i++) {
+        if (!rbuf_entry_empty(&rbuf[i])) {
+            used++;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(1, used);
+    TEST_ASSERT_NULL(_get());
+    /* ... and not forwarded */
+    TEST_ASSERT_NULL(_recv_forwarded());
+}
+
+static void run_unittests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_vrb_add__success),
+        new_TestFixture(test_vrb_add__new_tags),
+        new_TestFixture(test_vrb_add__full),
+        new_TestFixture(test_vrb_add__next_hop_too_long),
+        new_TestFixture(test_vrb_get__other_datagram),
+        new_TestFixture(test_vrb_rm),
+        new_TestFixture(test_vrb_gc),
+        new_TestFixture(test_vrb_send),
+        new_TestFixture(test_vrb_send__complete),
+        new_TestFixture(test_rbuf_add__forward),
+        new_TestFixture(test_rbuf_add__other_datagram),
+        new_TestFixture(test_iphc_recv__forward_frag1),
+        new_TestFixture(test_iphc_recv__forward_frag1_after_fragn),
+        new_TestFixture(test_iphc_recv__no_route),
+    };
+
+    EMB_UNIT_TESTCALLER(sixlo_frag_vrb_tests, _set_up, NULL, fixtures);
+    TESTS_START();
+    TESTS_RUN((Test *)&sixlo_frag_vrb_tests);
+    TESTS_END();
+}
+
+int main(void)
+{
+    /* no auto-init, so xtimer needs to be initialized manually*/
+    xtimer_init();
+    _main_pid = thread_getpid();
+    msg_init_queue(_msg_queue, sizeof(_msg_queue) / sizeof(_msg_queue[0]));
+    /* the router interface needs the NIB and IPv6 to handle its timers */
+    gnrc_pktbuf_init();
+    gnrc_ipv6_nib_init();
+    gnrc_ipv6_init();
+    netdev_test_setup(&_netdev, NULL);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _netdev_device_type);
+    _netif = gnrc_netif_create(_netif_stack, sizeof(_netif_stack),
+                               GNRC_NETIF_PRIO, "vrb_netif",
+                               (netdev_t *)&_netdev, &_netif_ops);
+    run_unittests();
+    return 0;
+}
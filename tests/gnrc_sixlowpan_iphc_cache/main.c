@@ -0,0 +1,303 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the IPHC compression cache
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/udp.h"
+#include "net/netdev_test.h"
+#include "net/sixlowpan.h"
+#include "thread.h"
+#include "utlist.h"
+#include "xtimer.h"
+
+#define TEST_MAX_FRAG_SIZE      (102U)
+#define TEST_LOCAL_EUI64        { 0x02, 0x00, 0x00, 0xff, \
+                                  0xfe, 0x00, 0x00, 0x01 }
+#define TEST_REMOTE_EUI64       { 0x02, 0x00, 0x00, 0xff, \
+                                  0xfe, 0x00, 0x00, 0x02 }
+/* derived from TEST_LOCAL_EUI64 */
+#define TEST_SRC                { 0xfe, 0x80, 0x00, 0x00, \
+                                  0x00, 0x00, 0x00, 0x00, \
+                                  0x00, 0x00, 0x00, 0xff, \
+                                  0xfe, 0x00, 0x00, 0x01 }
+/* prefix of context 0 + IID derived from TEST_REMOTE_EUI64 */
+#define TEST_DST                { 0xfd, 0x01, 0x00, 0x00, \
+                                  0x00, 0x00, 0x00, 0x00, \
+                                  0x00, 0x00, 0x00, 0xff, \
+                                  0xfe, 0x00, 0x00, 0x02 }
+#define TEST_CTX_ID             (0U)
+#define TEST_CTX_PREFIX_LEN     (64U)
+#define TEST_CTX_LTIME          (60U)
+#define TEST_PORT               (61616U)
+#define TEST_RECEIVE_TIMEOUT    (100U * US_PER_MS)
+/* IPHC with TF elided, next header compressed, hop limit 64, both addresses
+ * elided, destination address context-based */
+#define TEST_IPHC_CTX           { 0x7a, 0x37 }
+/* IPHC as TEST_IPHC_CTX, but destination address inline */
+#define TEST_IPHC_NO_CTX        { 0x7a, 0x30 }
+/* UDP NHC with both ports compressed to 4 bits, checksum inline */
+#define TEST_NHC_UDP            (0xf3)
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _dev;
+static const uint8_t _local_eui64[] = TEST_LOCAL_EUI64;
+static const uint8_t _remote_eui64[] = TEST_REMOTE_EUI64;
+static const ipv6_addr_t _src = { .u8 = TEST_SRC };
+static const ipv6_addr_t _dst = { .u8 = TEST_DST };
+static gnrc_netif_t *_netif;
+static kernel_pid_t _main_pid;
+static msg_t _msg_queue[4];
+/* 6LoWPAN part of the last frame sent over _netif */
+static uint8_t _frame[TEST_MAX_FRAG_SIZE];
+static size_t _frame_len;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    assert(max_len == sizeof(uint16_t));
+    (void)dev;
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    assert(max_len == sizeof(gnrc_nettype_t));
+    (void)dev;
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    assert(max_len == sizeof(uint16_t));
+    (void)dev;
+    *((uint16_t *)value) = TEST_MAX_FRAG_SIZE;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    assert(max_len == sizeof(uint16_t));
+    (void)dev;
+    *((uint16_t *)value) = sizeof(_local_eui64);
+    return sizeof(uint16_t);
+}
+
+static int _get_addr_long(netdev_t *dev, void *value, size_t max_len)
+{
+    assert(max_len >= sizeof(_local_eui64));
+    (void)dev;
+    memcpy(value, _local_eui64, sizeof(_local_eui64));
+    return sizeof(_local_eui64);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    uint8_t *dispatch;
+    size_t len = 0;
+    msg_t msg = { .type = 0U };
+
+    (void)dev;
+    /* skip MAC header */
+    iolist = iolist->iol_next;
+    dispatch = iolist->iol_base;
+    /* ignore everything but the UDP packets sent by the tests (e.g. router
+     * solicitations) */
+    if (!sixlowpan_iphc_is(dispatch) ||
+        !(dispatch[0] & SIXLOWPAN_IPHC1_NH)) {
+        return iolist_size(iolist);
+    }
+    for (; iolist != NULL; iolist = iolist->iol_next) {
+        assert((len + iolist->iol_len) <= sizeof(_frame));
+        memcpy(&_frame[len], iolist->iol_base, iolist->iol_len);
+        len += iolist->iol_len;
+    }
+    _frame_len = len;
+    msg_try_send(&msg, _main_pid);
+    return len;
+}
+
+static void _init_interface(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS_LONG, _get_addr_long);
+    netdev_test_set_send_cb(&_dev, _send);
+    _netif = gnrc_netif_ieee802154_create(_netif_stack, sizeof(_netif_stack),
+                                          GNRC_NETIF_PRIO, "dummy_netif",
+                                          (netdev_t *)&_dev);
+}
+
+static void _set_up(void)
+{
+    gnrc_sixlowpan_ctx_reset();
+    gnrc_sixlowpan_ctx_update(TEST_CTX_ID, &_dst, TEST_CTX_PREFIX_LEN,
+                              TEST_CTX_LTIME, true);
+}
+
+/* sends a UDP packet from TEST_PORT to dst_port with the given checksum and
+ * payload_len bytes of payload and waits for the frame to be sent */
+static void _send_udp(uint16_t dst_port, uint16_t csum, size_t payload_len)
+{
+    gnrc_pktsnip_t *pkt, *netif;
+    udp_hdr_t *udp_hdr;
+    ipv6_hdr_t *ipv6_hdr;
+    msg_t msg;
+
+    pkt = gnrc_pktbuf_add(NULL, NULL, payload_len, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(pkt);
+    memset(pkt->data, payload_len, payload_len);
+    pkt = gnrc_udp_hdr_build(pkt, TEST_PORT, dst_port);
+    TEST_ASSERT_NOT_NULL(pkt);
+    udp_hdr = pkt->data;
+    udp_hdr->length = byteorder_htons(gnrc_pkt_len(pkt));
+    udp_hdr->checksum = byteorder_htons(csum);
+    pkt = gnrc_ipv6_hdr_build(pkt, &_src, &_dst);
+    TEST_ASSERT_NOT_NULL(pkt);
+    ipv6_hdr = pkt->data;
+    ipv6_hdr->len = byteorder_htons(gnrc_pkt_len(pkt->next));
+    ipv6_hdr->nh = PROTNUM_UDP;
+    ipv6_hdr->hl = 64;
+    netif = gnrc_netif_hdr_build(NULL, 0, _remote_eui64, sizeof(_remote_eui64));
+    TEST_ASSERT_NOT_NULL(netif);
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = _netif->pid;
+    LL_PREPEND(pkt, netif);
+    TEST_ASSERT(gnrc_netapi_dispatch_send(GNRC_NETTYPE_SIXLOWPAN,
+                                          GNRC_NETREG_DEMUX_CTX_ALL, pkt) > 0);
+    TEST_ASSERT_MESSAGE(xtimer_msg_receive_timeout(&msg,
+                                                   TEST_RECEIVE_TIMEOUT) >= 0,
+                        "Frame was not sent");
+}
+
+static void _test_frame(const uint8_t *iphc, size_t iphc_len,
+                        uint16_t dst_port, uint16_t csum, size_t payload_len)
+{
+    const uint8_t *nhc = &_frame[iphc_len];
+
+    TEST_ASSERT_EQUAL_INT(iphc_len + 4U + payload_len, _frame_len);
+    TEST_ASSERT(memcmp(iphc, _frame, iphc_len) == 0);
+    TEST_ASSERT_EQUAL_INT(TEST_NHC_UDP, nhc[0]);
+    TEST_ASSERT_EQUAL_INT(((TEST_PORT & 0xf) << 4) | (dst_port & 0xf),
+                          nhc[1]);
+    TEST_ASSERT_EQUAL_INT(csum >> 8, nhc[2]);
+    TEST_ASSERT_EQUAL_INT(csum & 0xff, nhc[3]);
+    for (unsigned i = 0; i < payload_len; i++) {
+        TEST_ASSERT_EQUAL_INT(payload_len, nhc[4 + i]);
+    }
+}
+
+static void _test_frame_ctx(uint16_t dst_port, uint16_t csum,
+                            size_t payload_len)
+{
+    static const uint8_t iphc[] = TEST_IPHC_CTX;
+
+    _test_frame(iphc, sizeof(iphc), dst_port, csum, payload_len);
+}
+
+static void _test_frame_no_ctx(uint16_t dst_port, uint16_t csum,
+                               size_t payload_len)
+{
+    static const uint8_t iphc_disp[] = TEST_IPHC_NO_CTX;
+    uint8_t iphc[sizeof(iphc_disp) + sizeof(_dst)];
+
+    memcpy(iphc, iphc_disp, sizeof(iphc_disp));
+    memcpy(&iphc[sizeof(iphc_disp)], &_dst, sizeof(_dst));
+    _test_frame(iphc, sizeof(iphc), dst_port, csum, payload_len);
+}
+
+static void test_iphc_cache__same_flow(void)
+{
+    _send_udp(TEST_PORT, 0x1234, 8U);
+    _test_frame_ctx(TEST_PORT, 0x1234, 8U);
+    /* only checksum and payload differ */
+    _send_udp(TEST_PORT, 0xabcd, 3U);
+    _test_frame_ctx(TEST_PORT, 0xabcd, 3U);
+    TEST_ASSERT_MESSAGE(gnrc_pktbuf_is_empty(), "Packet buffer is not empty");
+}
+
+static void test_iphc_cache__other_flow(void)
+{
+    _send_udp(TEST_PORT, 0x1234, 8U);
+    _test_frame_ctx(TEST_PORT, 0x1234, 8U);
+    _send_udp(TEST_PORT + 1, 0x5678, 8U);
+    _test_frame_ctx(TEST_PORT + 1, 0x5678, 8U);
+    _send_udp(TEST_PORT, 0xabcd, 8U);
+    _test_frame_ctx(TEST_PORT, 0xabcd, 8U);
+    TEST_ASSERT_MESSAGE(gnrc_pktbuf_is_empty(), "Packet buffer is not empty");
+}
+
+static void test_iphc_cache__ctx_update(void)
+{
+    _send_udp(TEST_PORT, 0x1234, 8U);
+    _test_frame_ctx(TEST_PORT, 0x1234, 8U);
+    gnrc_sixlowpan_ctx_update(TEST_CTX_ID, &_dst, TEST_CTX_PREFIX_LEN,
+                              TEST_CTX_LTIME, false);
+    _send_udp(TEST_PORT, 0xabcd, 8U);
+    _test_frame_no_ctx(TEST_PORT, 0xabcd, 8U);
+    TEST_ASSERT_MESSAGE(gnrc_pktbuf_is_empty(), "Packet buffer is not empty");
+}
+
+static void test_iphc_cache__ctx_expired(void)
+{
+    gnrc_sixlowpan_ctx_t *ctx;
+
+    _send_udp(TEST_PORT, 0x1234, 8U);
+    _test_frame_ctx(TEST_PORT, 0x1234, 8U);
+    /* expiring contexts do not invalidate the cache */
+    ctx = gnrc_sixlowpan_ctx_lookup_id(TEST_CTX_ID);
+    TEST_ASSERT_NOT_NULL(ctx);
+    ctx->flags_id &= ~GNRC_SIXLOWPAN_CTX_FLAGS_COMP;
+    _send_udp(TEST_PORT, 0xabcd, 8U);
+    _test_frame_no_ctx(TEST_PORT, 0xabcd, 8U);
+    TEST_ASSERT_MESSAGE(gnrc_pktbuf_is_empty(), "Packet buffer is not empty");
+}
+
+static void run_unittests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_iphc_cache__same_flow),
+        new_TestFixture(test_iphc_cache__other_flow),
+        new_TestFixture(test_iphc_cache__ctx_update),
+        new_TestFixture(test_iphc_cache__ctx_expired),
+    };
+
+    EMB_UNIT_TESTCALLER(sixlo_iphc_cache_tests, _set_up, NULL, fixtures);
+    TESTS_START();
+    TESTS_RUN((Test *)&sixlo_iphc_cache_tests);
+    TESTS_END();
+}
+
+int main(void)
+{
+    _main_pid = thread_getpid();
+    msg_init_queue(_msg_queue, sizeof(_msg_queue) / sizeof(_msg_queue[0]));
+    _init_interface();
+    run_unittests();
+    return 0;
+}
@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for sock_async_event on GNRC
+ *
+ * Checks that UDP and raw IP socks bound to an event queue report received
+ * and sent messages from the thread handling the queue, that events are
+ * coalesced, that a full mbox is reported with SOCK_ASYNC_ERR and that
+ * closing a sock cancels its pending event. All messages are sent to the
+ * loopback address.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "event.h"
+#include "xtimer.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/async_event.h"
+#include "net/sock/ip.h"
+#include "net/sock/udp.h"
+
+#define TEST_PORT           (8000U)
+#define TEST_PORT_UNUSED    (8001U)
+#define TEST_PROTO          (254)   /* https://tools.ietf.org/html/rfc3692#section-2.1 */
+#define TEST_TIMEOUT        (100U * US_PER_MS)
+#define TEST_PAYLOAD        "ABCD"
+
+static event_queue_t _queue;
+static sock_udp_t _udp_sock;
+static sock_ip_t _ip_sock;
+static char _buf[16];
+static void *_event_sock;
+static void *_event_arg;
+static unsigned _event_flags;
+static unsigned _failed = 0;
+
+static void _check(const char *name, int ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    if (!ok) {
+        _failed++;
+    }
+}
+
+static void _udp_handler(sock_udp_t *sock, sock_async_flags_t flags, void *arg)
+{
+    _event_sock = sock;
+    _event_arg = arg;
+    _event_flags |= flags;
+}
+
+static void _ip_handler(sock_ip_t *sock, sock_async_flags_t flags, void *arg)
+{
+    _event_sock = sock;
+    _event_arg = arg;
+    _event_flags |= flags;
+}
+
+/* handles events until none was posted for TEST_TIMEOUT, returns their
+ * number */
+static unsigned _handle_events(void)
+{
+    unsigned count = 0;
+    event_t *ev;
+
+    _event_sock = NULL;
+    _event_arg = NULL;
+    _event_flags = 0;
+    while ((ev = event_wait_timeout(&_queue, TEST_TIMEOUT)) != NULL) {
+        ev->handler(ev);
+        count++;
+    }
+    return count;
+}
+
+static int _udp_send(sock_udp_t *sock, uint16_t port)
+{
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = port };
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    return sock_udp_send(sock, TEST_PAYLOAD, sizeof(TEST_PAYLOAD), &remote);
+}
+
+/* receives until the sock is empty, returns the number of messages */
+static unsigned _udp_recv_all(void)
+{
+    unsigned count = 0;
+
+    while (sock_udp_recv(&_udp_sock, _buf, sizeof(_buf), 0, NULL) ==
+           sizeof(TEST_PAYLOAD)) {
+        count++;
+    }
+    return count;
+}
+
+static void _test_udp_recv(void)
+{
+    /* both messages are reported with a single event */
+    int ok = (_udp_send(NULL, TEST_PORT) > 0) &&
+             (_udp_send(NULL, TEST_PORT) > 0);
+
+    _check("udp recv", ok && (_handle_events() == 1) &&
+                       (_event_sock == &_udp_sock) && (_event_arg == _buf) &&
+                       (_event_flags == SOCK_ASYNC_MSG_RECV) &&
+                       (_udp_recv_all() == 2));
+}
+
+static void _test_udp_sent(void)
+{
+    int ok = (_udp_send(&_udp_sock, TEST_PORT_UNUSED) > 0);
+
+    _check("udp sent", ok && (_handle_events() == 1) &&
+                       (_event_flags == SOCK_ASYNC_MSG_SENT));
+}
+
+static void _test_udp_mbox_full(void)
+{
+    int ok = 1;
+
+    for (unsigned i = 0; i <= SOCK_MBOX_SIZE; i++) {
+        ok = ok && (_udp_send(NULL, TEST_PORT) > 0);
+    }
+    _check("udp mbox full", ok && (_handle_events() > 0) &&
+                            (_event_flags == (SOCK_ASYNC_MSG_RECV |
+                                              SOCK_ASYNC_ERR)) &&
+                            (_udp_recv_all() == SOCK_MBOX_SIZE));
+}
+
+static void _test_udp_close(void)
+{
+    int ok = (_udp_send(NULL, TEST_PORT) > 0);
+
+    /* let the stack deliver the message */
+    xtimer_usleep(TEST_TIMEOUT);
+    sock_udp_close(&_udp_sock);
+    _check("udp close", ok && (event_get(&_queue) == NULL));
+}
+
+static void _test_ip(void)
+{
+    static const sock_ip_ep_t local = { .family = AF_INET6 };
+    sock_ip_ep_t remote = { .family = AF_INET6 };
+    int ok = (sock_ip_create(&_ip_sock, &local, NULL, TEST_PROTO, 0) == 0);
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+
+    if (ok) {
+        sock_ip_event_init(&_ip_sock, &_queue, _ip_handler, _buf);
+        /* the message is sent to the sock itself */
+        ok = (sock_ip_send(&_ip_sock, TEST_PAYLOAD, sizeof(TEST_PAYLOAD),
+                           TEST_PROTO, &remote) > 0) &&
+             (_handle_events() > 0) &&
+             (_event_sock == &_ip_sock) && (_event_arg == _buf) &&
+             (_event_flags == (SOCK_ASYNC_MSG_RECV | SOCK_ASYNC_MSG_SENT)) &&
+             (sock_ip_recv(&_ip_sock, _buf, sizeof(_buf), 0, NULL) ==
+              sizeof(TEST_PAYLOAD));
+        sock_ip_close(&_ip_sock);
+    }
+    _check("ip recv and sent", ok);
+}
+
+int main(void)
+{
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = TEST_PORT };
+
+    puts("START");
+    event_queue_init(&_queue);
+    if (sock_udp_create(&_udp_sock, &local, NULL, 0) < 0) {
+        puts("Unable to create UDP sock");
+        return 1;
+    }
+    sock_udp_event_init(&_udp_sock, &_queue, _udp_handler, _buf);
+
+    _test_udp_recv();
+    _test_udp_sent();
+    _test_udp_mbox_full();
+    _test_udp_close();
+    _test_ip();
+    puts(_failed ? "[FAILED]" : "[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Echo server for the non-blocking GNRC TCP API
+ *
+ * Before the echo server starts, a client and a server connected via the
+ * loopback address check the return values and events of the non-blocking
+ * API, and that a passive connection whose handshake times out listens again.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <errno.h>
+#include "event.h"
+#include "xtimer.h"
+#include "net/af.h"
+#include "net/tcp.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/tcp.h"
+
+/* Size of the echo buffer of each connection */
+#ifndef BUF_SIZE
+#define BUF_SIZE (256)
+#endif
+
+typedef struct {
+    gnrc_tcp_tcb_t tcb;
+    uint8_t buf[BUF_SIZE];
+    size_t pending;         /* bytes in buf not yet echoed */
+    size_t sent;            /* bytes of buf already echoed */
+    unsigned id;
+} conn_t;
+
+/* Port and timeouts of the checks */
+#define TEST_PORT           (SERVER_PORT + 1)
+#define TEST_TIMEOUT        (US_PER_SEC)
+#define TEST_SYN            (0x0002)
+
+/* Peer of the injected SYN, without a route to it */
+#define TEST_UNREACHABLE    "2001:db8:1::1"
+
+typedef struct {
+    gnrc_tcp_tcb_t tcb;
+    unsigned events;        /* events reported since the last check */
+} test_conn_t;
+
+static conn_t _conns[CONNS];
+static event_queue_t _queue;
+static test_conn_t _server;
+static test_conn_t _client;
+static unsigned _failed = 0;
+
+static void _listen(conn_t *conn)
+{
+    conn->pending = 0;
+    conn->sent = 0;
+    int res = gnrc_tcp_open_passive(&conn->tcb, AF_INET6, NULL, SERVER_PORT);
+    if (res != -EINPROGRESS && res != -EISCONN) {
+        printf("conn %u: gnrc_tcp_open_passive() : %d\n", conn->id, res);
+    }
+}
+
+static void _on_event(gnrc_tcp_tcb_t *tcb, unsigned events, void *arg)
+{
+    conn_t *conn = arg;
+    (void)tcb;
+
+    if (events & GNRC_TCP_EVENT_CONNECTED) {
+        printf("conn %u: connected\n", conn->id);
+    }
+    /* Echo received data, read only if the previous data was echoed */
+    while (1) {
+        if (conn->pending == conn->sent) {
+            ssize_t res = gnrc_tcp_recv(&conn->tcb, conn->buf, sizeof(conn->buf), 0);
+            if (res <= 0) {
+                break;
+            }
+            conn->pending = res;
+            conn->sent = 0;
+        }
+        ssize_t res = gnrc_tcp_send(&conn->tcb, conn->buf + conn->sent,
+                                    conn->pending - conn->sent, 0);
+        if (res <= 0) {
+            /* Window is full: Continue with GNRC_TCP_EVENT_WRITABLE */
+            break;
+        }
+        conn->sent += res;
+    }
+    if ((events & GNRC_TCP_EVENT_CLOSED) && !(events & GNRC_TCP_EVENT_READABLE)) {
+        /* Close our side and wait for the next connection, once closed */
+        gnrc_tcp_close(&conn->tcb);
+        _listen(conn);
+    }
+}
+
+static void _check(const char *name, int ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    if (!ok) {
+        _failed++;
+    }
+}
+
+static void _on_test_event(gnrc_tcp_tcb_t *tcb, unsigned events, void *arg)
+{
+    test_conn_t *conn = arg;
+    (void)tcb;
+
+    conn->events |= events;
+}
+
+/* Handles events until all of @p events were reported for @p conn */
+static bool _wait(test_conn_t *conn, unsigned events, uint32_t timeout)
+{
+    uint32_t deadline = xtimer_now_usec() + timeout;
+
+    while ((conn->events & events) != events) {
+        int32_t left = (int32_t)(deadline - xtimer_now_usec());
+        event_t *ev;
+
+        if ((left <= 0) || ((ev = event_wait_timeout(&_queue, left)) == NULL)) {
+            return false;
+        }
+        ev->handler(ev);
+    }
+    return true;
+}
+
+/* Sends a SYN from an unreachable peer, so the handshake can not complete */
+static void _inject_syn(uint16_t port)
+{
+    ipv6_addr_t src;
+    ipv6_addr_t dst = IPV6_ADDR_LOOPBACK;
+    gnrc_pktsnip_t *tcp;
+    gnrc_pktsnip_t *ip;
+
+    ipv6_addr_from_str(&src, TEST_UNREACHABLE);
+    if ((tcp = gnrc_tcp_hdr_build(NULL, TEST_PORT + 1, port)) == NULL) {
+        return;
+    }
+    if ((ip = gnrc_ipv6_hdr_build(NULL, &src, &dst)) == NULL) {
+        gnrc_pktbuf_release(tcp);
+        return;
+    }
+    tcp_hdr_t *hdr = tcp->data;
+    hdr->seq_num = byteorder_htonl(0x1234);
+    hdr->window = byteorder_htons(GNRC_TCP_DEFAULT_WINDOW);
+    hdr->off_ctl = byteorder_htons(byteorder_ntohs(hdr->off_ctl) | TEST_SYN);
+    gnrc_tcp_calc_csum(tcp, ip);
+    /* Receive order: TCP header first, followed by the IPv6 header */
+    tcp->next = ip;
+    if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_TCP, GNRC_NETREG_DEMUX_CTX_ALL, tcp)) {
+        gnrc_pktbuf_release(tcp);
+    }
+}
+
+static int _open(void)
+{
+    _server.events = 0;
+    _client.events = 0;
+    int res = gnrc_tcp_open_passive(&_server.tcb, AF_INET6, NULL, TEST_PORT);
+    if (res != -EINPROGRESS) {
+        return res;
+    }
+    return gnrc_tcp_open_active(&_client.tcb, AF_INET6, "::1", TEST_PORT, 0);
+}
+
+static void _test_connection(void)
+{
+    static uint8_t buf[BUF_SIZE];
+    ssize_t res;
+    int i;
+
+    _check("open returns -EINPROGRESS", _open() == -EINPROGRESS);
+    _check("connected", _wait(&_server, GNRC_TCP_EVENT_CONNECTED, TEST_TIMEOUT) &&
+                        _wait(&_client, GNRC_TCP_EVENT_CONNECTED | GNRC_TCP_EVENT_WRITABLE,
+                              TEST_TIMEOUT));
+    _check("recv returns -EAGAIN", gnrc_tcp_recv(&_server.tcb, buf, sizeof(buf), 0) == -EAGAIN);
+    _check("empty send returns 0", gnrc_tcp_send(&_client.tcb, buf, 0, 0) == 0);
+
+    /* The server does not read, so the window closes */
+    for (i = 0, res = 1; (i < 64) && (res > 0); i++) {
+        res = gnrc_tcp_send(&_client.tcb, buf, sizeof(buf), 0);
+    }
+    _check("send returns -EAGAIN", res == -EAGAIN);
+    _check("readable", _wait(&_server, GNRC_TCP_EVENT_READABLE, TEST_TIMEOUT));
+
+    gnrc_tcp_abort(&_client.tcb);
+    gnrc_tcp_abort(&_server.tcb);
+}
+
+static void _test_listen_after_timeout(void)
+{
+    _server.events = 0;
+    _client.events = 0;
+    gnrc_tcp_open_passive(&_server.tcb, AF_INET6, NULL, TEST_PORT);
+    _inject_syn(TEST_PORT);
+    xtimer_usleep(TEST_TIMEOUT / 10);
+
+    /* The server handles the injected handshake and refuses the client */
+    gnrc_tcp_open_active(&_client.tcb, AF_INET6, "::1", TEST_PORT, 0);
+    _check("busy during handshake", _wait(&_client, GNRC_TCP_EVENT_CLOSED, TEST_TIMEOUT) &&
+                                    !(_server.events & GNRC_TCP_EVENT_CONNECTED));
+
+    /* Once the handshake timed out, the server accepts the next connection */
+    xtimer_usleep(GNRC_TCP_CONNECTION_TIMEOUT_DURATION + TEST_TIMEOUT);
+    _client.events = 0;
+    gnrc_tcp_open_active(&_client.tcb, AF_INET6, "::1", TEST_PORT, 0);
+    _check("listen after timeout", _wait(&_server, GNRC_TCP_EVENT_CONNECTED, TEST_TIMEOUT));
+
+    gnrc_tcp_abort(&_client.tcb);
+    gnrc_tcp_abort(&_server.tcb);
+}
+
+static void _run_checks(void)
+{
+    gnrc_tcp_tcb_init(&_server.tcb);
+    gnrc_tcp_event_init(&_server.tcb, &_queue, _on_test_event, &_server);
+    gnrc_tcp_tcb_init(&_client.tcb);
+    gnrc_tcp_event_init(&_client.tcb, &_queue, _on_test_event, &_client);
+
+    _test_connection();
+    _test_listen_after_timeout();
+    puts(_failed ? "[FAILED]" : "[SUCCESS]");
+}
+
+int main(void)
+{
+    gnrc_netif_t *netif;
+    ipv6_addr_t addr;
+
+    if (!(netif = gnrc_netif_iter(NULL))) {
+        puts("No valid network interface found");
+        return -1;
+    }
+    if (ipv6_addr_from_str(&addr, SERVER_ADDR) == NULL) {
+        puts("Can't convert given string to IPv6 Address");
+        return -1;
+    }
+    if (gnrc_netif_ipv6_addr_add(netif, &addr, 64, GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) < 0) {
+        puts("Can't assign given IPv6 Address");
+        return -1;
+    }
+
+    /* All connections are handled by this thread */
+    event_queue_init(&_queue);
+    _run_checks();
+
+    printf("Starting echo server: SERVER_ADDR=%s, SERVER_PORT=%d, CONNS=%d\n",
+           SERVER_ADDR, SERVER_PORT, CONNS);
+
+    for (unsigned i = 0; i < CONNS; i++) {
+        _conns[i].id = i;
+        gnrc_tcp_tcb_init(&_conns[i].tcb);
+        gnrc_tcp_event_init(&_conns[i].tcb, &_queue, _on_event, &_conns[i]);
+        _listen(&_conns[i]);
+    }
+    event_loop(&_queue);
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("open returns -EINPROGRESS: OK")
+    child.expect_exact("connected: OK")
+    child.expect_exact("recv returns -EAGAIN: OK")
+    child.expect_exact("empty send returns 0: OK")
+    child.expect_exact("send returns -EAGAIN: OK")
+    child.expect_exact("readable: OK")
+    child.expect_exact("busy during handshake: OK")
+    child.expect_exact("listen after timeout: OK", timeout=10)
+    child.expect_exact("[SUCCESS]")
+    child.expect_exact("Starting echo server")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
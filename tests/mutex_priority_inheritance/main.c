@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures how long a high priority thread waits for a mutex
+ *              held by a low priority thread while a medium priority thread
+ *              hogs the CPU
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "mutex.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define TEST_ROUNDS     (5U)
+/* time the low priority thread holds the mutex */
+#define TEST_HOLD       (50U * US_PER_MS)
+/* time the medium priority thread hogs the CPU */
+#define TEST_HOG        (200U * US_PER_MS)
+/* time after which the high and medium priority threads start */
+#define TEST_HIGH_START (10U * US_PER_MS)
+#define TEST_MID_START  (20U * US_PER_MS)
+
+static char _stack_low[THREAD_STACKSIZE_DEFAULT];
+static char _stack_mid[THREAD_STACKSIZE_DEFAULT];
+static char _stack_high[THREAD_STACKSIZE_DEFAULT];
+
+static mutex_t _mutex = MUTEX_INIT;
+static kernel_pid_t _main_pid;
+
+static void _busy(uint32_t duration)
+{
+    uint32_t start = xtimer_now_usec();
+
+    while ((xtimer_now_usec() - start) < duration) {}
+}
+
+static void *_low(void *arg)
+{
+    (void)arg;
+    mutex_lock(&_mutex);
+    _busy(TEST_HOLD);
+    mutex_unlock(&_mutex);
+    return NULL;
+}
+
+static void *_mid(void *arg)
+{
+    (void)arg;
+    xtimer_usleep(TEST_MID_START);
+    _busy(TEST_HOG);
+    return NULL;
+}
+
+static void *_high(void *arg)
+{
+    msg_t msg;
+    uint32_t start;
+
+    (void)arg;
+    xtimer_usleep(TEST_HIGH_START);
+    start = xtimer_now_usec();
+    mutex_lock(&_mutex);
+    msg.content.value = xtimer_now_usec() - start;
+    mutex_unlock(&_mutex);
+    msg_send(&msg, _main_pid);
+    return NULL;
+}
+
+int main(void)
+{
+    uint32_t max = 0;
+
+    _main_pid = thread_getpid();
+    puts("Mutex priority inheritance latency test");
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    puts("priority inheritance: on");
+#else
+    puts("priority inheritance: off");
+#endif
+
+    for (unsigned i = 0; i < TEST_ROUNDS; i++) {
+        msg_t msg;
+
+        thread_create(_stack_high, sizeof(_stack_high),
+                      THREAD_PRIORITY_MAIN - 3, THREAD_CREATE_STACKTEST,
+                      _high, NULL, "high");
+        thread_create(_stack_mid, sizeof(_stack_mid),
+                      THREAD_PRIORITY_MAIN - 2, THREAD_CREATE_STACKTEST,
+                      _mid, NULL, "mid");
+        thread_create(_stack_low, sizeof(_stack_low),
+                      THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                      _low, NULL, "low");
+        /* main only gets to run again once all threads are done */
+        msg_receive(&msg);
+        printf("{ \"round\" : %u, \"latency\" : %" PRIu32 " }\n", i,
+               msg.content.value);
+        if (msg.content.value > max) {
+            max = msg.content.value;
+        }
+    }
+    printf("{ \"max_latency\" : %" PRIu32 " }\n", max);
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    /* without inheritance the hog delays the low priority thread */
+    if (max >= (TEST_HOLD + (TEST_HOG / 2))) {
+        puts("[FAILED]");
+        return 1;
+    }
+#endif
+    puts("[SUCCESS]");
+
+    return 0;
+}
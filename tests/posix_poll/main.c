@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests poll() and select() with UDP sockets over loopback
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <poll.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <netinet/in.h>
+
+#include "thread.h"
+#include "vfs.h"
+#include "xtimer.h"
+
+#define TEST_PORT_A     (4711U)
+#define TEST_PORT_B     (4712U)
+#define TEST_TIMEOUT    (100U)      /* in ms */
+#define TEST_PAYLOAD    "hello"
+
+static char _buf[16];
+static char _waiter_stack[THREAD_STACKSIZE_DEFAULT];
+static int _waiter_fd;
+static int _waiter_res;
+
+static int _udp_socket(uint16_t port)
+{
+    struct sockaddr_in6 addr = {
+        .sin6_family = AF_INET6,
+        .sin6_port = htons(port),
+    };
+    int fd = socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
+
+    if (fd < 0) {
+        return fd;
+    }
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static int _send_to(int fd, uint16_t port)
+{
+    struct sockaddr_in6 addr = {
+        .sin6_family = AF_INET6,
+        .sin6_addr = IN6ADDR_LOOPBACK_INIT,
+        .sin6_port = htons(port),
+    };
+
+    return sendto(fd, TEST_PAYLOAD, sizeof(TEST_PAYLOAD), 0,
+                  (struct sockaddr *)&addr, sizeof(addr));
+}
+
+static int _test_poll(int a, int b)
+{
+    struct pollfd fds[] = {
+        { .fd = a, .events = POLLIN },
+        { .fd = b, .events = POLLIN | POLLOUT },
+        { .fd = -1, .events = POLLIN },
+    };
+    uint32_t start;
+
+    puts("poll() without data");
+    if (poll(fds, 1, 0) != 0) {
+        puts("FAILED: socket readable without data");
+        return -1;
+    }
+    if ((poll(fds, 2, 0) != 1) || (fds[1].revents != POLLOUT)) {
+        puts("FAILED: socket not writable");
+        return -1;
+    }
+    start = xtimer_now_usec();
+    if (poll(fds, 1, TEST_TIMEOUT) != 0) {
+        puts("FAILED: poll() did not time out");
+        return -1;
+    }
+    if ((xtimer_now_usec() - start) < (TEST_TIMEOUT * US_PER_MS)) {
+        puts("FAILED: poll() returned before timeout");
+        return -1;
+    }
+
+    puts("poll() with data");
+    if (_send_to(a, TEST_PORT_B) < 0) {
+        puts("FAILED: sendto()");
+        return -1;
+    }
+    fds[1].events = POLLIN;
+    if ((poll(fds, 3, TEST_TIMEOUT) != 1) || (fds[0].revents != 0) ||
+        (fds[1].revents != POLLIN) || (fds[2].revents != 0)) {
+        puts("FAILED: socket not readable");
+        return -1;
+    }
+    if (recv(b, _buf, sizeof(_buf), 0) != sizeof(TEST_PAYLOAD)) {
+        puts("FAILED: recv()");
+        return -1;
+    }
+    if (poll(fds, 2, 0) != 0) {
+        puts("FAILED: socket still readable after recv()");
+        return -1;
+    }
+
+    puts("poll() with invalid descriptor");
+    fds[0].fd = VFS_MAX_OPEN_FILES;
+    if ((poll(fds, 1, 0) != 1) || (fds[0].revents != POLLNVAL)) {
+        puts("FAILED: invalid descriptor not reported");
+        return -1;
+    }
+    return 0;
+}
+
+static void *_waiter(void *arg)
+{
+    struct pollfd fds[] = { { .fd = _waiter_fd, .events = POLLIN } };
+
+    (void)arg;
+    _waiter_res = poll(fds, 1, 10 * TEST_TIMEOUT);
+    return NULL;
+}
+
+static int _test_poll_busy(int a, int b)
+{
+    struct pollfd fds[] = { { .fd = b, .events = POLLIN } };
+
+    puts("poll() while another thread waits");
+    _waiter_fd = b;
+    _waiter_res = 0;
+    /* the higher priority makes the waiter block in poll() right away */
+    thread_create(_waiter_stack, sizeof(_waiter_stack),
+                  THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                  _waiter, NULL, "waiter");
+    if ((poll(fds, 1, TEST_TIMEOUT) != -1) || (errno != EBUSY)) {
+        puts("FAILED: second waiter not rejected");
+        return -1;
+    }
+    if (poll(fds, 1, 0) != 0) {
+        puts("FAILED: poll() without waiting rejected");
+        return -1;
+    }
+    if (_send_to(a, TEST_PORT_B) < 0) {
+        puts("FAILED: sendto()");
+        return -1;
+    }
+    /* give the stack time to deliver the datagram */
+    xtimer_usleep(TEST_TIMEOUT * US_PER_MS / 10);
+    if (_waiter_res != 1) {
+        puts("FAILED: first waiter not woken up");
+        return -1;
+    }
+    if (recv(b, _buf, sizeof(_buf), 0) != sizeof(TEST_PAYLOAD)) {
+        puts("FAILED: recv()");
+        return -1;
+    }
+    return 0;
+}
+
+static int _test_select(int a, int b)
+{
+    struct timeval timeout = { .tv_sec = 0, .tv_usec = TEST_TIMEOUT * US_PER_MS };
+    int nfds = ((a > b) ? a : b) + 1;
+    fd_set readfds;
+
+    puts("select() without data");
+    FD_ZERO(&readfds);
+    FD_SET(a, &readfds);
+    FD_SET(b, &readfds);
+    if (select(nfds, &readfds, NULL, NULL, &timeout) != 0) {
+        puts("FAILED: select() did not time out");
+        return -1;
+    }
+
+    puts("select() with data");
+    if (_send_to(b, TEST_PORT_A) < 0) {
+        puts("FAILED: sendto()");
+        return -1;
+    }
+    FD_ZERO(&readfds);
+    FD_SET(a, &readfds);
+    FD_SET(b, &readfds);
+    if ((select(nfds, &readfds, NULL, NULL, NULL) != 1) ||
+        !FD_ISSET(a, &readfds) || FD_ISSET(b, &readfds)) {
+        puts("FAILED: socket not readable");
+        return -1;
+    }
+    if (recv(a, _buf, sizeof(_buf), 0) != sizeof(TEST_PAYLOAD)) {
+        puts("FAILED: recv()");
+        return -1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    int a, b, res;
+
+    if (((a = _udp_socket(TEST_PORT_A)) < 0) ||
+        ((b = _udp_socket(TEST_PORT_B)) < 0)) {
+        puts("FAILED: unable to create sockets");
+        return 1;
+    }
+    res = _test_poll(a, b);
+    if (res == 0) {
+        res = _test_poll_busy(a, b);
+    }
+    if (res == 0) {
+        res = _test_select(a, b);
+    }
+    close(a);
+    close(b);
+    if (res == 0) {
+        puts("SUCCESS");
+    }
+    return 0;
+}
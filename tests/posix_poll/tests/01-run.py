@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("poll() without data")
+    child.expect_exact("poll() with data")
+    child.expect_exact("poll() with invalid descriptor")
+    child.expect_exact("poll() while another thread waits")
+    child.expect_exact("select() without data")
+    child.expect_exact("select() with data")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
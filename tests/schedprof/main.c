@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief schedprof test app
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "shell.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define NB_THREADS  (3U)
+
+static char stacks[NB_THREADS][THREAD_STACKSIZE_DEFAULT];
+static kernel_pid_t pids[NB_THREADS];
+
+static void *_thread_fn(void *arg)
+{
+    unsigned next = ((uintptr_t)arg + 1) % NB_THREADS;
+
+    printf("Creating thread #%u, next=%u\n", (unsigned)(uintptr_t)arg, next);
+
+    while (1) {
+        msg_t m1, m2;
+        msg_receive(&m1);
+        /* generate different loads per thread */
+        for (unsigned i = 0; i < (10 * (next + 1)); ++i) {
+            _xtimer_now64();
+        }
+        xtimer_usleep(XTIMER_BACKOFF * 3);
+        msg_send(&m2, pids[next]);
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < NB_THREADS; ++i) {
+        pids[i] = thread_create(stacks[i], sizeof(stacks[i]),
+                                THREAD_PRIORITY_MAIN - 1,
+                                THREAD_CREATE_STACKTEST,
+                                _thread_fn, (void *)(uintptr_t)i, "thread");
+    }
+    xtimer_sleep(1);
+
+    msg_t msg;
+    msg_send(&msg, pids[0]);
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(NULL, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+THREAD_LINE = r'\t  {} \| {:<20} \| \d+\.\d+% \| +\d+ \| +\d+ \| +\d+ \| +\d+'
+HIST = r'\[\d+(,\d+)*\]'
+
+
+def _check_startup(child):
+    for i in range(3):
+        child.expect_exact('Creating thread #{}, next={}'
+                           .format(i, (i + 1) % 3))
+
+
+def _check_table(child):
+    child.sendline('schedprof')
+    child.expect(r'clock: \d+ Hz')
+    child.expect_exact('\tpid | name                 | runtime  | switches '
+                       '| preempt  |   run max  |  wait max')
+    child.expect(THREAD_LINE.format(1, 'idle'))
+    child.expect(THREAD_LINE.format(2, 'main'))
+    for pid in range(3, 6):
+        child.expect(THREAD_LINE.format(pid, 'thread'))
+
+
+def _check_dump(child):
+    child.sendline('schedprof dump')
+    for pid, name in ((1, 'idle'), (2, 'main'), (3, 'thread')):
+        child.expect(r'{{"pid":{},"name":"{}","hz":\d+,"runtime":\d+,'
+                     r'"switches":\d+,"preemptions":\d+,"run_max":\d+,'
+                     r'"wait_max":\d+,"run_hist":{},"wait_hist":{}}}'
+                     .format(pid, name, HIST, HIST))
+
+
+def testfunc(child):
+    _check_startup(child)
+    _check_table(child)
+    _check_dump(child)
+    child.sendline('schedprof reset')
+    child.expect('>')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -21,6 +21,9 @@
 
 #define TEST_FIB_TABLE_SIZE (20)
 static fib_entry_t _entries[TEST_FIB_TABLE_SIZE];
+#ifdef MODULE_FIB_TRIE
+static fib_trie_node_t _trie_nodes[FIB_TRIE_NODES_NUMOF(TEST_FIB_TABLE_SIZE)];
+#endif
 static fib_table_t test_fib_table = { .data.entries = _entries,
                                       .table_type = FIB_TABLE_TYPE_SH,
                                       .size = TEST_FIB_TABLE_SIZE,
@@ -1010,4 +1013,10 @@ Test *tests_fib_tests(void)
 void tests_fib(void)
 {
     TESTS_RUN(tests_fib_tests());
+#ifdef MODULE_FIB_TRIE
+    /* run the same tests with lookups in the trie */
+    test_fib_table.trie.nodes = _trie_nodes;
+    test_fib_table.trie.nodes_numof = FIB_TRIE_NODES_NUMOF(TEST_FIB_TABLE_SIZE);
+    TESTS_RUN(tests_fib_tests());
+#endif
 }
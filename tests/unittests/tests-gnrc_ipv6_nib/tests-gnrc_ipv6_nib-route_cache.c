@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   Checks that changes to the NIB invalidate the IPv6 route cache
+ */
+
+#include <inttypes.h>
+
+#include "net/ipv6/addr.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/gnrc/ipv6/nib/pl.h"
+#include "net/gnrc/ipv6/route_cache.h"
+
+#include "_nib-internal.h"
+
+#include "unittests-constants.h"
+
+#include "tests-gnrc_ipv6_nib.h"
+
+#define LINK_LOCAL_PREFIX   { 0xfe, 0x08, 0, 0, 0, 0, 0, 0 }
+#define GLOBAL_PREFIX       { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0 }
+#define L2ADDR              { 0x90, 0xd5, 0x8e, 0x8c, 0x92, 0x43, 0x73, 0x5c }
+#define GLOBAL_PREFIX_LEN   (30)
+#define IFACE               (6)
+
+static const ipv6_addr_t _dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                           { .u64 = TEST_UINT64 } } };
+static const ipv6_addr_t _next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                { .u64 = TEST_UINT64 } } };
+static const uint8_t _l2addr[] = L2ADDR;
+static unsigned _gen;
+
+static void set_up(void)
+{
+    evtimer_event_t *tmp;
+
+    for (evtimer_event_t *ptr = _nib_evtimer.events;
+         (ptr != NULL) && (tmp = (ptr->next), 1);
+         ptr = tmp) {
+        evtimer_del((evtimer_t *)(&_nib_evtimer), ptr);
+    }
+    _nib_init();
+    _gen = gnrc_ipv6_route_cache_gen;
+}
+
+/* returns true and remembers the current generation if the cache was
+ * invalidated since the last call */
+static bool _invalidated(void)
+{
+    bool res = (gnrc_ipv6_route_cache_gen != _gen);
+
+    _gen = gnrc_ipv6_route_cache_gen;
+    return res;
+}
+
+/*
+ * Adds a neighbor cache entry, then removes it again.
+ * Expected result: both invalidate the route cache
+ */
+static void test_nib_route_cache__nc_set_del(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_nc_set(&_next_hop, IFACE, _l2addr,
+                                                  sizeof(_l2addr)));
+    TEST_ASSERT(_invalidated());
+    gnrc_ipv6_nib_nc_del(&_next_hop, IFACE);
+    TEST_ASSERT(_invalidated());
+}
+
+/*
+ * Adds a route to the forwarding table, then removes it again.
+ * Expected result: both invalidate the route cache
+ */
+static void test_nib_route_cache__ft_add_del(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&_dst, GLOBAL_PREFIX_LEN,
+                                                  &_next_hop, IFACE, 0));
+    TEST_ASSERT(_invalidated());
+    gnrc_ipv6_nib_ft_del(&_dst, GLOBAL_PREFIX_LEN);
+    TEST_ASSERT(_invalidated());
+}
+
+/*
+ * Adds a default route, then removes it again.
+ * Expected result: both invalidate the route cache
+ */
+static void test_nib_route_cache__ft_add_del_default_route(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(NULL, 0, &_next_hop, IFACE,
+                                                  0));
+    TEST_ASSERT(_invalidated());
+    gnrc_ipv6_nib_ft_del(NULL, 0);
+    TEST_ASSERT(_invalidated());
+}
+
+/*
+ * Adds a prefix list entry, then removes it again.
+ * Expected result: both invalidate the route cache
+ */
+static void test_nib_route_cache__pl_set_del(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_pl_set(IFACE, &_dst,
+                                                  GLOBAL_PREFIX_LEN,
+                                                  UINT32_MAX, UINT32_MAX));
+    TEST_ASSERT(_invalidated());
+    gnrc_ipv6_nib_pl_del(IFACE, &_dst, GLOBAL_PREFIX_LEN);
+    TEST_ASSERT(_invalidated());
+}
+
+/*
+ * Adds a route, then looks it up and iterates over the forwarding table.
+ * Expected result: lookups leave the route cache valid
+ */
+static void test_nib_route_cache__ft_get(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    void *state = NULL;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&_dst, GLOBAL_PREFIX_LEN,
+                                                  &_next_hop, IFACE, 0));
+    TEST_ASSERT(_invalidated());
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&_dst, NULL, &fte));
+    while (gnrc_ipv6_nib_ft_iter(NULL, 0, &state, &fte)) {}
+    TEST_ASSERT(!_invalidated());
+}
+
+/*
+ * Removes entries that are not in the NIB.
+ * Expected result: the route cache stays valid
+ */
+static void test_nib_route_cache__del_unknown(void)
+{
+    gnrc_ipv6_nib_nc_del(&_next_hop, IFACE);
+    gnrc_ipv6_nib_ft_del(&_dst, GLOBAL_PREFIX_LEN);
+    gnrc_ipv6_nib_pl_del(IFACE, &_dst, GLOBAL_PREFIX_LEN);
+    TEST_ASSERT(!_invalidated());
+}
+
+Test *tests_gnrc_ipv6_nib_route_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_nib_route_cache__nc_set_del),
+        new_TestFixture(test_nib_route_cache__ft_add_del),
+        new_TestFixture(test_nib_route_cache__ft_add_del_default_route),
+        new_TestFixture(test_nib_route_cache__pl_set_del),
+        new_TestFixture(test_nib_route_cache__ft_get),
+        new_TestFixture(test_nib_route_cache__del_unknown),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, NULL,
+                        fixtures);
+
+    return (Test *)&tests;
+}
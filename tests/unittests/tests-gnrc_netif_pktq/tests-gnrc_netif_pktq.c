@@ -0,0 +1,349 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+
+#include "embUnit.h"
+
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/pktq.h"
+#include "net/gnrc/pktbuf.h"
+#include "thread.h"
+
+#include "unittests-constants.h"
+#include "tests-gnrc_netif_pktq.h"
+
+static int _mock_send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
+static unsigned _mock_send_batch(gnrc_netif_t *netif, gnrc_pktsnip_t **pkts,
+                                 unsigned num);
+
+static const gnrc_netif_ops_t _mock_ops = {
+    .send = _mock_send,
+};
+
+static const gnrc_netif_ops_t _mock_batch_ops = {
+    .send = _mock_send,
+    .send_batch = _mock_send_batch,
+};
+
+static gnrc_netif_t _netif;
+static unsigned _mock_send_calls;
+static int _mock_send_res;
+static unsigned _mock_send_batch_calls;
+static unsigned _mock_send_batch_num;
+static unsigned _mock_send_batch_max;
+
+static int _mock_send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    (void)netif;
+    _mock_send_calls++;
+    /* like any gnrc_netif_ops_t::send() release the packet whatever the
+     * result is */
+    gnrc_pktbuf_release(pkt);
+    return _mock_send_res;
+}
+
+static unsigned _mock_send_batch(gnrc_netif_t *netif, gnrc_pktsnip_t **pkts,
+                                 unsigned num)
+{
+    unsigned sent = (num < _mock_send_batch_max) ? num : _mock_send_batch_max;
+
+    (void)netif;
+    _mock_send_batch_calls++;
+    _mock_send_batch_num = num;
+    for (unsigned i = 0; i < sent; i++) {
+        gnrc_pktbuf_release(pkts[i]);
+    }
+    return sent;
+}
+
+/* builds a packet as it is handed to the interface: netif header + payload */
+static gnrc_pktsnip_t *_pkt(void)
+{
+    gnrc_pktsnip_t *payload = gnrc_pktbuf_add(NULL, TEST_STRING8,
+                                              sizeof(TEST_STRING8),
+                                              GNRC_NETTYPE_UNDEF);
+    gnrc_pktsnip_t *pkt;
+
+    if (payload == NULL) {
+        return NULL;
+    }
+    pkt = gnrc_pktbuf_add(payload, NULL, sizeof(gnrc_netif_hdr_t),
+                          GNRC_NETTYPE_NETIF);
+    if (pkt == NULL) {
+        gnrc_pktbuf_release(payload);
+        return NULL;
+    }
+    gnrc_netif_hdr_init(pkt->data, 0, 0);
+    return pkt;
+}
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+    _netif.ops = &_mock_ops;
+    _netif.pid = thread_getpid();
+    gnrc_netif_pktq_init(&_netif.send_queue);
+    _mock_send_calls = 0;
+    _mock_send_res = sizeof(TEST_STRING8);
+    _mock_send_batch_calls = 0;
+    _mock_send_batch_num = 0;
+    _mock_send_batch_max = GNRC_NETIF_PKTQ_BURST;
+}
+
+static void tear_down(void)
+{
+    gnrc_netif_pktq_flush(&_netif.send_queue);
+}
+
+static void test_netif_pktq_init(void)
+{
+    gnrc_netif_pktq_t *q = &_netif.send_queue;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_usage(q));
+    TEST_ASSERT_NULL(gnrc_netif_pktq_peek(q));
+    TEST_ASSERT_NULL(gnrc_netif_pktq_get(q));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_stats(q)->queued);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_stats(q)->max_fill);
+}
+
+static void test_netif_pktq_put_get__fifo(void)
+{
+    gnrc_netif_pktq_t *q = &_netif.send_queue;
+    gnrc_pktsnip_t *pkts[3];
+
+    for (unsigned i = 0; i < 3; i++) {
+        pkts[i] = _pkt();
+        TEST_ASSERT_NOT_NULL(pkts[i]);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(q, pkts[i]));
+    }
+    TEST_ASSERT_EQUAL_INT(3, gnrc_netif_pktq_usage(q));
+    for (unsigned i = 0; i < 3; i++) {
+        TEST_ASSERT(pkts[i] == gnrc_netif_pktq_peek(q));
+        TEST_ASSERT(pkts[i] == gnrc_netif_pktq_get(q));
+        gnrc_pktbuf_release(pkts[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_usage(q));
+    TEST_ASSERT_NULL(gnrc_netif_pktq_get(q));
+    TEST_ASSERT_EQUAL_INT(3, gnrc_netif_pktq_stats(q)->queued);
+    TEST_ASSERT_EQUAL_INT(3, gnrc_netif_pktq_stats(q)->max_fill);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netif_pktq_put_get__wraparound(void)
+{
+    gnrc_netif_pktq_t *q = &_netif.send_queue;
+    gnrc_pktsnip_t *in = _pkt(), *out = _pkt();
+
+    TEST_ASSERT_NOT_NULL(in);
+    TEST_ASSERT_NOT_NULL(out);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(q, out));
+    /* move through the ring more than once keeping one packet queued */
+    for (unsigned i = 0; i < (2 * GNRC_NETIF_PKTQ_SIZE) + 1; i++) {
+        gnrc_pktsnip_t *tmp;
+
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(q, in));
+        TEST_ASSERT(out == gnrc_netif_pktq_get(q));
+        TEST_ASSERT(in == gnrc_netif_pktq_peek(q));
+        TEST_ASSERT_EQUAL_INT(1, gnrc_netif_pktq_usage(q));
+        tmp = out;
+        out = in;
+        in = tmp;
+    }
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netif_pktq_stats(q)->max_fill);
+    gnrc_pktbuf_release(in);
+}
+
+static void test_netif_pktq_put__full(void)
+{
+    gnrc_netif_pktq_t *q = &_netif.send_queue;
+    gnrc_pktsnip_t *first = NULL, *pkt;
+
+    for (unsigned i = 0; i < GNRC_NETIF_PKTQ_SIZE; i++) {
+        pkt = _pkt();
+        TEST_ASSERT_NOT_NULL(pkt);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(q, pkt));
+        if (first == NULL) {
+            first = pkt;
+        }
+    }
+    pkt = _pkt();
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(-ENOBUFS, gnrc_netif_pktq_put(q, pkt));
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_SIZE, gnrc_netif_pktq_usage(q));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_pktq_stats(q)->dropped);
+    if (GNRC_NETIF_PKTQ_DROP_HEAD) {
+        TEST_ASSERT(first != gnrc_netif_pktq_peek(q));
+    }
+    else {
+        TEST_ASSERT(first == gnrc_netif_pktq_peek(q));
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_netif_pktq_flush(q);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_usage(q));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netif_pktq_send__success(void)
+{
+    gnrc_netif_pktq_t *q = &_netif.send_queue;
+
+    for (unsigned i = 0; i < 2; i++) {
+        gnrc_pktsnip_t *pkt = _pkt();
+
+        TEST_ASSERT_NOT_NULL(pkt);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(q, pkt));
+    }
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netif_pktq_send(&_netif));
+    TEST_ASSERT_EQUAL_INT(2, _mock_send_calls);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_usage(q));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netif_pktq_send__error(void)
+{
+    gnrc_netif_pktq_t *q = &_netif.send_queue;
+    gnrc_pktsnip_t *pkt = _pkt();
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(q, pkt));
+    /* errors other than -EBUSY drop the packet */
+    _mock_send_res = -EINVAL;
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_pktq_send(&_netif));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_usage(q));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_stats(q)->busy);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netif_pktq_send__busy(void)
+{
+    gnrc_netif_pktq_t *q = &_netif.send_queue;
+    gnrc_pktsnip_t *pkt = _pkt(), *second = _pkt(), *payload;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_NOT_NULL(second);
+    payload = pkt->next;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(q, pkt));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(q, second));
+    _mock_send_res = -EBUSY;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_send(&_netif));
+    /* the packet stays untouched at the head of the queue */
+    TEST_ASSERT_EQUAL_INT(1, _mock_send_calls);
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netif_pktq_usage(q));
+    TEST_ASSERT(pkt == gnrc_netif_pktq_peek(q));
+    TEST_ASSERT_EQUAL_INT(1, pkt->users);
+    TEST_ASSERT(payload == pkt->next);
+    TEST_ASSERT_EQUAL_INT(1, payload->users);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_pktq_stats(q)->busy);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    /* retry once the device is not busy anymore keeps the order */
+    _mock_send_res = sizeof(TEST_STRING8);
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netif_pktq_send(&_netif));
+    TEST_ASSERT_EQUAL_INT(3, _mock_send_calls);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_usage(q));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netif_pktq_send__burst(void)
+{
+    gnrc_netif_pktq_t *q = &_netif.send_queue;
+
+    for (unsigned i = 0; i < (GNRC_NETIF_PKTQ_BURST + 1); i++) {
+        gnrc_pktsnip_t *pkt = _pkt();
+
+        TEST_ASSERT_NOT_NULL(pkt);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(q, pkt));
+    }
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_BURST, gnrc_netif_pktq_send(&_netif));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_pktq_usage(q));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_pktq_send(&_netif));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_usage(q));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netif_pktq_send__batch(void)
+{
+    gnrc_netif_pktq_t *q = &_netif.send_queue;
+
+    _netif.ops = &_mock_batch_ops;
+    for (unsigned i = 0; i < (GNRC_NETIF_PKTQ_BURST + 1); i++) {
+        gnrc_pktsnip_t *pkt = _pkt();
+
+        TEST_ASSERT_NOT_NULL(pkt);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(q, pkt));
+    }
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_BURST, gnrc_netif_pktq_send(&_netif));
+    TEST_ASSERT_EQUAL_INT(1, _mock_send_batch_calls);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_BURST, _mock_send_batch_num);
+    TEST_ASSERT_EQUAL_INT(0, _mock_send_calls);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_pktq_usage(q));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_pktq_send(&_netif));
+    TEST_ASSERT_EQUAL_INT(2, _mock_send_batch_calls);
+    TEST_ASSERT_EQUAL_INT(1, _mock_send_batch_num);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_usage(q));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netif_pktq_send__batch_busy(void)
+{
+    gnrc_netif_pktq_t *q = &_netif.send_queue;
+    gnrc_pktsnip_t *pkts[3];
+
+    _netif.ops = &_mock_batch_ops;
+    for (unsigned i = 0; i < 3; i++) {
+        pkts[i] = _pkt();
+        TEST_ASSERT_NOT_NULL(pkts[i]);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(q, pkts[i]));
+    }
+    /* the device only takes the first packet */
+    _mock_send_batch_max = 1;
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_pktq_send(&_netif));
+    TEST_ASSERT_EQUAL_INT(3, _mock_send_batch_num);
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netif_pktq_usage(q));
+    TEST_ASSERT(pkts[1] == gnrc_netif_pktq_peek(q));
+    TEST_ASSERT_EQUAL_INT(1, pkts[1]->users);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_pktq_stats(q)->busy);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    _mock_send_batch_max = GNRC_NETIF_PKTQ_BURST;
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netif_pktq_send(&_netif));
+    TEST_ASSERT_EQUAL_INT(2, _mock_send_batch_num);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_usage(q));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+Test *tests_gnrc_netif_pktq_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_netif_pktq_init),
+        new_TestFixture(test_netif_pktq_put_get__fifo),
+        new_TestFixture(test_netif_pktq_put_get__wraparound),
+        new_TestFixture(test_netif_pktq_put__full),
+        new_TestFixture(test_netif_pktq_send__success),
+        new_TestFixture(test_netif_pktq_send__error),
+        new_TestFixture(test_netif_pktq_send__busy),
+        new_TestFixture(test_netif_pktq_send__burst),
+        new_TestFixture(test_netif_pktq_send__batch),
+        new_TestFixture(test_netif_pktq_send__batch_busy),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_netif_pktq_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&gnrc_netif_pktq_tests;
+}
+
+void tests_gnrc_netif_pktq(void)
+{
+    TESTS_RUN(tests_gnrc_netif_pktq_tests());
+}
+/** @} */
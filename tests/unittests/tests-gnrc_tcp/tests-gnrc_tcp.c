@@ -0,0 +1,393 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "msg.h"
+#include "sched.h"
+#include "thread.h"
+#include "net/tcp.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/tcp.h"
+
+#include "internal/common.h"
+#include "internal/cc.h"
+#include "internal/fsm.h"
+#include "internal/option.h"
+#include "internal/pkt.h"
+#include "internal/rcvbuf.h"
+
+#include "tests-gnrc_tcp.h"
+
+#define TEST_MSG_QUEUE_SIZE (16U)
+#define TEST_PORT           (2000U)
+#define TEST_MSS            (100U)
+#define TEST_IRS            (0xFFFFFFF0U)  /* close to a wrap around */
+
+static msg_t _msg_queue[TEST_MSG_QUEUE_SIZE];
+static gnrc_tcp_tcb_t _tcb;
+static uint8_t _data[TEST_MSS];
+
+/* Returns the next packet TCP handed down to the network layer */
+static gnrc_pktsnip_t *_sent(void)
+{
+    msg_t msg;
+
+    while (msg_try_receive(&msg) == 1) {
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_SND) {
+            return msg.content.ptr;
+        }
+    }
+    return NULL;
+}
+
+static void _drain(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    while ((pkt = _sent()) != NULL) {
+        gnrc_pktbuf_release(pkt);
+    }
+}
+
+static uint32_t _seq(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+
+    return byteorder_ntohl(((tcp_hdr_t *)snp->data)->seq_num);
+}
+
+static void _expect_sent(uint32_t seq)
+{
+    gnrc_pktsnip_t *pkt = _sent();
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(seq, _seq(pkt));
+    gnrc_pktbuf_release(pkt);
+}
+
+static void _expect_none(void)
+{
+    TEST_ASSERT_NULL(_sent());
+}
+
+/* Sends a full sized data segment the way _fsm_call_send() does */
+static void _send_segment(void)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+    uint16_t seq_con = 0;
+
+    TEST_ASSERT_EQUAL_INT(0, _pkt_build(&_tcb, &pkt, &seq_con, MSK_ACK, _tcb.snd_nxt,
+                                        _tcb.rcv_nxt, _data, sizeof(_data)));
+    TEST_ASSERT_EQUAL_INT(0, _pkt_setup_retransmit(&_tcb, pkt, false));
+    TEST_ASSERT_EQUAL_INT(0, _pkt_send(&_tcb, pkt, seq_con, false));
+}
+
+static void _send_segments(unsigned num)
+{
+    uint32_t seq = _tcb.snd_nxt;
+
+    for (unsigned i = 0; i < num; i++) {
+        _send_segment();
+        _expect_sent(seq + (i * TEST_MSS));
+    }
+    TEST_ASSERT_EQUAL_INT(num, _tcb.rtx_len);
+}
+
+static uint32_t _store(uint32_t seq, uint8_t *data, size_t len)
+{
+    gnrc_pktsnip_t *snp = gnrc_pktbuf_add(NULL, data, len, GNRC_NETTYPE_UNDEF);
+    uint32_t readable = 0;
+
+    if (snp != NULL) {
+        readable = _rcvbuf_store(&_tcb, seq, snp);
+        gnrc_pktbuf_release(snp);
+    }
+    return readable;
+}
+
+static void set_up(void)
+{
+    /* Packets handed down by TCP end up in the message queue of this thread */
+    if (!thread_has_msg_queue(sched_active_thread)) {
+        msg_init_queue(_msg_queue, TEST_MSG_QUEUE_SIZE);
+    }
+    gnrc_tcp_pid = thread_getpid();
+    gnrc_pktbuf_init();
+    _rcvbuf_init();
+    for (unsigned i = 0; i < sizeof(_data); i++) {
+        _data[i] = i;
+    }
+
+    /* Open a connection and pretend the peer acknowledged the SYN */
+    gnrc_tcp_tcb_init(&_tcb);
+    _tcb.peer_port = TEST_PORT;
+    _fsm(&_tcb, FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
+    _drain();
+    _pkt_acknowledge(&_tcb, _tcb.snd_nxt);
+    _tcb.snd_una = _tcb.snd_nxt;
+    _tcb.snd_wnd = GNRC_TCP_DEFAULT_WINDOW;
+    _tcb.irs = TEST_IRS - 1;
+    _tcb.rcv_nxt = TEST_IRS;
+    _tcb.mss = TEST_MSS;
+    _tcb.state = FSM_STATE_ESTABLISHED;
+    _cc_init(&_tcb);
+}
+
+static void tear_down(void)
+{
+    if (_tcb.state != FSM_STATE_CLOSED) {
+        _fsm(&_tcb, FSM_EVENT_CALL_ABORT, NULL, NULL, 0);
+    }
+    _drain();
+}
+
+static void test_rtx_queue__partial_ack(void)
+{
+    uint32_t una = _tcb.snd_una;
+
+    _send_segments(3);
+    /* Segments are released only if they were acknowledged completely */
+    TEST_ASSERT_EQUAL_INT(0, _pkt_acknowledge(&_tcb, una + TEST_MSS - 1));
+    TEST_ASSERT_EQUAL_INT(3, _tcb.rtx_len);
+    TEST_ASSERT_EQUAL_INT(1, _pkt_acknowledge(&_tcb, una + TEST_MSS + 1));
+    TEST_ASSERT_EQUAL_INT(2, _tcb.rtx_len);
+    TEST_ASSERT_EQUAL_INT(una + TEST_MSS, _seq(_tcb.rtx_queue[0]));
+    TEST_ASSERT_EQUAL_INT(una + (2 * TEST_MSS), _seq(_tcb.rtx_queue[1]));
+    TEST_ASSERT_EQUAL_INT(2, _pkt_acknowledge(&_tcb, una + (3 * TEST_MSS)));
+    TEST_ASSERT_EQUAL_INT(0, _tcb.rtx_len);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_rtx_queue__sack(void)
+{
+    uint32_t una = _tcb.snd_una;
+
+    _send_segments(3);
+    _pkt_sack(&_tcb, una + TEST_MSS, una + (2 * TEST_MSS));
+    TEST_ASSERT_EQUAL_INT(0x2, _tcb.rtx_sacked);
+    /* Blocks covering a segment only partially are ignored */
+    _pkt_sack(&_tcb, una + (2 * TEST_MSS), una + (3 * TEST_MSS) - 1);
+    TEST_ASSERT_EQUAL_INT(0x2, _tcb.rtx_sacked);
+
+    /* A fast retransmit sends the oldest segment that was not SACKed */
+    TEST_ASSERT_EQUAL_INT(1, _pkt_acknowledge(&_tcb, una + TEST_MSS));
+    _tcb.snd_una = una + TEST_MSS;
+    TEST_ASSERT_EQUAL_INT(0x1, _tcb.rtx_sacked);
+    TEST_ASSERT_EQUAL_INT(0, _pkt_retransmit(&_tcb, false));
+    _expect_sent(una + (2 * TEST_MSS));
+
+    /* A timeout forgets about SACKed segments */
+    TEST_ASSERT_EQUAL_INT(0, _pkt_retransmit(&_tcb, true));
+    _expect_sent(una + TEST_MSS);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.rtx_sacked);
+}
+
+static void test_cc__fast_retransmit_small_window(void)
+{
+    uint32_t una = _tcb.snd_una;
+
+    /* Three segments in flight can not produce three duplicate ACKs */
+    _send_segments(3);
+    _cc_dup_ack(&_tcb);
+    TEST_ASSERT(!(_tcb.status & STATUS_FAST_RECOVERY));
+    _expect_none();
+    _cc_dup_ack(&_tcb);
+    TEST_ASSERT(_tcb.status & STATUS_FAST_RECOVERY);
+    _expect_sent(una);
+    TEST_ASSERT_EQUAL_INT(_tcb.snd_nxt, _tcb.recover);
+    TEST_ASSERT_EQUAL_INT(_tcb.ssthresh + (2 * TEST_MSS), _tcb.cwnd);
+}
+
+static void test_cc__fast_retransmit_single_segment(void)
+{
+    _send_segments(1);
+    for (unsigned i = 0; i < 4; i++) {
+        _cc_dup_ack(&_tcb);
+    }
+    TEST_ASSERT(!(_tcb.status & STATUS_FAST_RECOVERY));
+    _expect_none();
+}
+
+static void test_cc__newreno(void)
+{
+    uint32_t una = _tcb.snd_una;
+
+    _send_segments(3);
+    _cc_dup_ack(&_tcb);
+    _cc_dup_ack(&_tcb);
+    TEST_ASSERT(_tcb.status & STATUS_FAST_RECOVERY);
+    _expect_sent(una);
+
+    /* Partial ACK: The next segment is retransmitted right away */
+    TEST_ASSERT_EQUAL_INT(1, _pkt_acknowledge(&_tcb, una + TEST_MSS));
+    _tcb.snd_una = una + TEST_MSS;
+    _cc_ack(&_tcb, TEST_MSS);
+    TEST_ASSERT(_tcb.status & STATUS_FAST_RECOVERY);
+    _expect_sent(una + TEST_MSS);
+
+    /* Full ACK: Leave fast recovery with at most ssthresh */
+    TEST_ASSERT_EQUAL_INT(2, _pkt_acknowledge(&_tcb, una + (3 * TEST_MSS)));
+    _tcb.snd_una = una + (3 * TEST_MSS);
+    _cc_ack(&_tcb, 2 * TEST_MSS);
+    TEST_ASSERT(!(_tcb.status & STATUS_FAST_RECOVERY));
+    TEST_ASSERT(_tcb.cwnd <= _tcb.ssthresh);
+
+    /* A loss in the next window is recovered from as well */
+    una = _tcb.snd_una;
+    TEST_ASSERT_EQUAL_INT(una, _tcb.recover);
+    _send_segments(3);
+    _cc_dup_ack(&_tcb);
+    _cc_dup_ack(&_tcb);
+    TEST_ASSERT(_tcb.status & STATUS_FAST_RECOVERY);
+    _expect_sent(una);
+}
+
+static void test_cc__avoid_grows(void)
+{
+    uint32_t cwnd = 10 * TEST_MSS;
+
+    _tcb.cwnd = cwnd;
+    _tcb.ssthresh = cwnd;
+    /* Without an RTT sample CUBIC's target is the current window for a while */
+    _tcb.srtt = RTO_UNINITIALIZED;
+    for (unsigned i = 0; i < 10; i++) {
+        _cc_ack(&_tcb, TEST_MSS);
+        TEST_ASSERT(_tcb.cwnd > cwnd);
+        cwnd = _tcb.cwnd;
+    }
+}
+
+static void test_option__sack(void)
+{
+    uint8_t buf[sizeof(tcp_hdr_t) + 4 + (8 * GNRC_TCP_SACK_BLOCKS)];
+    uint8_t *opt = buf + sizeof(tcp_hdr_t);
+    tcp_hdr_t *hdr = (tcp_hdr_t *)buf;
+    uint32_t una = _tcb.snd_una;
+    size_t len;
+
+    _send_segments(3);
+    memset(buf, 0, sizeof(buf));
+
+    /* Report the last two segments as received out of order */
+    _tcb.sack[0][0] = una + (2 * TEST_MSS);
+    _tcb.sack[0][1] = una + (3 * TEST_MSS);
+    _tcb.sack[1][0] = una + TEST_MSS;
+    _tcb.sack[1][1] = una + (2 * TEST_MSS);
+    _tcb.sack_len = 2;
+    len = _option_build_sack(&_tcb, opt);
+    TEST_ASSERT_EQUAL_INT(4 + (2 * 8), len);
+    TEST_ASSERT_EQUAL_INT(TCP_OPTION_KIND_NOP, opt[0]);
+    TEST_ASSERT_EQUAL_INT(TCP_OPTION_KIND_NOP, opt[1]);
+    TEST_ASSERT_EQUAL_INT(TCP_OPTION_KIND_SACK, opt[2]);
+    TEST_ASSERT_EQUAL_INT(2 + (2 * 8), opt[3]);
+    _tcb.sack_len = 0;
+
+    hdr->off_ctl = byteorder_htons(_option_build_offset_control(TCP_HDR_OFFSET_MIN + (len / 4),
+                                                                MSK_ACK));
+    TEST_ASSERT_EQUAL_INT(0, _option_parse(&_tcb, hdr));
+    TEST_ASSERT_EQUAL_INT(0x6, _tcb.rtx_sacked);
+
+    /* Blocks must be 8 bytes long */
+    opt[3] -= 1;
+    TEST_ASSERT(_option_parse(&_tcb, hdr) < 0);
+}
+
+static void test_rcvbuf__reassembly(void)
+{
+    uint8_t out[3 * 10];
+
+    /* Out of order data is merged into one block */
+    TEST_ASSERT_EQUAL_INT(0, _store(TEST_IRS + 20, _data + 20, 10));
+    TEST_ASSERT_EQUAL_INT(0, _store(TEST_IRS + 10, _data + 10, 10));
+    TEST_ASSERT_EQUAL_INT(0, _store(TEST_IRS + 15, _data + 15, 10));
+    TEST_ASSERT_EQUAL_INT(1, _tcb.sack_len);
+    TEST_ASSERT_EQUAL_INT(TEST_IRS + 10, _tcb.sack[0][0]);
+    TEST_ASSERT_EQUAL_INT(TEST_IRS + 30, _tcb.sack[0][1]);
+
+    /* The missing data makes everything readable */
+    TEST_ASSERT_EQUAL_INT(30, _store(TEST_IRS, _data, 10));
+    TEST_ASSERT_EQUAL_INT(0, _tcb.sack_len);
+    TEST_ASSERT_EQUAL_INT(TEST_IRS + 30, _tcb.rcv_nxt);
+    TEST_ASSERT_EQUAL_INT(sizeof(out), ringbuffer_get(&_tcb.rcv_buf, (char *)out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data, out, sizeof(out)));
+
+    /* Data received before is skipped */
+    TEST_ASSERT_EQUAL_INT(5, _store(TEST_IRS + 25, _data + 25, 10));
+    TEST_ASSERT_EQUAL_INT(TEST_IRS + 35, _tcb.rcv_nxt);
+}
+
+static void test_rcvbuf__evict_oldest_block(void)
+{
+    for (unsigned i = 1; i <= GNRC_TCP_SACK_BLOCKS + 1; i++) {
+        TEST_ASSERT_EQUAL_INT(0, _store(TEST_IRS + (20 * i), _data, 10));
+    }
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_SACK_BLOCKS, _tcb.sack_len);
+    /* Most recent block first, the oldest block was dropped */
+    for (unsigned i = 0; i < GNRC_TCP_SACK_BLOCKS; i++) {
+        TEST_ASSERT_EQUAL_INT(TEST_IRS + (20 * (GNRC_TCP_SACK_BLOCKS + 1 - i)), _tcb.sack[i][0]);
+        TEST_ASSERT_EQUAL_INT(TEST_IRS + (20 * (GNRC_TCP_SACK_BLOCKS + 1 - i)) + 10,
+                              _tcb.sack[i][1]);
+    }
+}
+
+static void test_fsm__retransmit_gives_up(void)
+{
+    uint32_t una = _tcb.snd_una;
+
+    _send_segments(1);
+    TEST_ASSERT_EQUAL_INT(0, _fsm(&_tcb, FSM_EVENT_TIMEOUT_RETRANSMIT, NULL, NULL, 0));
+    _expect_sent(una);
+    TEST_ASSERT_EQUAL_INT(FSM_STATE_ESTABLISHED, _tcb.state);
+
+    /* Pretend the segment stayed unacknowledged for too long */
+    _tcb.rtx_start -= GNRC_TCP_CONNECTION_TIMEOUT_DURATION;
+    TEST_ASSERT_EQUAL_INT(0, _fsm(&_tcb, FSM_EVENT_TIMEOUT_RETRANSMIT, NULL, NULL, 0));
+    _expect_none();
+    TEST_ASSERT_EQUAL_INT(FSM_STATE_CLOSED, _tcb.state);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+
+    /* The abort is reported to the next call only */
+    TEST_ASSERT_EQUAL_INT(-ECONNABORTED, gnrc_tcp_send(&_tcb, _data, sizeof(_data), 0));
+    TEST_ASSERT_EQUAL_INT(-ENOTCONN, gnrc_tcp_recv(&_tcb, _data, sizeof(_data), 0));
+}
+
+Test *tests_gnrc_tcp_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_rtx_queue__partial_ack),
+        new_TestFixture(test_rtx_queue__sack),
+        new_TestFixture(test_cc__fast_retransmit_small_window),
+        new_TestFixture(test_cc__fast_retransmit_single_segment),
+        new_TestFixture(test_cc__newreno),
+        new_TestFixture(test_cc__avoid_grows),
+        new_TestFixture(test_option__sack),
+        new_TestFixture(test_rcvbuf__reassembly),
+        new_TestFixture(test_rcvbuf__evict_oldest_block),
+        new_TestFixture(test_fsm__retransmit_gives_up),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_tcp_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&gnrc_tcp_tests;
+}
+
+void tests_gnrc_tcp(void)
+{
+    TESTS_RUN(tests_gnrc_tcp_tests());
+}
+/** @} */
@@ -13,6 +13,7 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
@@ -21,6 +22,30 @@
 #include "unittests-constants.h"
 #include "tests-inet_csum.h"
 
+/* source: https://www.cloudshark.org/captures/ea72fbab241b (No. 1) */
+static const uint8_t _dns_query[] = {
+    0xc0, 0xa8, 0x01, 0x91, 0x4b, 0x4b, 0x4b, 0x4b, /* IPv4 source + dest*/
+    0xf6, 0xfb, 0x00, 0x35, 0x00, 0x27, 0xd1, 0xa2, /* UDP header */
+    0xa5, 0x6f, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, /* DNS payload */
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x74, 0x65, 0x73,
+    0x74, 0x2d, 0x69, 0x70, 0x76, 0x36, 0x03, 0x63,
+    0x6f, 0x6d, 0x00, 0x00, 0x01, 0x00, 0x01,
+};
+
+/* straight-forward 16-bit at a time reference implementation */
+static uint16_t _ref_csum(const uint8_t *buf, size_t len)
+{
+    uint32_t csum = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        csum += (i & 1) ? buf[i] : (buf[i] << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
 static void test_inet_csum__rfc_example(void)
 {
     /* source: https://tools.ietf.org/html/rfc1071#section-3 */
@@ -165,6 +190,99 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+static void test_inet_csum__unaligned(void)
+{
+    /* 4 byte aligned, so the buffer can be shifted by any offset */
+    static uint32_t buf[(128 + 4) / sizeof(uint32_t)];
+    uint8_t *data = (uint8_t *)buf;
+
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        /* many set high bits provoke lots of carries */
+        data[i] = 0xff - (i * 3);
+    }
+    for (unsigned offset = 0; offset < 4; offset++) {
+        for (unsigned len = 0; len <= 128; len++) {
+            TEST_ASSERT_EQUAL_INT(_ref_csum(&data[offset], len),
+                                  inet_csum(0, &data[offset], len));
+        }
+    }
+}
+
+static void test_inet_csum__iolist(void)
+{
+    /* split into odd-sized parts, including an empty one */
+    iolist_t parts[] = {
+        { .iol_base = (void *)&_dns_query[0], .iol_len = 7 },
+        { .iol_base = NULL, .iol_len = 0 },
+        { .iol_base = (void *)&_dns_query[7], .iol_len = 21 },
+        { .iol_base = (void *)&_dns_query[28],
+          .iol_len = sizeof(_dns_query) - 28 },
+    };
+    size_t accum_len = 0;
+
+    parts[0].iol_next = &parts[1];
+    parts[1].iol_next = &parts[2];
+    parts[2].iol_next = &parts[3];
+    parts[3].iol_next = NULL;
+    /* result unnormalized: take 1's-complement of 0
+     * set next header and payload length as initial value */
+    TEST_ASSERT_EQUAL_INT(0xffff, inet_csum_iolist(17 + 39, parts, NULL,
+                                                   &accum_len));
+    TEST_ASSERT_EQUAL_INT(sizeof(_dns_query), accum_len);
+}
+
+static void test_inet_csum__iolist_end(void)
+{
+    iolist_t parts[] = {
+        { .iol_base = (void *)&_dns_query[0], .iol_len = 11 },
+        { .iol_base = (void *)&_dns_query[11], .iol_len = 13 },
+        { .iol_base = (void *)&_dns_query[24],
+          .iol_len = sizeof(_dns_query) - 24 },
+    };
+    uint16_t sum;
+    size_t accum_len = 11;
+
+    parts[0].iol_next = &parts[1];
+    parts[1].iol_next = &parts[2];
+    parts[2].iol_next = NULL;
+    /* start in the middle of the domain with an odd accumulated length */
+    sum = inet_csum(0, &_dns_query[0], 11);
+    sum = inet_csum_iolist(sum, &parts[1], &parts[2], &accum_len);
+    TEST_ASSERT_EQUAL_INT(24, accum_len);
+    TEST_ASSERT_EQUAL_INT(_ref_csum(_dns_query, 24), sum);
+}
+
+static void test_inet_csum__update16(void)
+{
+    /* source: https://tools.ietf.org/html/rfc1071#section-3 */
+    uint8_t data[] = {
+        0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7
+    };
+    uint16_t csum = ~inet_csum(0, data, sizeof(data));
+
+    csum = inet_csum_update16(csum, 0xf203, 0x1234);
+    data[2] = 0x12;
+    data[3] = 0x34;
+    TEST_ASSERT_EQUAL_INT((uint16_t)~inet_csum(0, data, sizeof(data)), csum);
+}
+
+static void test_inet_csum__update(void)
+{
+    uint8_t data[sizeof(_dns_query)];
+    /* new IPv4 source + destination */
+    static const uint8_t addrs[] = {
+        0x0a, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfe,
+    };
+    uint16_t csum;
+
+    memcpy(data, _dns_query, sizeof(data));
+    csum = ~inet_csum(17 + 39, data, sizeof(data));
+    csum = inet_csum_update(csum, data, addrs, sizeof(addrs));
+    memcpy(data, addrs, sizeof(addrs));
+    TEST_ASSERT_EQUAL_INT((uint16_t)~inet_csum(17 + 39, data, sizeof(data)),
+                          csum);
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +294,11 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__unaligned),
+        new_TestFixture(test_inet_csum__iolist),
+        new_TestFixture(test_inet_csum__iolist_end),
+        new_TestFixture(test_inet_csum__update16),
+        new_TestFixture(test_inet_csum__update),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
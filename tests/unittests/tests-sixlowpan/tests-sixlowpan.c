@@ -22,6 +22,7 @@
 #include "unittests-constants.h"
 
 #include "net/sixlowpan.h"
+#include "net/sixlowpan/sfr.h"
 
 #define NALP_0  (0x00) /* 00 00 00 00 */
 #define NALP_1  (0x01) /* 00 00 00 01 */
@@ -44,6 +45,8 @@
 #define MESH_DISP       (0xB3)  /* 10 11 00 11 */
 #define FRAG1_DISP      (0xC5)  /* 11 00 01 01 */
 #define FRAGN_DISP      (0xE5)  /* 11 10 01 01 */
+#define RFRAG_DISP      (0xE9)  /* 11 10 10 01 */
+#define RFRAG_ACK_DISP  (0xEA)  /* 11 10 10 10 */
 
 
 /* Test with 6LoWPAN dispatch byte indicating a none-LoWPAN frame (NALP = Not a
@@ -147,6 +150,51 @@ static void test_sixlowpan_nalp_is_6lowpan_frame_12(void)
     TEST_ASSERT(!sixlowpan_nalp(FRAGN_DISP));
 }
 
+static void test_sixlowpan_sfr_is(void)
+{
+    sixlowpan_sfr_t hdr = { .tag = TEST_UINT8 };
+
+    hdr.disp_ecn = RFRAG_DISP;
+    TEST_ASSERT(sixlowpan_sfr_is(&hdr));
+    TEST_ASSERT(sixlowpan_sfr_rfrag_is(&hdr));
+    TEST_ASSERT(!sixlowpan_sfr_ack_is(&hdr));
+    hdr.disp_ecn = RFRAG_ACK_DISP;
+    TEST_ASSERT(sixlowpan_sfr_is(&hdr));
+    TEST_ASSERT(!sixlowpan_sfr_rfrag_is(&hdr));
+    TEST_ASSERT(sixlowpan_sfr_ack_is(&hdr));
+    hdr.disp_ecn = FRAGN_DISP;
+    TEST_ASSERT(!sixlowpan_sfr_is(&hdr));
+}
+
+static void test_sixlowpan_sfr_rfrag_init(void)
+{
+    sixlowpan_sfr_rfrag_t hdr;
+    const uint8_t exp[] = { 0xe8, TEST_UINT8, 0xcc, 0x50, 0x01, 0x23 };
+
+    sixlowpan_sfr_rfrag_init(&hdr, TEST_UINT8, 19, 80, 0x0123);
+    TEST_ASSERT(!sixlowpan_sfr_rfrag_ack_req(&hdr));
+    sixlowpan_sfr_rfrag_set_ack_req(&hdr);
+    TEST_ASSERT_EQUAL_INT(sizeof(exp), sizeof(hdr));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(exp, &hdr, sizeof(exp)));
+    TEST_ASSERT(sixlowpan_sfr_rfrag_ack_req(&hdr));
+    TEST_ASSERT_EQUAL_INT(19, sixlowpan_sfr_rfrag_get_seq(&hdr));
+    TEST_ASSERT_EQUAL_INT(80, sixlowpan_sfr_rfrag_get_frag_size(&hdr));
+    TEST_ASSERT_EQUAL_INT(0x0123, sixlowpan_sfr_rfrag_get_offset(&hdr));
+}
+
+static void test_sixlowpan_sfr_ack_init(void)
+{
+    sixlowpan_sfr_ack_t hdr;
+    const uint8_t exp[] = { 0xea, TEST_UINT8, 0xa0, 0x00, 0x00, 0x01 };
+
+    sixlowpan_sfr_ack_init(&hdr, TEST_UINT8,
+                           sixlowpan_sfr_ack_bit(0) |
+                           sixlowpan_sfr_ack_bit(2) |
+                           sixlowpan_sfr_ack_bit(SIXLOWPAN_SFR_SEQ_MAX));
+    TEST_ASSERT_EQUAL_INT(sizeof(exp), sizeof(hdr));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(exp, &hdr, sizeof(exp)));
+}
+
 Test *test_sixlowpan_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -170,6 +218,9 @@ Test *test_sixlowpan_tests(void)
         new_TestFixture(test_sixlowpan_nalp_is_6lowpan_frame_10),
         new_TestFixture(test_sixlowpan_nalp_is_6lowpan_frame_11),
         new_TestFixture(test_sixlowpan_nalp_is_6lowpan_frame_12),
+        new_TestFixture(test_sixlowpan_sfr_is),
+        new_TestFixture(test_sixlowpan_sfr_rfrag_init),
+        new_TestFixture(test_sixlowpan_sfr_ack_init),
     };
 
     EMB_UNIT_TESTCALLER(test_sixlowpan_tests_caller, NULL, NULL, fixtures);
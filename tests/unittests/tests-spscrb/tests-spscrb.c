@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "spscrb.h"
+
+#include "tests-spscrb.h"
+
+#define RB_SIZE     (8U)
+#define NUMOF(a)    (sizeof(a) / sizeof((a)[0]))
+
+static uint16_t _buf[RB_SIZE];
+static spscrb_t _rb = SPSCRB_INIT(_buf);
+
+static void set_up(void)
+{
+    memset(_buf, 0, sizeof(_buf));
+    spscrb_init(&_rb, _buf, sizeof(_buf[0]), RB_SIZE);
+}
+
+/* moves the counters of the empty ringbuffer so the next element is put at
+ * index idx; the counters overflow together with the index */
+static void _set_counters(unsigned idx)
+{
+    unsigned cnt = UINT_MAX - (RB_SIZE - 1) + idx;
+
+    _rb.reads = cnt;
+    _rb.writes = cnt;
+}
+
+static void test_spscrb_init(void)
+{
+    static const spscrb_t rb = SPSCRB_INIT(_buf);
+
+    TEST_ASSERT(rb.buf == (uint8_t *)_buf);
+    TEST_ASSERT_EQUAL_INT(sizeof(_buf[0]), rb.elem_size);
+    TEST_ASSERT_EQUAL_INT(RB_SIZE, rb.size);
+    TEST_ASSERT_EQUAL_INT(1, spscrb_empty(&_rb));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_full(&_rb));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_avail(&_rb));
+    TEST_ASSERT_EQUAL_INT(RB_SIZE, spscrb_free(&_rb));
+}
+
+static void test_spscrb_put_get(void)
+{
+    static const uint16_t in[] = { 1, 2, 3, 4, 5 };
+    uint16_t out[NUMOF(in)];
+
+    TEST_ASSERT_EQUAL_INT(NUMOF(in), spscrb_put(&_rb, in, NUMOF(in)));
+    TEST_ASSERT_EQUAL_INT(NUMOF(in), spscrb_avail(&_rb));
+    TEST_ASSERT_EQUAL_INT(2, spscrb_get(&_rb, out, 2));
+    TEST_ASSERT_EQUAL_INT(3, spscrb_get(&_rb, &out[2], NUMOF(in)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(in, out, sizeof(in)));
+    TEST_ASSERT_EQUAL_INT(1, spscrb_empty(&_rb));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_get(&_rb, out, 1));
+}
+
+static void test_spscrb_put__full(void)
+{
+    uint16_t in[RB_SIZE + 2];
+
+    for (unsigned i = 0; i < NUMOF(in); i++) {
+        in[i] = i;
+    }
+    TEST_ASSERT_EQUAL_INT(RB_SIZE, spscrb_put(&_rb, in, NUMOF(in)));
+    TEST_ASSERT_EQUAL_INT(1, spscrb_full(&_rb));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_free(&_rb));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_put(&_rb, in, 1));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(in, _buf, sizeof(_buf)));
+}
+
+static void test_spscrb_put_get__wraparound(void)
+{
+    static const uint16_t in[] = { 0xa1, 0xa2, 0xa3, 0xa4, 0xa5 };
+    uint16_t out[NUMOF(in)];
+
+    /* data and both counters wrap around in the middle of the copy */
+    _set_counters(RB_SIZE - 2);
+    TEST_ASSERT_EQUAL_INT(NUMOF(in), spscrb_put(&_rb, in, NUMOF(in)));
+    TEST_ASSERT(_rb.writes < _rb.reads);
+    TEST_ASSERT_EQUAL_INT(NUMOF(in), spscrb_avail(&_rb));
+    TEST_ASSERT_EQUAL_INT(RB_SIZE - NUMOF(in), spscrb_free(&_rb));
+    TEST_ASSERT_EQUAL_INT(0xa1, _buf[RB_SIZE - 2]);
+    TEST_ASSERT_EQUAL_INT(0xa2, _buf[RB_SIZE - 1]);
+    TEST_ASSERT_EQUAL_INT(0xa3, _buf[0]);
+    TEST_ASSERT_EQUAL_INT(NUMOF(in), spscrb_get(&_rb, out, RB_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(in, out, sizeof(in)));
+    TEST_ASSERT_EQUAL_INT(1, spscrb_empty(&_rb));
+}
+
+static void test_spscrb_drop(void)
+{
+    static const uint16_t in[] = { 1, 2, 3 };
+    uint16_t out;
+
+    _set_counters(RB_SIZE - 1);
+    TEST_ASSERT_EQUAL_INT(NUMOF(in), spscrb_put(&_rb, in, NUMOF(in)));
+    TEST_ASSERT_EQUAL_INT(2, spscrb_drop(&_rb, 2));
+    TEST_ASSERT_EQUAL_INT(1, spscrb_get(&_rb, &out, 1));
+    TEST_ASSERT_EQUAL_INT(3, out);
+    TEST_ASSERT_EQUAL_INT(0, spscrb_drop(&_rb, 1));
+}
+
+static void test_spscrb_peek_commit_write(void)
+{
+    uint16_t *region;
+    uint16_t out[4];
+    unsigned n;
+
+    _set_counters(RB_SIZE - 2);
+    /* region ends at the end of the buffer */
+    region = spscrb_peek_write(&_rb, &n);
+    TEST_ASSERT(region == &_buf[RB_SIZE - 2]);
+    TEST_ASSERT_EQUAL_INT(2, n);
+    region[0] = 0xb1;
+    region[1] = 0xb2;
+    /* nothing visible to the consumer before the commit */
+    TEST_ASSERT_EQUAL_INT(1, spscrb_empty(&_rb));
+    spscrb_commit_write(&_rb, n);
+    TEST_ASSERT_EQUAL_INT(2, spscrb_avail(&_rb));
+    /* next region starts at the begin of the buffer and stops at reads */
+    region = spscrb_peek_write(&_rb, &n);
+    TEST_ASSERT(region == &_buf[0]);
+    TEST_ASSERT_EQUAL_INT(RB_SIZE - 2, n);
+    region[0] = 0xb3;
+    region[1] = 0xb4;
+    spscrb_commit_write(&_rb, 2);
+    TEST_ASSERT_EQUAL_INT(4, spscrb_get(&_rb, out, NUMOF(out)));
+    TEST_ASSERT_EQUAL_INT(0xb1, out[0]);
+    TEST_ASSERT_EQUAL_INT(0xb2, out[1]);
+    TEST_ASSERT_EQUAL_INT(0xb3, out[2]);
+    TEST_ASSERT_EQUAL_INT(0xb4, out[3]);
+}
+
+static void test_spscrb_peek_write__full(void)
+{
+    uint16_t in[RB_SIZE] = { 0 };
+    unsigned n;
+
+    TEST_ASSERT_EQUAL_INT(RB_SIZE, spscrb_put(&_rb, in, RB_SIZE));
+    TEST_ASSERT_NULL(spscrb_peek_write(&_rb, &n));
+    TEST_ASSERT_EQUAL_INT(0, n);
+}
+
+static void test_spscrb_peek_commit_read(void)
+{
+    static const uint16_t in[] = { 0xc1, 0xc2, 0xc3 };
+    const uint16_t *region;
+    unsigned n;
+
+    TEST_ASSERT_NULL(spscrb_peek_read(&_rb, &n));
+    TEST_ASSERT_EQUAL_INT(0, n);
+    _set_counters(RB_SIZE - 1);
+    TEST_ASSERT_EQUAL_INT(NUMOF(in), spscrb_put(&_rb, in, NUMOF(in)));
+    /* region ends at the end of the buffer */
+    region = spscrb_peek_read(&_rb, &n);
+    TEST_ASSERT(region == &_buf[RB_SIZE - 1]);
+    TEST_ASSERT_EQUAL_INT(1, n);
+    TEST_ASSERT_EQUAL_INT(0xc1, region[0]);
+    /* peeking does not consume */
+    TEST_ASSERT_EQUAL_INT(NUMOF(in), spscrb_avail(&_rb));
+    spscrb_commit_read(&_rb, n);
+    TEST_ASSERT_EQUAL_INT(RB_SIZE - 2, spscrb_free(&_rb));
+    region = spscrb_peek_read(&_rb, &n);
+    TEST_ASSERT(region == &_buf[0]);
+    TEST_ASSERT_EQUAL_INT(2, n);
+    TEST_ASSERT_EQUAL_INT(0xc2, region[0]);
+    TEST_ASSERT_EQUAL_INT(0xc3, region[1]);
+    spscrb_commit_read(&_rb, n);
+    TEST_ASSERT_EQUAL_INT(1, spscrb_empty(&_rb));
+}
+
+Test *tests_spscrb_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_spscrb_init),
+        new_TestFixture(test_spscrb_put_get),
+        new_TestFixture(test_spscrb_put__full),
+        new_TestFixture(test_spscrb_put_get__wraparound),
+        new_TestFixture(test_spscrb_drop),
+        new_TestFixture(test_spscrb_peek_commit_write),
+        new_TestFixture(test_spscrb_peek_write__full),
+        new_TestFixture(test_spscrb_peek_commit_read),
+    };
+
+    EMB_UNIT_TESTCALLER(spscrb_tests, set_up, NULL, fixtures);
+
+    return (Test *)&spscrb_tests;
+}
+
+void tests_spscrb(void)
+{
+    TESTS_RUN(tests_spscrb_tests());
+}
+/** @} */
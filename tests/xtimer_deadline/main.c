@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the deadline queue behind
+ *              xtimer_msg_receive_timeout() and xtimer_mbox_get_timeout()
+ *
+ * Covers the timeout path, a message delivered before the timeout and a
+ * message delivered before the timeout to a thread that is then preempted
+ * until after its deadline expired.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "cib.h"
+#include "mbox.h"
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define TEST_TIMEOUT    (20U * US_PER_MS)
+#define TEST_MSG_TYPE   (0x4242)
+#define CMD_MSG         (0)
+#define CMD_MBOX        (1)
+#define QUEUE_SIZE      (4)
+
+static char _stack[THREAD_STACKSIZE_MAIN];
+static msg_t _main_queue[QUEUE_SIZE];
+static msg_t _mbox_queue[QUEUE_SIZE];
+static mbox_t _mbox = MBOX_INIT(_mbox_queue, QUEUE_SIZE);
+static kernel_pid_t _main_pid;
+static kernel_pid_t _helper_pid;
+static unsigned _failed = 0;
+
+/* delivers a message after half the timeout; if told so, it then hogs the
+ * CPU past the receiver's deadline */
+static void *_helper(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        msg_t cmd, m = { .type = TEST_MSG_TYPE };
+
+        msg_receive(&cmd);
+        xtimer_usleep(TEST_TIMEOUT / 2);
+        if (cmd.type == CMD_MBOX) {
+            mbox_put(&_mbox, &m);
+        }
+        else {
+            msg_send(&m, _main_pid);
+        }
+        if (cmd.content.value) {
+            xtimer_spin(xtimer_ticks_from_usec(TEST_TIMEOUT));
+        }
+    }
+    return NULL;
+}
+
+static int _recv(int use_mbox, msg_t *m, uint32_t timeout)
+{
+    if (use_mbox) {
+        return xtimer_mbox_get_timeout(&_mbox, m, timeout);
+    }
+    return xtimer_msg_receive_timeout(m, timeout);
+}
+
+static int _queues_empty(void)
+{
+    return (msg_avail() == 0) && (cib_avail(&_mbox.cib) == 0);
+}
+
+static void _check(const char *name, int ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    if (!ok) {
+        _failed++;
+    }
+}
+
+static void _test_timeout(int use_mbox)
+{
+    msg_t m;
+    uint32_t start = xtimer_now_usec();
+    int res = _recv(use_mbox, &m, TEST_TIMEOUT);
+    uint32_t elapsed = xtimer_now_usec() - start;
+
+    _check("timeout", (res < 0) && (elapsed >= TEST_TIMEOUT) &&
+                      _queues_empty());
+}
+
+static void _test_delivered(int use_mbox, int preempt)
+{
+    msg_t cmd = { .type = use_mbox ? CMD_MBOX : CMD_MSG,
+                  .content = { .value = preempt } };
+    msg_t m = { .type = 0 };
+    int res;
+
+    msg_send(&cmd, _helper_pid);
+    res = _recv(use_mbox, &m, TEST_TIMEOUT);
+    /* the deadline must not leave anything behind */
+    _check(preempt ? "preempted" : "delivered",
+           (res > 0) && (m.type == TEST_MSG_TYPE) && _queues_empty());
+    /* the next call must time out and not see a left-over timeout */
+    res = _recv(use_mbox, &m, 2 * TEST_TIMEOUT);
+    _check("no left-over", (res < 0) && _queues_empty());
+}
+
+static void _run(int use_mbox)
+{
+    printf("Testing %s\n", use_mbox ? "xtimer_mbox_get_timeout()" :
+                                      "xtimer_msg_receive_timeout()");
+    _test_timeout(use_mbox);
+    _test_delivered(use_mbox, 0);
+    _test_delivered(use_mbox, 1);
+}
+
+int main(void)
+{
+    puts("START");
+    _main_pid = thread_getpid();
+    msg_init_queue(_main_queue, QUEUE_SIZE);
+    _helper_pid = thread_create(_stack, sizeof(_stack),
+                                THREAD_PRIORITY_MAIN - 1,
+                                THREAD_CREATE_STACKTEST, _helper, NULL,
+                                "helper");
+    _run(0);
+    _run(1);
+    puts(_failed ? "[FAILED]" : "[SUCCESS]");
+    return 0;
+}
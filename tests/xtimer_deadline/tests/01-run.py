@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("START")
+    for func in ("xtimer_msg_receive_timeout()", "xtimer_mbox_get_timeout()"):
+        child.expect_exact("Testing {}".format(func))
+        child.expect_exact("timeout: OK")
+        child.expect_exact("delivered: OK")
+        child.expect_exact("no left-over: OK")
+        child.expect_exact("preempted: OK")
+        child.expect_exact("no left-over: OK")
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Checks the firing order of timers with the pairing heap
+ *              backend of xtimer
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "random.h"
+#include "xtimer.h"
+
+#ifndef TEST_TIMERS
+#define TEST_TIMERS     (48U)
+#endif
+
+#ifndef TEST_ROUNDS
+#define TEST_ROUNDS     (5U)
+#endif
+
+/* time to arm all timers before the first one may fire */
+#define TEST_BASE_US    (20U * US_PER_MS)
+/* distance between two timers, long enough so arming timers one after
+ * another does not change their order */
+#define TEST_SLOT_US    (1U * US_PER_MS)
+/* timers are re-armed to the slots after the ones of the first pass */
+#define TEST_SLOTS      (2U * TEST_TIMERS)
+
+static xtimer_t _timers[TEST_TIMERS];
+static unsigned _slot[TEST_TIMERS];
+static bool _armed[TEST_TIMERS];
+static volatile unsigned _fired;
+static volatile unsigned _last_slot;
+static volatile unsigned _errors;
+static volatile unsigned _error_idx;
+
+static void _cb(void *arg)
+{
+    unsigned idx = (unsigned)(uintptr_t)arg;
+
+    /* removed timers must not fire, the others must fire in slot order */
+    if (!_armed[idx] || ((_fired > 0) && (_slot[idx] <= _last_slot))) {
+        if (_errors++ == 0) {
+            _error_idx = idx;
+        }
+    }
+    _armed[idx] = false;
+    _last_slot = _slot[idx];
+    _fired++;
+}
+
+static void _set(unsigned idx, unsigned slot, uint32_t start)
+{
+    uint32_t offset = (start + TEST_BASE_US + (slot * TEST_SLOT_US)) -
+                      xtimer_now_usec();
+
+    _slot[idx] = slot;
+    _armed[idx] = true;
+    _timers[idx].callback = _cb;
+    _timers[idx].arg = (void *)(uintptr_t)idx;
+    xtimer_set(&_timers[idx], offset);
+}
+
+/* unique random slots in [first, first + TEST_TIMERS) */
+static void _shuffle(unsigned *slots, unsigned first)
+{
+    for (unsigned i = 0; i < TEST_TIMERS; i++) {
+        slots[i] = first + i;
+    }
+    for (unsigned i = TEST_TIMERS - 1; i > 0; i--) {
+        unsigned j = random_uint32_range(0, i + 1);
+        unsigned tmp = slots[i];
+
+        slots[i] = slots[j];
+        slots[j] = tmp;
+    }
+}
+
+static int _round(void)
+{
+    unsigned slots[TEST_TIMERS];
+    unsigned expected = 0;
+    uint32_t start = xtimer_now_usec();
+
+    _fired = 0;
+    _errors = 0;
+    _shuffle(slots, 0);
+    for (unsigned i = 0; i < TEST_TIMERS; i++) {
+        _set(i, slots[i], start);
+    }
+    /* remove about a quarter and re-arm about a quarter of the timers to
+     * later slots, so timers leave the heap from any position */
+    _shuffle(slots, TEST_TIMERS);
+    for (unsigned i = 0; i < TEST_TIMERS; i++) {
+        switch (random_uint32_range(0, 4)) {
+            case 0:
+                xtimer_remove(&_timers[i]);
+                _armed[i] = false;
+                break;
+            case 1:
+                _set(i, slots[i], start);
+                expected++;
+                break;
+            default:
+                expected++;
+                break;
+        }
+    }
+    if ((xtimer_now_usec() - start) >= TEST_BASE_US) {
+        puts("arming the timers took too long");
+        return -1;
+    }
+    xtimer_usleep(TEST_BASE_US + ((TEST_SLOTS + 1) * TEST_SLOT_US));
+    if (_errors > 0) {
+        printf("timer %u (slot %u) fired out of order or though removed\n",
+               _error_idx, _slot[_error_idx]);
+        return -1;
+    }
+    if (_fired != expected) {
+        printf("%u of %u timers fired\n", _fired, expected);
+        return -1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    puts("xtimer_pheap test application.");
+
+    for (unsigned i = 0; i < TEST_ROUNDS; i++) {
+        random_init(i);
+        printf("round %u\n", i);
+        if (_round() < 0) {
+            puts("[FAILED]");
+            return 1;
+        }
+    }
+    puts("[SUCCESS]");
+    return 0;
+}